@@ -2859,6 +2859,97 @@ set(timestamp_file \"${generated_copy_files_info_path_timestamp}\")
     _qt_internal_assign_to_internal_targets_folder("${copy_files_target}")
 endfunction()
 
+# Generates the compressed texture variants of the images in RESOURCES for each
+# format in QT_QML_COMPRESSED_TEXTURE_FORMATS, and returns the generated files,
+# which are stored next to the images in the resource system. The compressors
+# are external tools, whose commands are given by QT_QML_TEXTURE_COMPRESSOR_<FORMAT>.
+function(_qt_internal_qml_add_compressed_texture_variants target out_var)
+    set(args_option "")
+    set(args_single "")
+    set(args_multi RESOURCES)
+    cmake_parse_arguments(PARSE_ARGV 2 arg
+        "${args_option}" "${args_single}" "${args_multi}"
+    )
+
+    set(variant_files "")
+    if(NOT QT_QML_COMPRESSED_TEXTURE_FORMATS)
+        set(${out_var} "" PARENT_SCOPE)
+        return()
+    endif()
+
+    if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.18)
+        set(scope_option TARGET_DIRECTORY ${target})
+    else()
+        set(scope_option "")
+    endif()
+
+    set(output_dir "${CMAKE_CURRENT_BINARY_DIR}/.qt/compressed_textures/${target}")
+    foreach(file_src IN LISTS arg_RESOURCES)
+        if(NOT file_src MATCHES "\\.([pP][nN][gG]|[jJ][pP][eE]?[gG])$")
+            continue()
+        endif()
+        get_filename_component(file_absolute ${file_src} ABSOLUTE)
+        get_source_file_property(skip_compression ${file_absolute}
+            QT_QML_SKIP_TEXTURE_COMPRESSION)
+        if(skip_compression)
+            continue()
+        endif()
+
+        __qt_get_relative_resource_path_for_file(file_resource_path ${file_src})
+        foreach(format IN LISTS QT_QML_COMPRESSED_TEXTURE_FORMATS)
+            string(TOLOWER "${format}" format)
+            string(TOUPPER "${format}" format_upper)
+            set(compressor "${QT_QML_TEXTURE_COMPRESSOR_${format_upper}}")
+            if(NOT compressor)
+                get_property(warned GLOBAL PROPERTY
+                    _qt_qml_texture_compressor_warned_${format_upper})
+                if(NOT warned)
+                    message(WARNING "QT_QML_COMPRESSED_TEXTURE_FORMATS contains ${format}, "
+                        "but QT_QML_TEXTURE_COMPRESSOR_${format_upper} is not set. "
+                        "No ${format} textures will be generated.")
+                    set_property(GLOBAL PROPERTY
+                        _qt_qml_texture_compressor_warned_${format_upper} TRUE)
+                endif()
+                continue()
+            endif()
+
+            set(variant_alias "${file_resource_path}.${format}.ktx")
+            set(variant_file "${output_dir}/${variant_alias}")
+            get_filename_component(variant_dir "${variant_file}" DIRECTORY)
+            # The command is either a list, or a single string with the
+            # arguments separated by spaces. The placeholders are replaced in
+            # each argument, so that paths with spaces stay one argument.
+            list(LENGTH compressor compressor_length)
+            if(compressor_length EQUAL 1)
+                separate_arguments(compressor NATIVE_COMMAND "${compressor}")
+            endif()
+            set(command "")
+            foreach(arg IN LISTS compressor)
+                string(REPLACE "<INPUT>" "${file_absolute}" arg "${arg}")
+                string(REPLACE "<OUTPUT>" "${variant_file}" arg "${arg}")
+                list(APPEND command "${arg}")
+            endforeach()
+
+            add_custom_command(
+                OUTPUT "${variant_file}"
+                COMMAND ${CMAKE_COMMAND} -E make_directory "${variant_dir}"
+                COMMAND ${command}
+                DEPENDS "${file_absolute}"
+                VERBATIM
+                COMMENT "Compressing ${file_resource_path} to ${format}"
+            )
+            set_source_files_properties("${variant_file}" ${scope_option}
+                PROPERTIES
+                    GENERATED TRUE
+                    QT_RESOURCE_ALIAS "${variant_alias}"
+            )
+            list(APPEND variant_files "${variant_file}")
+        endforeach()
+    endforeach()
+
+    set(${out_var} "${variant_files}" PARENT_SCOPE)
+endfunction()
+
 function(qt6_target_qml_sources target)
 
     get_target_property(uri        ${target} QT_QML_MODULE_URI)
@@ -3479,6 +3570,24 @@ function(qt6_target_qml_sources target)
     set_property(TARGET ${target}
         APPEND PROPERTY _qt_qml_module_sanitized_resource_names "${sanitized_resource_name}")
 
+    _qt_internal_qml_add_compressed_texture_variants(${target} texture_variants
+        RESOURCES ${arg_RESOURCES}
+    )
+    if(texture_variants)
+        set(variants_resource_name ${resource_name}_compressed_textures)
+        set(resource_targets)
+        qt6_add_resources(${target} ${variants_resource_name}
+            PREFIX ${arg_PREFIX}
+            FILES ${texture_variants}
+            OUTPUT_TARGETS resource_targets
+        )
+        list(APPEND output_targets ${resource_targets})
+        __qt_internal_sanitize_resource_name(
+            sanitized_resource_name "${variants_resource_name}")
+        set_property(TARGET ${target}
+            APPEND PROPERTY _qt_qml_module_sanitized_resource_names "${sanitized_resource_name}")
+    endif()
+
     if(extra_qmldirs AND NOT no_extra_qmldirs)
         list(REMOVE_DUPLICATES extra_qmldirs)
         __qt_internal_setup_policy(QTP0004 "6.8.0"
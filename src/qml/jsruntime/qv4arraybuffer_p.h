@@ -17,6 +17,7 @@
 #include "qv4object_p.h"
 #include "qv4functionobject_p.h"
 #include <QtCore/qarraydatapointer.h>
+#include <QtCore/qbytearray.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -50,6 +51,13 @@ struct Q_QML_EXPORT SharedArrayBuffer : Object {
 
     bool arrayDataNeedsDetach() const noexcept { return constArrayDataPointer().needsDetach(); }
 
+    // Returns a byte array referencing the same data, without copying it
+    QByteArray sharedArrayData() const noexcept
+    {
+        return QByteArray(QArrayDataPointer<char>(
+                *reinterpret_cast<const QArrayDataPointer<char> *>(&arrayDataPointerStorage)));
+    }
+
 private:
     const QArrayDataPointer<const char> &constArrayDataPointer() const noexcept
     {
@@ -132,7 +132,7 @@ public:
     QV4::ExecutionEngine *v4engine() const { return q_func()->handle(); }
 
 #if QT_CONFIG(qml_worker_script)
-    QThread *workerScriptEngine = nullptr;
+    QObject *workerScriptEngine = nullptr;
 #endif
 
     QUrl baseUrl;
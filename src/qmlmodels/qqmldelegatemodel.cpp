@@ -26,6 +26,7 @@
 QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(lcItemViewDelegateRecycling, "qt.qml.delegatemodel.recycling")
+Q_STATIC_LOGGING_CATEGORY(lcCoalescing, "qt.qml.delegatemodel.coalescing")
 
 class QQmlDelegateModelItem;
 
@@ -174,6 +175,8 @@ QQmlDelegateModelPrivate::QQmlDelegateModelPrivate(QQmlContext *ctxt)
     , m_transaction(false)
     , m_incubatorCleanupScheduled(false)
     , m_waitingToFetchMore(false)
+    , m_coalesceChanges(qEnvironmentVariableIntValue("QML_DELEGATEMODEL_COALESCE_CHANGES") > 0)
+    , m_coalescedChangesQueued(false)
     , m_cacheItems(nullptr)
     , m_items(nullptr)
     , m_persistedItems(nullptr)
@@ -1065,7 +1068,43 @@ void QQmlDelegateModelPrivate::reuseItem(QQmlDelegateModelItem *item, int newMod
 
 void QQmlDelegateModelPrivate::drainReusableItemsPool(int maxPoolTime)
 {
-    m_reusableItemsPool.drain(maxPoolTime, [this](QQmlDelegateModelItem *cacheItem){ destroyCacheItem(cacheItem); });
+    // A maxPoolTime of 0 only empties the pool of this model, for example
+    // when its view is resized. The objects other views parked in the
+    // shared pool age with the regular loading cycles.
+    QQmlSharedDelegateItemsPool *sharedPool = m_cacheMetaType
+            ? QQmlSharedDelegateItemsPool::get(m_cacheMetaType->v4Engine) : nullptr;
+    if (sharedPool && maxPoolTime > 0)
+        sharedPool->drain(maxPoolTime);
+
+    m_reusableItemsPool.drain(maxPoolTime, [this](QQmlDelegateModelItem *cacheItem) {
+        // Let other models with the same delegate pick up the object, if the
+        // engine has a shared pool. Otherwise, the item is no longer needed.
+        if (QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::poolFor(cacheItem)) {
+            emitDestroyingItem(cacheItem->object);
+            sharedPool->insertItem(cacheItem);
+            cacheItem->Dispose();
+        } else {
+            destroyCacheItem(cacheItem);
+        }
+    });
+}
+
+bool QQmlDelegateModelPrivate::adoptSharedObject(QQmlDelegateModelItem *cacheItem, QQmlComponent *delegate)
+{
+    if (m_adaptorModel.hasProxyObject() || QQmlComponentPrivate::get(delegate)->isBound())
+        return false;
+
+    QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::get(m_cacheMetaType->v4Engine);
+    if (!sharedPool)
+        return false;
+
+    QQmlContext *creationContext = delegate->creationContext();
+    cacheItem->delegate = delegate;
+    if (sharedPool->takeItem(cacheItem, QQmlContextData::get(creationContext ? creationContext : m_context.data())))
+        return true;
+
+    cacheItem->delegate = nullptr;
+    return false;
 }
 
 void QQmlDelegateModel::drainReusableItemsPool(int maxPoolTime)
@@ -1078,6 +1117,36 @@ int QQmlDelegateModel::poolSize()
     return d_func()->m_reusableItemsPool.size();
 }
 
+bool QQmlDelegateModel::sharesPooledItems() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_cacheMetaType && QQmlSharedDelegateItemsPool::get(d->m_cacheMetaType->v4Engine);
+}
+
+void QQmlDelegateModel::deliverCoalescedChanges()
+{
+    d_func()->deliverCoalescedChanges();
+}
+
+/*
+    Returns the number of source model signals whose changes were delivered
+    coalesced with others, when QML_DELEGATEMODEL_COALESCE_CHANGES is set.
+*/
+int QQmlDelegateModel::coalescedSignalCount() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_coalescingStats.signalCount;
+}
+
+/*
+    Returns the number of times coalesced changes were delivered.
+*/
+int QQmlDelegateModel::coalescedDeliveryCount() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_coalescingStats.deliveryCount;
+}
+
 QQmlComponent *QQmlDelegateModelPrivate::resolveDelegate(int index)
 {
     if (!m_delegateChooser)
@@ -1125,6 +1194,9 @@ void QQmlDelegateModelPrivate::incubatorStatusChanged(QQDMIncubationTask *incuba
 
     if (status == QQmlIncubator::Ready) {
         cacheItem->referenceObject();
+        // The index of the item is already the one after the held back
+        // changes, so the views need to have them first
+        deliverCoalescedChanges();
         if (QQuickPackage *package = qmlobject_cast<QQuickPackage *>(cacheItem->object))
             emitCreatedPackage(incubationTask, package);
         else
@@ -1162,6 +1234,7 @@ void QQmlDelegateModelPrivate::setInitialState(QQDMIncubationTask *incubationTas
     incubationTask->initializeRequiredProperties(incubationTask->incubating, o);
     cacheItem->object = o;
 
+    deliverCoalescedChanges();
     if (QQuickPackage *package = qmlobject_cast<QQuickPackage *>(cacheItem->object))
         emitInitPackage(incubationTask, package);
     else
@@ -1228,6 +1301,20 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
 
             cacheItem->groups = flags;
             addCacheItem(cacheItem, it);
+
+            // Another model using the same delegate might have left an object
+            // behind that we can adopt instead of incubating a new one.
+            if (adoptSharedObject(cacheItem, delegate)) {
+                // Like after incubation, the object holds a script reference
+                cacheItem->scriptRef += 1;
+                Q_EMIT q_func()->initItem(index, cacheItem->object);
+                reuseItem(cacheItem, index, flags);
+                cacheItem->referenceObject();
+
+                if (index == m_compositor.count(group) - 1)
+                    requestMoreIfNecessary();
+                return cacheItem->object;
+            }
         }
 
         cacheItem->delegate = delegate;
@@ -1472,7 +1559,7 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
         QVector<Compositor::Change> changes;
         d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
         d->itemsChanged(changes);
-        d->emitChanges();
+        d->emitOrCoalesceChanges();
     }
     const bool needToCheckDelegateChoiceInvalidation = d->m_delegateChooser && !roles.isEmpty();
     if (!needToCheckDelegateChoiceInvalidation)
@@ -1517,7 +1604,7 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
         item->releaseObject();
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsMoved(removes, inserts);
-    d->emitChanges();
+    d->emitOrCoalesceChanges();
 }
 
 static void incrementIndexes(QQmlDelegateModelItem *cacheItem, int count, const int *deltas)
@@ -1631,7 +1718,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsInserted(inserts);
-    d->emitChanges();
+    d->emitOrCoalesceChanges();
 }
 
 //### This method should be split in two. It will remove delegates, and it will re-render the list.
@@ -1788,7 +1875,7 @@ void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
     d->m_compositor.listItemsRemoved(&d->m_adaptorModel, index, count, &removes);
     d->itemsRemoved(removes);
 
-    d->emitChanges();
+    d->emitOrCoalesceChanges();
 }
 
 void QQmlDelegateModelPrivate::itemsMoved(
@@ -1848,7 +1935,7 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsMoved(&d->m_adaptorModel, from, to, count, &removes, &inserts);
     d->itemsMoved(removes, inserts);
-    d->emitChanges();
+    d->emitOrCoalesceChanges();
 }
 
 void QQmlDelegateModelPrivate::emitModelUpdated(const QQmlChangeSet &changeSet, bool reset)
@@ -1885,11 +1972,57 @@ void QQmlDelegateModelPrivate::delegateChanged(bool add, bool remove)
     emitChanges();
 }
 
+/*
+    Emits the changes caused by a signal from the source model. If change
+    coalescing is enabled, the changes are instead left to accumulate in the
+    change sets of the groups, which merge adjacent ranges, and delivered
+    once from the event loop, or when a view asks for them before it
+    polishes. The compositor and the cache are still updated right away, so
+    the model itself is always up to date.
+*/
+void QQmlDelegateModelPrivate::emitOrCoalesceChanges()
+{
+    Q_Q(QQmlDelegateModel);
+    if (!m_coalesceChanges) {
+        emitChanges();
+        return;
+    }
+
+    ++m_coalescingStats.pendingSignalCount;
+    if (m_coalescedChangesQueued)
+        return;
+
+    m_coalescedChangesQueued = true;
+    QMetaObject::invokeMethod(q, [this]() { deliverCoalescedChanges(); }, Qt::QueuedConnection);
+}
+
+void QQmlDelegateModelPrivate::deliverCoalescedChanges()
+{
+    if (m_coalescedChangesQueued)
+        emitChanges();
+}
+
 void QQmlDelegateModelPrivate::emitChanges()
 {
     if (m_transaction || !m_complete || !m_context || !m_context->isValid())
         return;
 
+    if (m_coalescedChangesQueued) {
+        // Any emission delivers the coalesced changes along with its own
+        m_coalescedChangesQueued = false;
+        const int pendingSignalCount = std::exchange(m_coalescingStats.pendingSignalCount, 0);
+        m_coalescingStats.signalCount += pendingSignalCount;
+        ++m_coalescingStats.deliveryCount;
+
+        if (lcCoalescing().isDebugEnabled() && m_items) {
+            const QQmlChangeSet &changeSet = QQmlDelegateModelGroupPrivate::get(m_items)->changeSet;
+            qCDebug(lcCoalescing) << "delivering" << pendingSignalCount << "model signals as"
+                                  << changeSet.removes().size() << "removes,"
+                                  << changeSet.inserts().size() << "inserts and"
+                                  << changeSet.changes().size() << "changes";
+        }
+    }
+
     m_transaction = true;
     QV4::ExecutionEngine *engine = m_context->engine()->handle();
     for (int i = 1; i < m_groupCount; ++i)
@@ -3978,6 +4111,162 @@ void QQmlReusableDelegateModelItemsPool::drain(int maxPoolTime, std::function<vo
 
 //============================================================================
 
+V4_DEFINE_EXTENSION(QQmlSharedDelegateItemsPool, sharedDelegateItemsPool)
+
+static int sharedDelegatePoolSize()
+{
+    // Not cached, so that every engine picks up the current value
+    return qEnvironmentVariableIntValue("QML_SHARED_DELEGATE_POOL_SIZE");
+}
+
+QQmlSharedDelegateItemsPool::QQmlSharedDelegateItemsPool(QV4::ExecutionEngine *engine)
+    : m_maxSize(sharedDelegatePoolSize())
+{
+    // The pooled objects have to go while the engine can still destroy them,
+    // rather than when the engine deletes its extensions.
+    if (QQmlEngine *qmlEngine = engine->qmlEngine()) {
+        QObject::connect(qmlEngine->rootContext(), &QObject::destroyed, qmlEngine,
+                         [this]() { trim(0); });
+    }
+}
+
+QQmlSharedDelegateItemsPool::~QQmlSharedDelegateItemsPool()
+{
+    // Anything still pooled here was released with the root context
+    Q_ASSERT(m_pool.isEmpty());
+}
+
+QQmlSharedDelegateItemsPool *QQmlSharedDelegateItemsPool::get(QV4::ExecutionEngine *engine)
+{
+    // The shared pool is opt-in. It hands delegate objects from one model to
+    // another model with the same delegate, which only makes sense if the
+    // application has more than one view using a common Component (e.g. views
+    // on different pages of a tab bar that are loaded and unloaded).
+    if (!engine || engine->inShutdown || sharedDelegatePoolSize() <= 0)
+        return nullptr;
+    return sharedDelegateItemsPool(engine);
+}
+
+QQmlSharedDelegateItemsPool *QQmlSharedDelegateItemsPool::poolFor(QQmlDelegateModelItem *modelItem)
+{
+    // An object can only move to another model item if all its model data is
+    // looked up through the context object. Required properties are bound to
+    // the model item itself, bound components have no context of their own,
+    // and packages and the DelegateModel attached object belong to a specific
+    // DelegateModel.
+    if (!modelItem->object || !modelItem->delegate || modelItem->incubationTask || modelItem->attached)
+        return nullptr;
+    if (!modelItem->contextData || !modelItem->contextData->isValid()
+            || modelItem->contextData->contextObject() != modelItem) {
+        return nullptr;
+    }
+    if (qmlobject_cast<QQuickPackage *>(modelItem->object))
+        return nullptr;
+
+    // A proxy context sits between the object and the context of the model item
+    QQmlData *data = QQmlData::get(modelItem->object);
+    if (!data || !data->context || data->context->parent().data() != modelItem->contextData.data())
+        return nullptr;
+
+    return get(modelItem->metaType->v4Engine);
+}
+
+void QQmlSharedDelegateItemsPool::insertItem(QQmlDelegateModelItem *modelItem)
+{
+    Q_ASSERT(poolFor(modelItem) == this);
+
+    // Detach the object from the model item, but keep its context. The
+    // bindings in the delegate stay as they are until another model adopts the
+    // object and refreshes them against its own model item.
+    QQmlData::get(modelItem->object)->context->setExtraObject(nullptr);
+    modelItem->contextData->setContextObject(nullptr);
+
+    qCDebug(lcItemViewDelegateRecycling)
+            << "shared pool: object:" << modelItem->object
+            << "delegate:" << modelItem->delegate
+            << "shared pool size:" << m_pool.size() + 1;
+
+    m_pool.append({ modelItem->delegate, modelItem->object, std::move(modelItem->contextData) });
+    modelItem->object = nullptr;
+
+    // Evict the least recently pooled objects first
+    removeStaleObjects();
+    trim(m_maxSize);
+}
+
+bool QQmlSharedDelegateItemsPool::takeItem(QQmlDelegateModelItem *modelItem, const QQmlRefPointer<QQmlContextData> &componentContext)
+{
+    Q_ASSERT(!modelItem->object);
+    Q_ASSERT(modelItem->delegate);
+
+    removeStaleObjects();
+
+    // Prefer the most recently pooled object, as it is the most likely to
+    // still be warm in the caches.
+    for (qsizetype i = m_pool.size() - 1; i >= 0; --i) {
+        const PooledObject &pooled = m_pool.at(i);
+        if (pooled.delegate != modelItem->delegate || pooled.contextData->parent().data() != componentContext.data())
+            continue;
+
+        PooledObject adopted = m_pool.takeAt(i);
+        modelItem->object = adopted.object;
+        modelItem->contextData = std::move(adopted.contextData);
+        modelItem->contextData->setContextObject(modelItem);
+        QQmlData::get(modelItem->object)->context->setExtraObject(modelItem);
+
+        // Re-evaluate the bindings in the delegate, now that the model data
+        // comes from a different model item.
+        modelItem->contextData->refreshExpressions();
+
+        qCDebug(lcItemViewDelegateRecycling)
+                << "shared pool: adopted object:" << modelItem->object
+                << "delegate:" << modelItem->delegate
+                << "new index:" << modelItem->modelIndex()
+                << "shared pool size:" << m_pool.size();
+        return true;
+    }
+
+    return false;
+}
+
+void QQmlSharedDelegateItemsPool::drain(int maxPoolTime)
+{
+    // Like the pools of the models, the shared pool counts the loading cycles
+    // an object has been resting in it, and releases it once that exceeds
+    // maxPoolTime. The cycles of all views sharing the pool count.
+    removeStaleObjects();
+    m_pool.removeIf([maxPoolTime](PooledObject &pooled) {
+        if (++pooled.poolTime <= maxPoolTime)
+            return false;
+        delete pooled.object.data();
+        return true;
+    });
+
+    qCDebug(lcItemViewDelegateRecycling) << "shared pool size after drain:" << m_pool.size();
+}
+
+void QQmlSharedDelegateItemsPool::removeStaleObjects()
+{
+    // Objects can not be adopted anymore once their delegate or the context
+    // they were created in is gone.
+    m_pool.removeIf([](const PooledObject &pooled) {
+        if (pooled.delegate && pooled.object && pooled.contextData->isValid())
+            return false;
+        delete pooled.object.data();
+        return true;
+    });
+}
+
+void QQmlSharedDelegateItemsPool::trim(qsizetype maxSize)
+{
+    while (m_pool.size() > maxSize) {
+        const PooledObject pooled = m_pool.takeFirst();
+        delete pooled.object.data();
+    }
+}
+
+//============================================================================
+
 struct QQmlDelegateModelGroupChange : QV4::Object
 {
     V4_OBJECT2(QQmlDelegateModelGroupChange, QV4::Object)
@@ -84,6 +84,10 @@ public:
 
     void drainReusableItemsPool(int maxPoolTime) override;
     int poolSize() override;
+    bool sharesPooledItems() const override;
+    void deliverCoalescedChanges() override;
+    int coalescedSignalCount() const;
+    int coalescedDeliveryCount() const;
 
     int indexOf(QObject *object, QObject *objectContext) const override;
 
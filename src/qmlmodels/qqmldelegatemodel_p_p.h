@@ -177,6 +177,36 @@ private:
     QList<QQmlDelegateModelItem *> m_reusableItemsPool;
 };
 
+class QQmlSharedDelegateItemsPool : public QV4::ExecutionEngine::Deletable
+{
+public:
+    QQmlSharedDelegateItemsPool(QV4::ExecutionEngine *engine);
+    ~QQmlSharedDelegateItemsPool() override;
+
+    static QQmlSharedDelegateItemsPool *get(QV4::ExecutionEngine *engine);
+    static QQmlSharedDelegateItemsPool *poolFor(QQmlDelegateModelItem *modelItem);
+
+    void insertItem(QQmlDelegateModelItem *modelItem);
+    bool takeItem(QQmlDelegateModelItem *modelItem, const QQmlRefPointer<QQmlContextData> &componentContext);
+    void drain(int maxPoolTime);
+    qsizetype size() const { return m_pool.size(); }
+
+private:
+    struct PooledObject
+    {
+        QPointer<QQmlComponent> delegate;
+        QPointer<QObject> object;
+        QQmlRefPointer<QQmlContextData> contextData;
+        int poolTime = 0;
+    };
+
+    void removeStaleObjects();
+    void trim(qsizetype maxSize);
+
+    QList<PooledObject> m_pool;
+    const qsizetype m_maxSize;
+};
+
 class QQmlDelegateModelPrivate;
 class QQDMIncubationTask : public QQmlIncubator
 {
@@ -280,6 +310,7 @@ public:
 
     void reuseItem(QQmlDelegateModelItem *item, int newModelIndex, int newGroups);
     void drainReusableItemsPool(int maxPoolTime);
+    bool adoptSharedObject(QQmlDelegateModelItem *cacheItem, QQmlComponent *delegate);
     QQmlComponent *resolveDelegate(int index);
 
     void addGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
@@ -300,6 +331,8 @@ public:
             const QVector<Compositor::Remove> &removes, const QVector<Compositor::Insert> &inserts);
     void itemsChanged(const QVector<Compositor::Change> &changes);
     void emitChanges();
+    void emitOrCoalesceChanges();
+    void deliverCoalescedChanges();
     void emitModelUpdated(const QQmlChangeSet &changeSet, bool reset) override;
     void delegateChanged(bool add = true, bool remove = true);
 
@@ -340,6 +373,15 @@ public:
     int m_count;
     int m_groupCount;
 
+    // Model signals received since the changes were last delivered, when
+    // QML_DELEGATEMODEL_COALESCE_CHANGES is set, and the totals so far.
+    struct CoalescingStats {
+        int pendingSignalCount = 0;
+        int signalCount = 0;
+        int deliveryCount = 0;
+    };
+    CoalescingStats m_coalescingStats;
+
     QQmlListCompositor::Group m_compositorGroup;
     bool m_complete : 1;
     bool m_delegateValidated : 1;
@@ -347,6 +389,8 @@ public:
     bool m_transaction : 1;
     bool m_incubatorCleanupScheduled : 1;
     bool m_waitingToFetchMore : 1;
+    bool m_coalesceChanges : 1;
+    bool m_coalescedChangesQueued : 1;
 
     union {
         struct {
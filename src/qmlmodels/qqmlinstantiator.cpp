@@ -65,6 +65,11 @@ void QQmlInstantiatorPrivate::regenerate()
     if (!componentComplete)
         return;
 
+    // Take the changes the model holds back, so they are not applied again
+    // to the objects created below
+    if (instanceModel)
+        instanceModel->deliverCoalescedChanges();
+
     int prevCount = q->count();
 
     clear();
@@ -21,6 +21,7 @@
 #include <private/qv4objectiterator_p.h>
 #include <private/qv4qmlcontext_p.h>
 #include <private/qv4sequenceobject_p.h>
+#include <private/qv4typedarray_p.h>
 #include <private/qv4urlobject_p.h>
 
 #include <qqmlcontext.h>
@@ -30,6 +31,9 @@
 #include <QtCore/qstack.h>
 #include <QXmlStreamReader>
 #include <QtCore/qdatetime.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
 #include <QScopedValueRollback>
 
 Q_DECLARE_METATYPE(const QV4::CompiledData::Binding*);
@@ -129,6 +133,21 @@ const ListLayout::Role &ListLayout::createRole(const QString &key, ListLayout::R
         r->subLayout = nullptr;
     }
 
+    int roleIndex = roles.size();
+    r->index = roleIndex;
+
+    roles.append(r);
+    roleHash.insert(key, r);
+
+    if (columnar && type == Role::Number) {
+        r->column = numberColumnCount++;
+        return *r;
+    }
+    if (columnar && type == Role::Bool) {
+        r->column = boolColumnCount++;
+        return *r;
+    }
+
     int dataSize = dataSizes[type];
     int dataAlignment = dataAlignments[type];
 
@@ -143,16 +162,21 @@ const ListLayout::Role &ListLayout::createRole(const QString &key, ListLayout::R
         currentBlockOffset = dataOffset + dataSize;
     }
 
-    int roleIndex = roles.size();
-    r->index = roleIndex;
-
-    roles.append(r);
-    roleHash.insert(key, r);
-
     return *r;
 }
 
-ListLayout::ListLayout(const ListLayout *other) : currentBlock(0), currentBlockOffset(0)
+// The roles of a layout never change type, so numbers and bools are kept in
+// columns. QML_LISTMODEL_ROW_STORAGE keeps them in the element blocks instead, so
+// that both can be compared. It is not cached, to allow switching between models.
+ListLayout::ListLayout()
+    : currentBlock(0), currentBlockOffset(0), numberColumnCount(0), boolColumnCount(0),
+      columnar(!qEnvironmentVariableIntValue("QML_LISTMODEL_ROW_STORAGE"))
+{
+}
+
+ListLayout::ListLayout(const ListLayout *other)
+    : currentBlock(0), currentBlockOffset(0), numberColumnCount(0), boolColumnCount(0),
+      columnar(other->columnar)
 {
     const int otherRolesCount = other->roles.size();
     roles.reserve(otherRolesCount);
@@ -163,6 +187,8 @@ ListLayout::ListLayout(const ListLayout *other) : currentBlock(0), currentBlockO
     }
     currentBlockOffset = other->currentBlockOffset;
     currentBlock = other->currentBlock;
+    numberColumnCount = other->numberColumnCount;
+    boolColumnCount = other->boolColumnCount;
 }
 
 ListLayout::~ListLayout()
@@ -183,6 +209,8 @@ void ListLayout::sync(ListLayout *src, ListLayout *target)
 
     target->currentBlockOffset = src->currentBlockOffset;
     target->currentBlock = src->currentBlock;
+    target->numberColumnCount = src->numberColumnCount;
+    target->boolColumnCount = src->boolColumnCount;
 }
 
 ListLayout::Role::Role(const Role *other)
@@ -191,6 +219,7 @@ ListLayout::Role::Role(const Role *other)
     type = other->type;
     blockIndex = other->blockIndex;
     blockOffset = other->blockOffset;
+    column = other->column;
     index = other->index;
     if (other->subLayout)
         subLayout = new ListLayout(other->subLayout);
@@ -404,6 +433,7 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         ListElement *targetElement = s.target;
         if (targetElement == nullptr) {
             targetElement = new ListElement(srcElement->getUid());
+            targetElement->setColumns(&target->m_columns);
         }
         s.changedRoles = ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout);
         target->elements.append(targetElement);
@@ -433,9 +463,16 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         if (s.srcIndex != s.targetIndex) {
             if (targetModel) {
                 if (s.targetIndex == -1) {
-                    targetModel->beginInsertRows(QModelIndex(), i, i);
+                    // report a run of consecutive new elements as one insertion
+                    int last = i;
+                    while (last + 1 < targetElementCount
+                           && elementHash.find(target->elements.at(last + 1)->getUid())->targetIndex == -1) {
+                        ++last;
+                    }
+                    targetModel->beginInsertRows(QModelIndex(), i, last);
                     targetModel->endInsertRows();
-                    ++rowsInserted;
+                    rowsInserted += last - i + 1;
+                    i = last;
                 } else {
                     bool validMove = targetModel->beginMoveRows(QModelIndex(), s.targetIndex, s.targetIndex, QModelIndex(), i);
                     Q_ASSERT(validMove);
@@ -472,6 +509,36 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     return hasChanges;
 }
 
+int ListColumns::allocateSlot()
+{
+    if (!freeSlots.isEmpty())
+        return freeSlots.takeLast();
+    return slotCount++;
+}
+
+void ListColumns::releaseSlot(int slot)
+{
+    freeSlots.append(slot);
+    if (freeSlots.size() == slotCount) {
+        // All elements are gone, start over with contiguous slots
+        numbers.clear();
+        bools.clear();
+        freeSlots.clear();
+        slotCount = 0;
+        return;
+    }
+
+    // Reused slots must start out cleared, like the data of a new element
+    for (QList<double> &values : numbers) {
+        if (slot < values.size())
+            values[slot] = 0.0;
+    }
+    for (QList<bool> &values : bools) {
+        if (slot < values.size())
+            values[slot] = false;
+    }
+}
+
 ListModel::ListModel(ListLayout *layout, QQmlListModel *modelCache) : m_layout(layout), m_modelCache(modelCache)
 {
 }
@@ -494,6 +561,63 @@ int ListModel::appendElement()
     return elementIndex;
 }
 
+int ListModel::appendElements(int count)
+{
+    int elementIndex = elements.count();
+    elements.reserve(elementIndex + count);
+    for (int i = 0; i < count; ++i)
+        newElement(elementIndex + i);
+    return elementIndex;
+}
+
+void ListModel::setNumberColumn(int firstElementIndex, QV4::String *key, const QV4::TypedArray *values)
+{
+    const ListLayout::Role &r = m_layout->getRoleOrCreate(key, ListLayout::Role::Number);
+    if (r.type != ListLayout::Role::Number)
+        return;
+
+    // The elements were just appended, so their values can be written directly
+    ListElement **e = &elements[firstElementIndex];
+    const char *data = values->constArrayData() + values->byteOffset();
+    const int count = int(values->length());
+    Q_ASSERT(firstElementIndex + count <= elements.count());
+    const auto setNumbers = [&](auto zero) {
+        using T = decltype(zero);
+        for (int i = 0; i < count; ++i)
+            e[i]->setDoublePropertyFast(r, double(qFromUnaligned<T>(data + i * sizeof(T))));
+    };
+
+    switch (values->arrayType()) {
+    case QV4::Heap::TypedArray::Int8Array:
+        setNumbers(qint8());
+        break;
+    case QV4::Heap::TypedArray::UInt8Array:
+    case QV4::Heap::TypedArray::UInt8ClampedArray:
+        setNumbers(quint8());
+        break;
+    case QV4::Heap::TypedArray::Int16Array:
+        setNumbers(qint16());
+        break;
+    case QV4::Heap::TypedArray::UInt16Array:
+        setNumbers(quint16());
+        break;
+    case QV4::Heap::TypedArray::Int32Array:
+        setNumbers(qint32());
+        break;
+    case QV4::Heap::TypedArray::UInt32Array:
+        setNumbers(quint32());
+        break;
+    case QV4::Heap::TypedArray::Float32Array:
+        setNumbers(float());
+        break;
+    case QV4::Heap::TypedArray::Float64Array:
+        setNumbers(double());
+        break;
+    default:
+        Q_UNREACHABLE();
+    }
+}
+
 void ListModel::insertElement(int index)
 {
     newElement(index);
@@ -525,6 +649,7 @@ void ListModel::move(int from, int to, int n)
 void ListModel::newElement(int index)
 {
     ListElement *e = new ListElement;
+    e->setColumns(&m_columns);
     elements.insert(index, e);
 }
 
@@ -744,6 +869,66 @@ void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement
     }
 }
 
+void ListModel::setFromJson(int elementIndex, const QJsonObject &object)
+{
+    ListElement *e = elements[elementIndex];
+
+    for (auto it = object.constBegin(), end = object.constEnd(); it != end; ++it) {
+        const QJsonValue value = it.value();
+        switch (value.type()) {
+        case QJsonValue::String: {
+            const ListLayout::Role &r = m_layout->getRoleOrCreate(it.key(), ListLayout::Role::String);
+            if (r.type == ListLayout::Role::String)
+                e->setStringPropertyFast(r, value.toString());
+            break;
+        }
+        case QJsonValue::Double: {
+            const ListLayout::Role &r = m_layout->getRoleOrCreate(it.key(), ListLayout::Role::Number);
+            if (r.type == ListLayout::Role::Number)
+                e->setDoublePropertyFast(r, value.toDouble());
+            break;
+        }
+        case QJsonValue::Bool: {
+            const ListLayout::Role &r = m_layout->getRoleOrCreate(it.key(), ListLayout::Role::Bool);
+            if (r.type == ListLayout::Role::Bool)
+                e->setBoolPropertyFast(r, value.toBool());
+            break;
+        }
+        case QJsonValue::Array: {
+            const ListLayout::Role &r = m_layout->getRoleOrCreate(it.key(), ListLayout::Role::List);
+            if (r.type == ListLayout::Role::List) {
+                ListModel *subModel = new ListModel(r.subLayout, nullptr);
+                const QJsonArray array = value.toArray();
+                for (const QJsonValue &item : array) {
+                    if (item.isObject())
+                        subModel->setFromJson(subModel->appendElement(), item.toObject());
+                    else
+                        qmlWarning(nullptr) << QStringLiteral("Can't add a value which is not an object to list role '%1'").arg(r.name);
+                }
+                e->setListPropertyFast(r, subModel);
+            }
+            break;
+        }
+        case QJsonValue::Object: {
+            const ListLayout::Role &r = m_layout->getRoleOrCreate(it.key(), ListLayout::Role::VariantMap);
+            if (r.type == ListLayout::Role::VariantMap) {
+                QVariantMap map = value.toObject().toVariantMap();
+                e->setVariantMapProperty(r, &map);
+            }
+            break;
+        }
+        case QJsonValue::Null: {
+            QQmlError err;
+            err.setDescription(QString::fromLatin1("%1 is null. Adding an object with a null member does not create a role for it.").arg(it.key()));
+            qmlWarning(nullptr, err);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
 QVector<std::function<void()>> ListModel::remove(int index, int count)
 {
     QVector<std::function<void()>> toDestroy;
@@ -921,6 +1106,12 @@ ListModel *ListElement::getListProperty(const ListLayout::Role &role)
 
 QVariant ListElement::getProperty(const ListLayout::Role &role, const QQmlListModel *owner, QV4::ExecutionEngine *eng)
 {
+    if (role.column >= 0) {
+        if (role.type == ListLayout::Role::Number)
+            return getDoubleProperty(role);
+        return getBoolProperty(role);
+    }
+
     char *mem = getPropertyMemory(role);
 
     QVariant data;
@@ -1033,10 +1224,8 @@ int ListElement::setDoubleProperty(const ListLayout::Role &role, double d)
     int roleIndex = -1;
 
     if (role.type == ListLayout::Role::Number) {
-        char *mem = getPropertyMemory(role);
-        double *value = reinterpret_cast<double *>(mem);
-        bool changed = *value != d;
-        *value = d;
+        bool changed = getDoubleProperty(role) != d;
+        setDoublePropertyFast(role, d);
         if (changed)
             roleIndex = role.index;
     }
@@ -1049,10 +1238,8 @@ int ListElement::setBoolProperty(const ListLayout::Role &role, bool b)
     int roleIndex = -1;
 
     if (role.type == ListLayout::Role::Bool) {
-        char *mem = getPropertyMemory(role);
-        bool *value = reinterpret_cast<bool *>(mem);
-        bool changed = *value != b;
-        *value = b;
+        bool changed = getBoolProperty(role) != b;
+        setBoolPropertyFast(role, b);
         if (changed)
             roleIndex = role.index;
     }
@@ -1209,6 +1396,12 @@ void ListElement::setStringPropertyFast(const ListLayout::Role &role, const QStr
 
 void ListElement::setDoublePropertyFast(const ListLayout::Role &role, double d)
 {
+    if (role.column >= 0) {
+        Q_ASSERT(columns);
+        columns->setNumber(role.column, slot, d);
+        return;
+    }
+
     char *mem = getPropertyMemory(role);
     double *value = new (mem) double;
     *value = d;
@@ -1216,6 +1409,12 @@ void ListElement::setDoublePropertyFast(const ListLayout::Role &role, double d)
 
 void ListElement::setBoolPropertyFast(const ListLayout::Role &role, bool b)
 {
+    if (role.column >= 0) {
+        Q_ASSERT(columns);
+        columns->setBoolean(role.column, slot, b);
+        return;
+    }
+
     char *mem = getPropertyMemory(role);
     bool *value = new (mem) bool;
     *value = b;
@@ -1297,6 +1496,8 @@ void ListElement::clearProperty(const ListLayout::Role &role)
 ListElement::ListElement()
 {
     m_objectCache = nullptr;
+    columns = nullptr;
+    slot = -1;
     uid = uidCounter.fetchAndAddOrdered(1);
     next = nullptr;
     memset(data, 0, sizeof(data));
@@ -1305,11 +1506,38 @@ ListElement::ListElement()
 ListElement::ListElement(int existingUid)
 {
     m_objectCache = nullptr;
+    columns = nullptr;
+    slot = -1;
     uid = existingUid;
     next = nullptr;
     memset(data, 0, sizeof(data));
 }
 
+void ListElement::setColumns(ListColumns *c)
+{
+    Q_ASSERT(!columns);
+    columns = c;
+    slot = c->allocateSlot();
+}
+
+double ListElement::getDoubleProperty(const ListLayout::Role &role)
+{
+    if (role.column >= 0) {
+        Q_ASSERT(columns);
+        return columns->number(role.column, slot);
+    }
+    return *reinterpret_cast<double *>(getPropertyMemory(role));
+}
+
+bool ListElement::getBoolProperty(const ListLayout::Role &role)
+{
+    if (role.column >= 0) {
+        Q_ASSERT(columns);
+        return columns->boolean(role.column, slot);
+    }
+    return *reinterpret_cast<bool *>(getPropertyMemory(role));
+}
+
 ListElement::~ListElement()
 {
     delete next;
@@ -1440,6 +1668,12 @@ void ListElement::destroy(ListLayout *layout)
         }
     }
 
+    if (columns) {
+        columns->releaseSlot(slot);
+        columns = nullptr;
+        slot = -1;
+    }
+
     if (next)
         next->destroy(nullptr);
     uid = -1;
@@ -2027,6 +2261,11 @@ void DynamicRoleModelNodeMetaObject::propertyWritten(int index)
     You must call sync() or else the changes made to the list from that
     thread will not be reflected in the list model in the main thread.
 
+    To load large amounts of data in the worker script, prefer appendFromJson()
+    and appendColumns() over calling append() for each item. They fill the
+    model in one pass, and the following sync() notifies the views of all the
+    new items at once.
+
     \sa {qml-data-models}{Data Models}, {Qt Qml}
 */
 
@@ -2661,6 +2900,192 @@ void QQmlListModel::append(QQmlV4FunctionPtr args)
     }
 }
 
+/*!
+    \qmlmethod ListModel::appendColumns(jsobject columns)
+    \since 6.10
+
+    Adds items to the end of the list model, taking the values of each role
+    from the arrays in \a columns. All the arrays must have the same length,
+    which is the number of items added. The views are notified once for all
+    the items.
+
+    The arrays can be JavaScript arrays or typed arrays. The values of typed
+    arrays are copied to number roles without converting each of them to a
+    JavaScript value, which makes appendColumns() the fastest way of filling a
+    model with large amounts of numeric data:
+
+    \code
+        var count = 100000
+        var x = new Float64Array(count)
+        var y = new Float64Array(count)
+        // ... fill x and y
+        pointModel.appendColumns({"x": x, "y": y})
+    \endcode
+
+    \sa append(), appendFromJson()
+*/
+void QQmlListModel::appendColumns(QQmlV4FunctionPtr args)
+{
+    QV4::Scope scope(args->v4engine());
+    QV4::ScopedObject columns(scope, args->length() == 1 ? (*args)[0] : QV4::Value::undefinedValue());
+    if (!columns || columns->isArrayObject()) {
+        qmlWarning(this) << tr("appendColumns: value is not an object");
+        return;
+    }
+
+    QV4::ScopedString name(scope);
+    QV4::ScopedValue value(scope);
+    QV4::ScopedObject column(scope);
+
+    int columnCount = 0;
+    int rowCount = 0;
+    {
+        QV4::ObjectIterator it(scope, columns, QV4::ObjectIterator::EnumerableOnly);
+        while (1) {
+            name = it.nextPropertyNameAsString(value);
+            if (!name)
+                break;
+
+            column = value;
+            int length;
+            const QV4::TypedArray *typedArray = column ? column->as<QV4::TypedArray>() : nullptr;
+            if (typedArray && !typedArray->hasDetachedArrayData()) {
+                length = int(typedArray->length());
+            } else if (column && column->isArrayObject()) {
+                length = int(column->getLength());
+            } else {
+                qmlWarning(this) << tr("appendColumns: value of role %1 is not an array").arg(name->toQString());
+                return;
+            }
+
+            if (columnCount > 0 && length != rowCount) {
+                qmlWarning(this) << tr("appendColumns: arrays have different lengths");
+                return;
+            }
+            rowCount = length;
+            ++columnCount;
+        }
+    }
+
+    if (rowCount == 0)
+        return;
+
+    // Names and values of the columns
+    QV4::Value *names = scope.alloc(columnCount);
+    QV4::Value *values = scope.alloc(columnCount);
+    {
+        QV4::ObjectIterator it(scope, columns, QV4::ObjectIterator::EnumerableOnly);
+        for (int i = 0; i < columnCount; ++i) {
+            name = it.nextPropertyNameAsString(value);
+            names[i] = name;
+            values[i] = value;
+        }
+    }
+
+    const int index = count();
+    emitItemsAboutToBeInserted(index, rowCount);
+
+    // Typed arrays go straight into the elements, everything else row by row
+    bool allTyped = true;
+    if (!m_dynamicRoles) {
+        const int first = m_listModel->appendElements(rowCount);
+        for (int i = 0; i < columnCount; ++i) {
+            column = values[i];
+            name = names[i];
+            if (const QV4::TypedArray *typedArray = column->as<QV4::TypedArray>())
+                m_listModel->setNumberColumn(first, name, typedArray);
+            else
+                allTyped = false;
+        }
+    }
+
+    if (m_dynamicRoles || !allTyped) {
+        QV4::ScopedObject row(scope);
+        for (int r = 0; r < rowCount; ++r) {
+            row = scope.engine->newObject();
+            for (int i = 0; i < columnCount; ++i) {
+                column = values[i];
+                if (!m_dynamicRoles && column->as<QV4::TypedArray>())
+                    continue;
+                name = names[i];
+                value = column->get(r);
+                row->put(name, value);
+            }
+
+            if (m_dynamicRoles)
+                m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(row), this));
+            else
+                m_listModel->set(index + r, row, ListModel::SetElement::WasJustInserted);
+        }
+    }
+
+    emitItemsInserted();
+}
+
+/*!
+    \qmlmethod ListModel::appendFromJson(string json)
+    \since 6.10
+
+    Adds the items described by \a json to the end of the list model. The
+    string must hold an array of objects, or a single object, in the same
+    format as the values passed to append(). The views are notified once for
+    all the items.
+
+    The string is parsed and stored in the model directly, without creating a
+    JavaScript object for each item, which makes appendFromJson() much faster
+    than calling append() with the result of \c JSON.parse():
+
+    \code
+        var request = new XMLHttpRequest()
+        request.onreadystatechange = function() {
+            if (request.readyState === XMLHttpRequest.DONE)
+                contactModel.appendFromJson(request.responseText)
+        }
+    \endcode
+
+    \sa append(), appendColumns()
+*/
+void QQmlListModel::appendFromJson(const QString &json)
+{
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(json.toUtf8(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        qmlWarning(this) << tr("appendFromJson: %1 at offset %2").arg(error.errorString()).arg(error.offset);
+        return;
+    }
+
+    QJsonArray items;
+    if (document.isArray())
+        items = document.array();
+    else
+        items.append(document.object());
+
+    for (const QJsonValue &item : std::as_const(items)) {
+        if (!item.isObject()) {
+            qmlWarning(this) << tr("appendFromJson: value is not an object");
+            return;
+        }
+    }
+
+    const int itemCount = int(items.size());
+    if (itemCount == 0)
+        return;
+
+    const int index = count();
+    emitItemsAboutToBeInserted(index, itemCount);
+
+    if (m_dynamicRoles) {
+        for (const QJsonValue &item : std::as_const(items))
+            m_modelObjects.append(DynamicRoleModelNode::create(item.toObject().toVariantMap(), this));
+    } else {
+        const int first = m_listModel->appendElements(itemCount);
+        for (int i = 0; i < itemCount; ++i)
+            m_listModel->setFromJson(first + i, items.at(i).toObject());
+    }
+
+    emitItemsInserted();
+}
+
 /*!
     \qmlmethod object ListModel::get(int index)
 
@@ -20,7 +20,9 @@
 #include <private/qqmlengine_p.h>
 #include <private/qqmlopenmetaobject_p.h>
 #include <private/qv4qobjectwrapper_p.h>
+#include <private/qv4typedarray_p.h>
 #include <qqml.h>
+#include <QtCore/qjsonobject.h>
 
 QT_REQUIRE_CONFIG(qml_list_model);
 
@@ -168,7 +170,7 @@ protected:
 class ListLayout
 {
 public:
-    ListLayout() : currentBlock(0), currentBlockOffset(0) {}
+    ListLayout();
     ListLayout(const ListLayout *other);
     ~ListLayout();
 
@@ -176,7 +178,7 @@ public:
     {
     public:
 
-        Role() : type(Invalid), blockIndex(-1), blockOffset(-1), index(-1), subLayout(0) {}
+        Role() : type(Invalid), blockIndex(-1), blockOffset(-1), column(-1), index(-1), subLayout(0) {}
         explicit Role(const Role *other);
         ~Role();
 
@@ -202,6 +204,7 @@ public:
         DataType type;
         int blockIndex;
         int blockOffset;
+        int column; // index in ListColumns, or -1 if stored in the element blocks
         int index;
         ListLayout *subLayout;
     };
@@ -223,6 +226,9 @@ private:
 
     int currentBlock;
     int currentBlockOffset;
+    int numberColumnCount;
+    int boolColumnCount;
+    bool columnar;
     QVector<Role *> roles;
     QStringHash<Role *> roleHash;
 };
@@ -248,6 +254,55 @@ private:
     uint stringSize = 0;
 };
 
+/*!
+\internal
+
+Stores the values of the Number and Bool roles of a ListModel in one
+contiguous array per role, rather than in the blocks of each element. Scanning
+a role over many rows then reads consecutive memory instead of following the
+block chain of every element.
+
+Elements refer to their values through a slot, which does not change when
+elements are inserted, removed or moved.
+*/
+class ListColumns
+{
+public:
+    int allocateSlot();
+    void releaseSlot(int slot);
+
+    double number(int column, int slot) const { return value(numbers, column, slot); }
+    void setNumber(int column, int slot, double d) { setValue(numbers, column, slot, d); }
+
+    bool boolean(int column, int slot) const { return value(bools, column, slot); }
+    void setBoolean(int column, int slot, bool b) { setValue(bools, column, slot, b); }
+
+private:
+    template<typename T>
+    static T value(const QList<QList<T>> &columns, int column, int slot)
+    {
+        if (column >= columns.size() || slot >= columns.at(column).size())
+            return T();
+        return columns.at(column).at(slot);
+    }
+
+    template<typename T>
+    void setValue(QList<QList<T>> &columns, int column, int slot, T v)
+    {
+        if (column >= columns.size())
+            columns.resize(column + 1);
+        QList<T> &values = columns[column];
+        if (slot >= values.size())
+            values.resize(slotCount);
+        values[slot] = v;
+    }
+
+    QList<QList<double>> numbers;
+    QList<QList<bool>> bools;
+    QList<int> freeSlots;
+    int slotCount = 0;
+};
+
 /*!
 \internal
 */
@@ -255,7 +310,8 @@ class ListElement
 {
 public:
     enum ObjectIndestructible { Indestructible = 1, ExplicitlySet = 2 };
-    enum { BLOCK_SIZE = 64 - sizeof(int) - sizeof(ListElement *) - sizeof(ModelNodeMetaObject *) };
+    enum { BLOCK_SIZE = 64 - 2 * sizeof(int) - sizeof(ListElement *) - sizeof(ModelNodeMetaObject *)
+                        - sizeof(ListColumns *) };
 
     ListElement();
     ListElement(int existingUid);
@@ -295,6 +351,10 @@ private:
 
     void clearProperty(const ListLayout::Role &role);
 
+    void setColumns(ListColumns *c);
+    double getDoubleProperty(const ListLayout::Role &role);
+    bool getBoolProperty(const ListLayout::Role &role);
+
     QVariant getProperty(const ListLayout::Role &role, const QQmlListModel *owner, QV4::ExecutionEngine *eng);
     ListModel *getListProperty(const ListLayout::Role &role);
     StringOrTranslation *getStringProperty(const ListLayout::Role &role);
@@ -315,7 +375,9 @@ private:
     ListElement *next;
 
     int uid;
+    int slot;
     QObject *m_objectCache;
+    ListColumns *columns;
 
     friend class ListModel;
 };
@@ -376,8 +438,12 @@ public:
     Q_REQUIRED_RESULT QVector<std::function<void()>> remove(int index, int count);
 
     int appendElement();
+    int appendElements(int count);
     void insertElement(int index);
 
+    void setNumberColumn(int firstElementIndex, QV4::String *key, const QV4::TypedArray *values);
+    void setFromJson(int elementIndex, const QJsonObject &object);
+
     void move(int from, int to, int n);
 
     static bool sync(ListModel *src, ListModel *target);
@@ -387,6 +453,7 @@ public:
 private:
     QPODVector<ListElement *, 4> elements;
     ListLayout *m_layout;
+    ListColumns m_columns;
 
     QQmlListModel *m_modelCache;
 
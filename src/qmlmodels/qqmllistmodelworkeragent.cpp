@@ -81,6 +81,16 @@ void QQmlListModelWorkerAgent::append(QQmlV4FunctionPtr args)
     m_copy->append(args);
 }
 
+void QQmlListModelWorkerAgent::appendColumns(QQmlV4FunctionPtr args)
+{
+    m_copy->appendColumns(args);
+}
+
+void QQmlListModelWorkerAgent::appendFromJson(const QString &json)
+{
+    m_copy->appendFromJson(json);
+}
+
 void QQmlListModelWorkerAgent::insert(QQmlV4FunctionPtr args)
 {
     m_copy->insert(args);
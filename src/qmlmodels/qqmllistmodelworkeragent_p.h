@@ -54,6 +54,8 @@ public:
     Q_INVOKABLE void clear();
     Q_INVOKABLE void remove(QQmlV4FunctionPtr args);
     Q_INVOKABLE void append(QQmlV4FunctionPtr args);
+    Q_INVOKABLE void appendColumns(QQmlV4FunctionPtr args);
+    Q_INVOKABLE void appendFromJson(const QString &json);
     Q_INVOKABLE void insert(QQmlV4FunctionPtr args);
     Q_INVOKABLE QJSValue get(int index) const;
     Q_INVOKABLE void set(int index, const QJSValue &value);
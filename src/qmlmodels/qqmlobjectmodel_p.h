@@ -57,6 +57,8 @@ public:
 
     virtual void drainReusableItemsPool(int maxPoolTime) { Q_UNUSED(maxPoolTime); }
     virtual int poolSize() { return 0; }
+    virtual bool sharesPooledItems() const { return false; }
+    virtual void deliverCoalescedChanges() {}
 
     virtual int indexOf(QObject *object, QObject *objectContext) const = 0;
     virtual const QAbstractItemModel *abstractItemModel() const { return nullptr; }
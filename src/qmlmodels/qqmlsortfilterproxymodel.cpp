@@ -0,0 +1,907 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qqmlsortfilterproxymodel_p.h"
+
+#include <QtQml/qjsengine.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthreadpool.h>
+
+#include <algorithm>
+#include <atomic>
+
+QT_BEGIN_NAMESPACE
+
+// Sources with fewer rows are always sorted on the calling thread
+static constexpr qsizetype ParallelSortThreshold = 65536;
+
+// Changes that would insert or remove more separate ranges of proxy rows are
+// turned into a model reset, since each range costs a pass over the mapping.
+static constexpr qsizetype MaxIncrementalRanges = 64;
+
+/*!
+    \qmltype SortFilterProxyModel
+//!    \nativetype QQmlSortFilterProxyModel
+    \inqmlmodule QtQml.Models
+    \since 6.10
+    \brief Sorts and filters the rows of another model.
+
+    SortFilterProxyModel exposes the rows of \l model that are accepted by all
+    its \l filters, in the order defined by its \l sorters.
+
+    \qml
+    import QtQuick
+    import QtQml.Models
+
+    ListView {
+        width: 200; height: 400
+
+        model: SortFilterProxyModel {
+            model: ListModel {
+                ListElement { name: "Ada"; age: 36 }
+                ListElement { name: "Grace"; age: 85 }
+                ListElement { name: "Linus"; age: 12 }
+            }
+            filters: ValueFilter { roleName: "age"; value: 12; invert: true }
+            sorters: RoleSorter { roleName: "name"; sortOrder: Qt.DescendingOrder }
+        }
+        delegate: Text { text: name }
+    }
+    \endqml
+
+    The sorted and filtered mapping is maintained incrementally. Rows inserted
+    into, or removed from, the source model are inserted into, or removed from,
+    the proxy at their sorted position, and a change of data only re-evaluates
+    the filters and sorters that depend on the changed roles. A view therefore
+    only sees the rows that were actually affected, instead of a reset of the
+    whole model.
+
+    When all the sorters are \l{RoleSorter}s, their keys are cached and large
+    models are sorted in parallel on the global thread pool.
+
+    Only the top-level rows of tree models are exposed.
+
+    \sa Filter, Sorter, DelegateModel
+*/
+QQmlSortFilterProxyModel::QQmlSortFilterProxyModel(QObject *parent)
+    : QAbstractProxyModel(parent)
+{
+    connect(this, &QAbstractItemModel::rowsInserted, this, &QQmlSortFilterProxyModel::countChanged);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &QQmlSortFilterProxyModel::countChanged);
+    connect(this, &QAbstractItemModel::modelReset, this, &QQmlSortFilterProxyModel::countChanged);
+}
+
+/*!
+    \qmlproperty model QtQml.Models::SortFilterProxyModel::model
+    This property holds the source model whose rows are sorted and filtered.
+
+    Any QAbstractItemModel, including \l ListModel, can be used.
+*/
+void QQmlSortFilterProxyModel::setSourceModel(QAbstractItemModel *model)
+{
+    if (model == sourceModel())
+        return;
+
+    beginResetModel();
+
+    for (const QMetaObject::Connection &connection : std::as_const(m_sourceConnections))
+        disconnect(connection);
+    m_sourceConnections.clear();
+
+    QAbstractProxyModel::setSourceModel(model);
+    m_roleIds.clear();
+
+    if (model) {
+        m_sourceConnections = {
+            connect(model, &QAbstractItemModel::rowsInserted,
+                    this, &QQmlSortFilterProxyModel::sourceRowsInserted),
+            connect(model, &QAbstractItemModel::rowsAboutToBeRemoved,
+                    this, &QQmlSortFilterProxyModel::sourceRowsAboutToBeRemoved),
+            connect(model, &QAbstractItemModel::rowsRemoved,
+                    this, &QQmlSortFilterProxyModel::sourceRowsRemoved),
+            connect(model, &QAbstractItemModel::dataChanged,
+                    this, &QQmlSortFilterProxyModel::sourceDataChanged),
+            connect(model, &QAbstractItemModel::modelAboutToBeReset,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::modelReset,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+
+            // Moves and layout changes renumber the source rows, which
+            // invalidates the whole mapping.
+            connect(model, &QAbstractItemModel::rowsAboutToBeMoved,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::rowsMoved,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+            connect(model, &QAbstractItemModel::layoutAboutToBeChanged,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::layoutChanged,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+            connect(model, &QAbstractItemModel::columnsAboutToBeInserted,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::columnsInserted,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+            connect(model, &QAbstractItemModel::columnsAboutToBeRemoved,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::columnsRemoved,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+            connect(model, &QAbstractItemModel::columnsAboutToBeMoved,
+                    this, &QQmlSortFilterProxyModel::sourceAboutToBeReset),
+            connect(model, &QAbstractItemModel::columnsMoved,
+                    this, &QQmlSortFilterProxyModel::sourceReset),
+            connect(model, &QObject::destroyed, this, [this] {
+                beginResetModel();
+                m_sourceConnections.clear();
+                m_roleIds.clear();
+                m_proxyToSource.clear();
+                m_sourceToProxy.clear();
+                m_sortKeys.clear();
+                endResetModel();
+            })
+        };
+    }
+
+    rebuildMapping();
+    endResetModel();
+    emit modelChanged();
+}
+
+/*!
+    \qmlproperty list<Filter> QtQml.Models::SortFilterProxyModel::filters
+
+    This property holds the filters a row of the source model must all accept
+    to be part of the proxy model.
+*/
+QQmlListProperty<QQmlFilterBase> QQmlSortFilterProxyModel::filters()
+{
+    return QQmlListProperty<QQmlFilterBase>(this, nullptr,
+                                            QQmlSortFilterProxyModel::filters_append,
+                                            QQmlSortFilterProxyModel::filters_count,
+                                            QQmlSortFilterProxyModel::filters_at,
+                                            QQmlSortFilterProxyModel::filters_clear,
+                                            QQmlSortFilterProxyModel::filters_replace,
+                                            QQmlSortFilterProxyModel::filters_removeLast);
+}
+
+void QQmlSortFilterProxyModel::filters_append(QQmlListProperty<QQmlFilterBase> *prop, QQmlFilterBase *filter)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    q->m_filters.append(filter);
+    connect(filter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateFilter);
+    q->invalidateFilter();
+}
+
+qsizetype QQmlSortFilterProxyModel::filters_count(QQmlListProperty<QQmlFilterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    return q->m_filters.size();
+}
+
+QQmlFilterBase *QQmlSortFilterProxyModel::filters_at(QQmlListProperty<QQmlFilterBase> *prop, qsizetype index)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    return q->m_filters.at(index);
+}
+
+void QQmlSortFilterProxyModel::filters_clear(QQmlListProperty<QQmlFilterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    for (QQmlFilterBase *filter : std::as_const(q->m_filters))
+        disconnect(filter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateFilter);
+    q->m_filters.clear();
+    q->invalidateFilter();
+}
+
+void QQmlSortFilterProxyModel::filters_replace(QQmlListProperty<QQmlFilterBase> *prop,
+                                               qsizetype index, QQmlFilterBase *filter)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    disconnect(q->m_filters[index], &QQmlSortFilterRule::changed,
+               q, &QQmlSortFilterProxyModel::invalidateFilter);
+    q->m_filters[index] = filter;
+    connect(filter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateFilter);
+    q->invalidateFilter();
+}
+
+void QQmlSortFilterProxyModel::filters_removeLast(QQmlListProperty<QQmlFilterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    disconnect(q->m_filters.takeLast(), &QQmlSortFilterRule::changed,
+               q, &QQmlSortFilterProxyModel::invalidateFilter);
+    q->invalidateFilter();
+}
+
+/*!
+    \qmlproperty list<Sorter> QtQml.Models::SortFilterProxyModel::sorters
+
+    This property holds the sorters defining the order of the rows. The first
+    enabled sorter has the highest priority, and rows that compare equal for
+    all sorters keep the order of the source model.
+*/
+QQmlListProperty<QQmlSorterBase> QQmlSortFilterProxyModel::sorters()
+{
+    return QQmlListProperty<QQmlSorterBase>(this, nullptr,
+                                            QQmlSortFilterProxyModel::sorters_append,
+                                            QQmlSortFilterProxyModel::sorters_count,
+                                            QQmlSortFilterProxyModel::sorters_at,
+                                            QQmlSortFilterProxyModel::sorters_clear,
+                                            QQmlSortFilterProxyModel::sorters_replace,
+                                            QQmlSortFilterProxyModel::sorters_removeLast);
+}
+
+void QQmlSortFilterProxyModel::sorters_append(QQmlListProperty<QQmlSorterBase> *prop, QQmlSorterBase *sorter)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    q->m_sorters.append(sorter);
+    connect(sorter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateSort);
+    q->invalidateSort();
+}
+
+qsizetype QQmlSortFilterProxyModel::sorters_count(QQmlListProperty<QQmlSorterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    return q->m_sorters.size();
+}
+
+QQmlSorterBase *QQmlSortFilterProxyModel::sorters_at(QQmlListProperty<QQmlSorterBase> *prop, qsizetype index)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    return q->m_sorters.at(index);
+}
+
+void QQmlSortFilterProxyModel::sorters_clear(QQmlListProperty<QQmlSorterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    for (QQmlSorterBase *sorter : std::as_const(q->m_sorters))
+        disconnect(sorter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateSort);
+    q->m_sorters.clear();
+    q->invalidateSort();
+}
+
+void QQmlSortFilterProxyModel::sorters_replace(QQmlListProperty<QQmlSorterBase> *prop,
+                                               qsizetype index, QQmlSorterBase *sorter)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    disconnect(q->m_sorters[index], &QQmlSortFilterRule::changed,
+               q, &QQmlSortFilterProxyModel::invalidateSort);
+    q->m_sorters[index] = sorter;
+    connect(sorter, &QQmlSortFilterRule::changed, q, &QQmlSortFilterProxyModel::invalidateSort);
+    q->invalidateSort();
+}
+
+void QQmlSortFilterProxyModel::sorters_removeLast(QQmlListProperty<QQmlSorterBase> *prop)
+{
+    QQmlSortFilterProxyModel *q = static_cast<QQmlSortFilterProxyModel *>(prop->object);
+    disconnect(q->m_sorters.takeLast(), &QQmlSortFilterRule::changed,
+               q, &QQmlSortFilterProxyModel::invalidateSort);
+    q->invalidateSort();
+}
+
+/*!
+    \qmlproperty int QtQml.Models::SortFilterProxyModel::count
+    This property holds the number of rows accepted by the filters.
+*/
+
+/*!
+    \qmlmethod QtQml.Models::SortFilterProxyModel::invalidate()
+
+    Re-evaluates all filters and sorters for all rows, and resets the model.
+
+    This is only needed when a \l FunctionFilter or \l FunctionSorter depends
+    on something other than the data of the row it is called with.
+*/
+void QQmlSortFilterProxyModel::invalidate()
+{
+    beginResetModel();
+    updateActiveFilters();
+    updateActiveSorters();
+    rebuildMapping();
+    endResetModel();
+}
+
+QModelIndex QQmlSortFilterProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || row >= m_proxyToSource.size()
+            || column < 0 || column >= columnCount()) {
+        return QModelIndex();
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex QQmlSortFilterProxyModel::parent(const QModelIndex &child) const
+{
+    Q_UNUSED(child);
+    return QModelIndex();
+}
+
+QModelIndex QQmlSortFilterProxyModel::sibling(int row, int column, const QModelIndex &idx) const
+{
+    return idx.isValid() ? index(row, column) : QModelIndex();
+}
+
+int QQmlSortFilterProxyModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(m_proxyToSource.size());
+}
+
+int QQmlSortFilterProxyModel::columnCount(const QModelIndex &parent) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    return (parent.isValid() || !source) ? 0 : source->columnCount();
+}
+
+bool QQmlSortFilterProxyModel::hasChildren(const QModelIndex &parent) const
+{
+    return !parent.isValid() && !m_proxyToSource.isEmpty();
+}
+
+QModelIndex QQmlSortFilterProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    if (!source || !proxyIndex.isValid() || proxyIndex.row() >= m_proxyToSource.size())
+        return QModelIndex();
+    return source->index(m_proxyToSource.at(proxyIndex.row()), proxyIndex.column());
+}
+
+QModelIndex QQmlSortFilterProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid() || sourceIndex.parent().isValid())
+        return QModelIndex();
+    const int proxyRow = m_sourceToProxy.value(sourceIndex.row(), -1);
+    if (proxyRow < 0)
+        return QModelIndex();
+    return createIndex(proxyRow, sourceIndex.column());
+}
+
+QVariant QQmlSortFilterProxyModel::sourceData(int sourceRow, const QString &roleName) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    const int role = roleId(roleName);
+    if (!source || role < 0)
+        return QVariant();
+    return source->data(source->index(sourceRow, 0), role);
+}
+
+QJSValue QQmlSortFilterProxyModel::rowData(int sourceRow) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    QJSEngine *engine = qjsEngine(this);
+    if (!source || !engine)
+        return QJSValue();
+
+    const QModelIndex index = source->index(sourceRow, 0);
+    QJSValue row = engine->newObject();
+    const QHash<int, QByteArray> roles = source->roleNames();
+    for (auto it = roles.cbegin(), end = roles.cend(); it != end; ++it)
+        row.setProperty(QString::fromUtf8(it.value()), engine->toScriptValue(source->data(index, it.key())));
+    row.setProperty(QStringLiteral("index"), sourceRow);
+    return row;
+}
+
+void QQmlSortFilterProxyModel::classBegin()
+{
+    m_complete = false;
+}
+
+void QQmlSortFilterProxyModel::componentComplete()
+{
+    m_complete = true;
+    invalidate();
+}
+
+void QQmlSortFilterProxyModel::invalidateFilter()
+{
+    updateActiveFilters();
+    if (isActive())
+        refilter();
+}
+
+void QQmlSortFilterProxyModel::invalidateSort()
+{
+    updateActiveSorters();
+    if (isActive()) {
+        rebuildSortKeys();
+        resort();
+    }
+}
+
+void QQmlSortFilterProxyModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !m_complete)
+        return;
+
+    const int count = last - first + 1;
+    for (int &sourceRow : m_proxyToSource) {
+        if (sourceRow >= first)
+            sourceRow += count;
+    }
+    m_sourceToProxy.insert(first, count, -1);
+    m_sortKeys.insert(first * m_sortKeyCount, count * m_sortKeyCount, QVariant());
+    updateSortKeys(first, last);
+
+    // The rows after the inserted ones only moved in the source model, and
+    // keep their proxy row.
+    for (qsizetype i = 0; i < m_proxyToSource.size(); ++i)
+        m_sourceToProxy[m_proxyToSource.at(i)] = int(i);
+
+    QList<int> accepted;
+    for (int row = first; row <= last; ++row) {
+        if (filterAccepts(row))
+            accepted.append(row);
+    }
+    sortRows(accepted);
+    insertSourceRows(accepted);
+}
+
+void QQmlSortFilterProxyModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !m_complete)
+        return;
+
+    QList<int> proxyRows;
+    for (int row = first; row <= last; ++row) {
+        const int proxyRow = m_sourceToProxy.at(row);
+        if (proxyRow >= 0)
+            proxyRows.append(proxyRow);
+    }
+    std::sort(proxyRows.begin(), proxyRows.end());
+    removeProxyRows(proxyRows);
+}
+
+void QQmlSortFilterProxyModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !m_complete)
+        return;
+
+    const int count = last - first + 1;
+    m_sourceToProxy.remove(first, count);
+    m_sortKeys.remove(first * m_sortKeyCount, count * m_sortKeyCount);
+    for (int &sourceRow : m_proxyToSource) {
+        if (sourceRow > last)
+            sourceRow -= count;
+    }
+}
+
+void QQmlSortFilterProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                                                 const QList<int> &roles)
+{
+    if (!topLeft.isValid() || topLeft.parent().isValid() || !m_complete)
+        return;
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+    const bool affectsFilter = rulesDependOnRoles(m_activeFilters, roles);
+    const bool affectsSort = rulesDependOnRoles(m_activeSorters, roles);
+    if (affectsSort)
+        updateSortKeys(first, last);
+
+    QList<int> removed;
+    QList<int> inserted;
+    QList<int> changed;
+    for (int row = first; row <= last; ++row) {
+        const int proxyRow = m_sourceToProxy.at(row);
+        const bool accepted = affectsFilter ? filterAccepts(row) : proxyRow >= 0;
+        if (proxyRow >= 0 && !accepted)
+            removed.append(proxyRow);
+        else if (proxyRow < 0 && accepted)
+            inserted.append(row);
+        else if (proxyRow >= 0)
+            changed.append(row);
+    }
+
+    std::sort(removed.begin(), removed.end());
+    removeProxyRows(removed);
+
+    if (affectsSort && !changed.isEmpty()) {
+        if (changed.size() == 1)
+            moveProxyRow(m_sourceToProxy.at(changed.first()));
+        else
+            resort(changed);
+    }
+
+    sortRows(inserted);
+    insertSourceRows(inserted);
+
+    QList<int> proxyRows;
+    proxyRows.reserve(changed.size());
+    for (int row : std::as_const(changed))
+        proxyRows.append(m_sourceToProxy.at(row));
+    std::sort(proxyRows.begin(), proxyRows.end());
+    for (qsizetype i = 0; i < proxyRows.size();) {
+        qsizetype j = i + 1;
+        while (j < proxyRows.size() && proxyRows.at(j) == proxyRows.at(j - 1) + 1)
+            ++j;
+        emit dataChanged(index(proxyRows.at(i), topLeft.column()),
+                         index(proxyRows.at(j - 1), bottomRight.column()), roles);
+        i = j;
+    }
+}
+
+void QQmlSortFilterProxyModel::sourceAboutToBeReset()
+{
+    beginResetModel();
+}
+
+void QQmlSortFilterProxyModel::sourceReset()
+{
+    m_roleIds.clear();
+    rebuildMapping();
+    endResetModel();
+}
+
+bool QQmlSortFilterProxyModel::isActive() const
+{
+    return m_complete && sourceModel();
+}
+
+int QQmlSortFilterProxyModel::roleId(const QString &roleName) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    if (!source)
+        return -1;
+    if (m_roleIds.isEmpty()) {
+        const QHash<int, QByteArray> roles = source->roleNames();
+        for (auto it = roles.cbegin(), end = roles.cend(); it != end; ++it)
+            m_roleIds.insert(QString::fromUtf8(it.value()), it.key());
+    }
+    return m_roleIds.value(roleName, -1);
+}
+
+bool QQmlSortFilterProxyModel::filterAccepts(int sourceRow) const
+{
+    for (const QQmlFilterBase *filter : m_activeFilters) {
+        if (!filter->accepts(this, sourceRow))
+            return false;
+    }
+    return true;
+}
+
+int QQmlSortFilterProxyModel::compareSourceRows(int lhs, int rhs) const
+{
+    for (qsizetype i = 0; i < m_activeSorters.size(); ++i) {
+        const QQmlSorterBase *sorter = m_activeSorters.at(i);
+        const int keyIndex = m_sortKeyIndex.at(i);
+        int result = keyIndex >= 0
+                ? QQmlSorterBase::compareValues(m_sortKeys.at(lhs * m_sortKeyCount + keyIndex),
+                                                m_sortKeys.at(rhs * m_sortKeyCount + keyIndex))
+                : sorter->compareRows(this, lhs, rhs);
+        if (sorter->sortOrder() == Qt::DescendingOrder)
+            result = -result;
+        if (result != 0)
+            return result;
+    }
+
+    // Keeping the source order for equal rows makes the order total, so that
+    // incremental updates end up with the same order as a full sort.
+    return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+bool QQmlSortFilterProxyModel::canSortInParallel() const
+{
+    // Comparing cached keys only reads immutable data, whereas other sorters
+    // may call into JavaScript.
+    return m_sortKeyCount == m_activeSorters.size();
+}
+
+template <typename Rule>
+bool QQmlSortFilterProxyModel::rulesDependOnRoles(const QList<Rule *> &rules, const QList<int> &roles) const
+{
+    if (rules.isEmpty())
+        return false;
+    if (roles.isEmpty())
+        return true;
+    for (const Rule *rule : rules) {
+        const QStringList roleNames = rule->roleNames();
+        if (roleNames.isEmpty())
+            return true;
+        for (const QString &roleName : roleNames) {
+            if (roles.contains(roleId(roleName)))
+                return true;
+        }
+    }
+    return false;
+}
+
+void QQmlSortFilterProxyModel::updateActiveFilters()
+{
+    m_activeFilters.clear();
+    for (QQmlFilterBase *filter : std::as_const(m_filters)) {
+        if (filter && filter->isEnabled())
+            m_activeFilters.append(filter);
+    }
+}
+
+void QQmlSortFilterProxyModel::updateActiveSorters()
+{
+    m_activeSorters.clear();
+    m_sortKeyIndex.clear();
+    m_sortKeyCount = 0;
+    for (QQmlSorterBase *sorter : std::as_const(m_sorters)) {
+        if (!sorter || !sorter->isEnabled())
+            continue;
+        m_activeSorters.append(sorter);
+        m_sortKeyIndex.append(sorter->hasSortKey() ? int(m_sortKeyCount++) : -1);
+    }
+    m_sortKeys.clear();
+}
+
+void QQmlSortFilterProxyModel::updateSortKeys(int first, int last)
+{
+    if (m_sortKeyCount == 0)
+        return;
+    for (int row = first; row <= last; ++row) {
+        for (qsizetype i = 0; i < m_activeSorters.size(); ++i) {
+            const int keyIndex = m_sortKeyIndex.at(i);
+            if (keyIndex >= 0)
+                m_sortKeys[row * m_sortKeyCount + keyIndex] = m_activeSorters.at(i)->sortKey(this, row);
+        }
+    }
+}
+
+void QQmlSortFilterProxyModel::rebuildSortKeys()
+{
+    const QAbstractItemModel *source = sourceModel();
+    const int rows = source ? source->rowCount() : 0;
+    m_sortKeys.clear();
+    m_sortKeys.resize(rows * m_sortKeyCount);
+    updateSortKeys(0, rows - 1);
+}
+
+void QQmlSortFilterProxyModel::rebuildMapping()
+{
+    m_proxyToSource.clear();
+    m_sourceToProxy.clear();
+    m_sortKeys.clear();
+    if (!isActive())
+        return;
+
+    rebuildSortKeys();
+    const int rows = sourceModel()->rowCount();
+    m_sourceToProxy.fill(-1, rows);
+    m_proxyToSource.reserve(rows);
+    for (int row = 0; row < rows; ++row) {
+        if (filterAccepts(row))
+            m_proxyToSource.append(row);
+    }
+    sortRows(m_proxyToSource);
+    updateSourceToProxy(0);
+}
+
+void QQmlSortFilterProxyModel::updateSourceToProxy(qsizetype from)
+{
+    for (qsizetype i = from; i < m_proxyToSource.size(); ++i)
+        m_sourceToProxy[m_proxyToSource.at(i)] = int(i);
+}
+
+void QQmlSortFilterProxyModel::sortRows(QList<int> &sourceRows) const
+{
+    if (sourceRows.size() < 2)
+        return;
+    if (m_activeSorters.isEmpty()) {
+        std::sort(sourceRows.begin(), sourceRows.end());
+        return;
+    }
+
+    const auto less = [this](int lhs, int rhs) { return lessThan(lhs, rhs); };
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int threads = pool->maxThreadCount();
+    if (sourceRows.size() < ParallelSortThreshold || threads < 2 || !canSortInParallel()) {
+        std::sort(sourceRows.begin(), sourceRows.end(), less);
+        return;
+    }
+
+    // Sort one chunk per thread, then merge neighbouring chunks in parallel
+    // until a single one is left. The calling thread takes part in the work
+    // rather than just waiting for it.
+    const qsizetype size = sourceRows.size();
+    const int chunks = int(qMin<qsizetype>(threads, size / (ParallelSortThreshold / 4)));
+    QList<qsizetype> bounds;
+    for (int i = 0; i <= chunks; ++i)
+        bounds.append(size * i / chunks);
+
+    int *rows = sourceRows.data();
+    const auto runParallel = [pool](int count, const auto &work) {
+        std::atomic<int> next = 0;
+        QSemaphore done;
+        const auto worker = [&work, &next, &done, count] {
+            for (int i = next++; i < count; i = next++)
+                work(i);
+            done.release();
+        };
+
+        // Only take threads that are free right away; the calling thread does
+        // the chunks that no other thread picks up
+        int started = 0;
+        while (started < count - 1 && pool->tryStart(worker))
+            ++started;
+        worker();
+        done.acquire(started + 1);
+    };
+
+    runParallel(chunks, [&](int i) {
+        std::sort(rows + bounds.at(i), rows + bounds.at(i + 1), less);
+    });
+
+    for (int width = 1; width < chunks; width *= 2) {
+        const int merges = (chunks + 2 * width - 1) / (2 * width);
+        runParallel(merges, [&](int i) {
+            const int begin = 2 * width * i;
+            const int middle = qMin(begin + width, chunks);
+            const int end = qMin(begin + 2 * width, chunks);
+            if (middle < end) {
+                std::inplace_merge(rows + bounds.at(begin), rows + bounds.at(middle),
+                                   rows + bounds.at(end), less);
+            }
+        });
+    }
+}
+
+void QQmlSortFilterProxyModel::insertSourceRows(const QList<int> &sortedSourceRows)
+{
+    if (sortedSourceRows.isEmpty())
+        return;
+
+    // Find the position of each run of new rows that end up next to each other
+    struct Run { qsizetype position; qsizetype first; qsizetype count; };
+    QList<Run> runs;
+    auto position = m_proxyToSource.cbegin();
+    for (qsizetype i = 0; i < sortedSourceRows.size(); ++i) {
+        const int row = sortedSourceRows.at(i);
+        position = std::lower_bound(position, m_proxyToSource.cend(), row,
+                                    [this](int lhs, int rhs) { return lessThan(lhs, rhs); });
+        const qsizetype at = position - m_proxyToSource.cbegin();
+        if (!runs.isEmpty() && runs.last().position == at)
+            ++runs.last().count;
+        else
+            runs.append({ at, i, 1 });
+    }
+
+    if (runs.size() > MaxIncrementalRanges) {
+        beginResetModel();
+        QList<int> merged(m_proxyToSource.size() + sortedSourceRows.size());
+        std::merge(m_proxyToSource.cbegin(), m_proxyToSource.cend(),
+                   sortedSourceRows.cbegin(), sortedSourceRows.cend(), merged.begin(),
+                   [this](int lhs, int rhs) { return lessThan(lhs, rhs); });
+        m_proxyToSource = std::move(merged);
+        updateSourceToProxy(0);
+        endResetModel();
+        return;
+    }
+
+    qsizetype offset = 0;
+    for (const Run &run : std::as_const(runs)) {
+        const qsizetype at = run.position + offset;
+        beginInsertRows(QModelIndex(), int(at), int(at + run.count - 1));
+        m_proxyToSource.insert(at, run.count, 0);
+        std::copy_n(sortedSourceRows.cbegin() + run.first, run.count, m_proxyToSource.begin() + at);
+        updateSourceToProxy(at);
+        endInsertRows();
+        offset += run.count;
+    }
+}
+
+void QQmlSortFilterProxyModel::removeProxyRows(const QList<int> &proxyRows)
+{
+    if (proxyRows.isEmpty())
+        return;
+
+    QList<std::pair<int, int>> ranges;
+    for (int proxyRow : proxyRows) {
+        if (!ranges.isEmpty() && ranges.last().second == proxyRow - 1)
+            ranges.last().second = proxyRow;
+        else
+            ranges.append({ proxyRow, proxyRow });
+    }
+
+    for (int proxyRow : proxyRows)
+        m_sourceToProxy[m_proxyToSource.at(proxyRow)] = -1;
+
+    if (ranges.size() > MaxIncrementalRanges) {
+        beginResetModel();
+        qsizetype next = 0;
+        for (int proxyRow : proxyRows)
+            m_proxyToSource[proxyRow] = -1;
+        for (int sourceRow : std::as_const(m_proxyToSource)) {
+            if (sourceRow >= 0)
+                m_proxyToSource[next++] = sourceRow;
+        }
+        m_proxyToSource.resize(next);
+        updateSourceToProxy(0);
+        endResetModel();
+        return;
+    }
+
+    // Remove from the end, so that the remaining ranges stay valid
+    for (auto it = ranges.crbegin(), end = ranges.crend(); it != end; ++it) {
+        beginRemoveRows(QModelIndex(), it->first, it->second);
+        m_proxyToSource.remove(it->first, it->second - it->first + 1);
+        updateSourceToProxy(it->first);
+        endRemoveRows();
+    }
+}
+
+void QQmlSortFilterProxyModel::moveProxyRow(int proxyRow)
+{
+    const int row = m_proxyToSource.at(proxyRow);
+    const auto less = [this](int lhs, int rhs) { return lessThan(lhs, rhs); };
+    const auto begin = m_proxyToSource.begin();
+
+    if (proxyRow > 0 && lessThan(row, m_proxyToSource.at(proxyRow - 1))) {
+        const int to = int(std::lower_bound(begin, begin + proxyRow, row, less) - begin);
+        beginMoveRows(QModelIndex(), proxyRow, proxyRow, QModelIndex(), to);
+        std::rotate(begin + to, begin + proxyRow, begin + proxyRow + 1);
+        for (int i = to; i <= proxyRow; ++i)
+            m_sourceToProxy[m_proxyToSource.at(i)] = i;
+        endMoveRows();
+    } else if (proxyRow + 1 < m_proxyToSource.size() && lessThan(m_proxyToSource.at(proxyRow + 1), row)) {
+        const int to = int(std::lower_bound(begin + proxyRow + 1, m_proxyToSource.end(), row, less) - begin);
+        beginMoveRows(QModelIndex(), proxyRow, proxyRow, QModelIndex(), to);
+        std::rotate(begin + proxyRow, begin + proxyRow + 1, begin + to);
+        for (int i = proxyRow; i < to; ++i)
+            m_sourceToProxy[m_proxyToSource.at(i)] = i;
+        endMoveRows();
+    }
+}
+
+void QQmlSortFilterProxyModel::resort(const QList<int> &changedSourceRows)
+{
+    const auto less = [this](int lhs, int rhs) { return lessThan(lhs, rhs); };
+    if (std::is_sorted(m_proxyToSource.cbegin(), m_proxyToSource.cend(), less))
+        return;
+
+    emit layoutAboutToBeChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+
+    const QModelIndexList oldIndexes = persistentIndexList();
+    QList<int> persistentSourceRows;
+    persistentSourceRows.reserve(oldIndexes.size());
+    for (const QModelIndex &index : oldIndexes)
+        persistentSourceRows.append(m_proxyToSource.at(index.row()));
+
+    if (changedSourceRows.isEmpty()) {
+        sortRows(m_proxyToSource);
+    } else {
+        // The rows whose data did not change are still sorted relative to each
+        // other, so only the changed rows need sorting before merging both.
+        QList<int> changed;
+        QList<int> unchanged;
+        unchanged.reserve(m_proxyToSource.size());
+        for (int row : std::as_const(changedSourceRows))
+            m_sourceToProxy[row] = -1;
+        for (int row : std::as_const(m_proxyToSource))
+            (m_sourceToProxy.at(row) < 0 ? changed : unchanged).append(row);
+        sortRows(changed);
+        std::merge(unchanged.cbegin(), unchanged.cend(), changed.cbegin(), changed.cend(),
+                   m_proxyToSource.begin(), less);
+    }
+    updateSourceToProxy(0);
+
+    QModelIndexList newIndexes;
+    newIndexes.reserve(oldIndexes.size());
+    for (qsizetype i = 0; i < oldIndexes.size(); ++i)
+        newIndexes.append(index(m_sourceToProxy.at(persistentSourceRows.at(i)), oldIndexes.at(i).column()));
+    changePersistentIndexList(oldIndexes, newIndexes);
+
+    emit layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+}
+
+void QQmlSortFilterProxyModel::refilter()
+{
+    QList<int> removed;
+    for (qsizetype i = 0; i < m_proxyToSource.size(); ++i) {
+        if (!filterAccepts(m_proxyToSource.at(i)))
+            removed.append(int(i));
+    }
+
+    QList<int> inserted;
+    for (qsizetype row = 0; row < m_sourceToProxy.size(); ++row) {
+        if (m_sourceToProxy.at(row) < 0 && filterAccepts(int(row)))
+            inserted.append(int(row));
+    }
+
+    removeProxyRows(removed);
+    sortRows(inserted);
+    insertSourceRows(inserted);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qqmlsortfilterproxymodel_p.cpp"
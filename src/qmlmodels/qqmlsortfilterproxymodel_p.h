@@ -0,0 +1,145 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQMLSORTFILTERPROXYMODEL_P_H
+#define QQMLSORTFILTERPROXYMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQmlModels/private/qtqmlmodelsglobal_p.h>
+#include <QtQmlModels/private/qqmlsortfilterrules_p.h>
+#include <QtQml/qqmllist.h>
+#include <QtQml/qqmlparserstatus.h>
+#include <QtCore/qabstractproxymodel.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+
+QT_REQUIRE_CONFIG(qml_itemmodel);
+QT_REQUIRE_CONFIG(proxymodel);
+
+QT_BEGIN_NAMESPACE
+
+class Q_QMLMODELS_EXPORT QQmlSortFilterProxyModel : public QAbstractProxyModel, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(QAbstractItemModel *model READ sourceModel WRITE setSourceModel NOTIFY modelChanged FINAL)
+    Q_PROPERTY(QQmlListProperty<QQmlFilterBase> filters READ filters CONSTANT FINAL)
+    Q_PROPERTY(QQmlListProperty<QQmlSorterBase> sorters READ sorters CONSTANT FINAL)
+    Q_PROPERTY(int count READ count NOTIFY countChanged FINAL)
+    QML_NAMED_ELEMENT(SortFilterProxyModel)
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlSortFilterProxyModel(QObject *parent = nullptr);
+
+    void setSourceModel(QAbstractItemModel *model) override;
+
+    QQmlListProperty<QQmlFilterBase> filters();
+    QQmlListProperty<QQmlSorterBase> sorters();
+
+    int count() const { return int(m_proxyToSource.size()); }
+
+    Q_INVOKABLE void invalidate();
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    QModelIndex sibling(int row, int column, const QModelIndex &idx) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const override;
+
+    // Accessors used by the filters and sorters
+    QVariant sourceData(int sourceRow, const QString &roleName) const;
+    QJSValue rowData(int sourceRow) const;
+
+    void classBegin() override;
+    void componentComplete() override;
+
+Q_SIGNALS:
+    void modelChanged();
+    void countChanged();
+
+private:
+    static void filters_append(QQmlListProperty<QQmlFilterBase> *, QQmlFilterBase *);
+    static qsizetype filters_count(QQmlListProperty<QQmlFilterBase> *);
+    static QQmlFilterBase *filters_at(QQmlListProperty<QQmlFilterBase> *, qsizetype);
+    static void filters_clear(QQmlListProperty<QQmlFilterBase> *);
+    static void filters_replace(QQmlListProperty<QQmlFilterBase> *, qsizetype, QQmlFilterBase *);
+    static void filters_removeLast(QQmlListProperty<QQmlFilterBase> *);
+
+    static void sorters_append(QQmlListProperty<QQmlSorterBase> *, QQmlSorterBase *);
+    static qsizetype sorters_count(QQmlListProperty<QQmlSorterBase> *);
+    static QQmlSorterBase *sorters_at(QQmlListProperty<QQmlSorterBase> *, qsizetype);
+    static void sorters_clear(QQmlListProperty<QQmlSorterBase> *);
+    static void sorters_replace(QQmlListProperty<QQmlSorterBase> *, qsizetype, QQmlSorterBase *);
+    static void sorters_removeLast(QQmlListProperty<QQmlSorterBase> *);
+
+    void invalidateFilter();
+    void invalidateSort();
+
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                           const QList<int> &roles);
+    void sourceAboutToBeReset();
+    void sourceReset();
+
+    bool isActive() const;
+    int roleId(const QString &roleName) const;
+    bool filterAccepts(int sourceRow) const;
+    int compareSourceRows(int lhs, int rhs) const;
+    bool lessThan(int lhs, int rhs) const { return compareSourceRows(lhs, rhs) < 0; }
+    bool canSortInParallel() const;
+    template <typename Rule>
+    bool rulesDependOnRoles(const QList<Rule *> &rules, const QList<int> &roles) const;
+
+    void updateActiveFilters();
+    void updateActiveSorters();
+    void updateSortKeys(int first, int last);
+    void rebuildSortKeys();
+    void rebuildMapping();
+    void updateSourceToProxy(qsizetype from);
+    void sortRows(QList<int> &sourceRows) const;
+
+    void insertSourceRows(const QList<int> &sortedSourceRows);
+    void removeProxyRows(const QList<int> &proxyRows);
+    void moveProxyRow(int proxyRow);
+    void resort(const QList<int> &changedSourceRows = QList<int>());
+    void refilter();
+
+    QList<QQmlFilterBase *> m_filters;
+    QList<QQmlSorterBase *> m_sorters;
+    QList<QQmlFilterBase *> m_activeFilters;
+    QList<QQmlSorterBase *> m_activeSorters;
+
+    // Index of the cached key of each active sorter, or -1 if it is not keyed.
+    // The keys are stored row by row, m_sortKeyCount per source row.
+    QList<int> m_sortKeyIndex;
+    qsizetype m_sortKeyCount = 0;
+    QList<QVariant> m_sortKeys;
+
+    QList<int> m_proxyToSource;
+    QList<int> m_sourceToProxy; // -1 for rows that are filtered out
+    mutable QHash<QString, int> m_roleIds;
+
+    QList<QMetaObject::Connection> m_sourceConnections;
+    bool m_complete = true;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQMLSORTFILTERPROXYMODEL_P_H
@@ -0,0 +1,355 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qqmlsortfilterrules_p.h"
+#include "qqmlsortfilterproxymodel_p.h"
+
+#include <QtQml/qqmlinfo.h>
+
+QT_BEGIN_NAMESPACE
+
+QQmlSortFilterRule::QQmlSortFilterRule(QObject *parent)
+    : QObject(parent)
+{
+}
+
+/*!
+    \qmlproperty bool QtQml.Models::Filter::enabled
+    \qmlproperty bool QtQml.Models::Sorter::enabled
+
+    This property holds whether the rule is applied by the
+    \l SortFilterProxyModel. The default value is \c true.
+*/
+void QQmlSortFilterRule::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    emit enabledChanged();
+    emit changed();
+}
+
+/*!
+    \qmltype Filter
+//!    \nativetype QQmlFilterBase
+    \inqmlmodule QtQml.Models
+    \since 6.10
+    \brief Abstract base type of the filters of a SortFilterProxyModel.
+
+    A row of the source model is part of a \l SortFilterProxyModel only if
+    it is accepted by all its enabled filters.
+
+    \sa ValueFilter, FunctionFilter
+*/
+QQmlFilterBase::QQmlFilterBase(QObject *parent)
+    : QQmlSortFilterRule(parent)
+{
+}
+
+/*!
+    \qmlproperty bool QtQml.Models::Filter::invert
+    This property holds whether the result of the filter is inverted, so that
+    it rejects the rows it would otherwise accept. The default value is \c false.
+*/
+void QQmlFilterBase::setInvert(bool invert)
+{
+    if (m_invert == invert)
+        return;
+    m_invert = invert;
+    emit invertChanged();
+    emit changed();
+}
+
+/*!
+    \qmltype ValueFilter
+//!    \nativetype QQmlValueFilter
+    \inqmlmodule QtQml.Models
+    \inherits Filter
+    \since 6.10
+    \brief Accepts the rows whose role data is equal to a value.
+
+    ValueFilter compares the data of \l roleName with \l value entirely in C++,
+    and only the rows whose data changed for that role are re-evaluated when the
+    source model changes.
+
+    \qml
+    SortFilterProxyModel {
+        model: contacts
+        filters: ValueFilter { roleName: "favorite"; value: true }
+    }
+    \endqml
+*/
+QQmlValueFilter::QQmlValueFilter(QObject *parent)
+    : QQmlFilterBase(parent)
+{
+}
+
+/*!
+    \qmlproperty string QtQml.Models::ValueFilter::roleName
+    This property holds the name of the role whose data is compared.
+*/
+void QQmlValueFilter::setRoleName(const QString &roleName)
+{
+    if (m_roleName == roleName)
+        return;
+    m_roleName = roleName;
+    emit roleNameChanged();
+    emit changed();
+}
+
+/*!
+    \qmlproperty variant QtQml.Models::ValueFilter::value
+    This property holds the value the role data must be equal to.
+*/
+void QQmlValueFilter::setValue(const QVariant &value)
+{
+    if (m_value == value)
+        return;
+    m_value = value;
+    emit valueChanged();
+    emit changed();
+}
+
+bool QQmlValueFilter::filterAcceptsRow(const QQmlSortFilterProxyModel *model, int sourceRow) const
+{
+    const QVariant data = model->sourceData(sourceRow, m_roleName);
+    if (data == m_value)
+        return true;
+
+    // Values coming from JavaScript are often of a different, but compatible type
+    bool dataOk = false;
+    bool valueOk = false;
+    const double dataNumber = data.toDouble(&dataOk);
+    const double valueNumber = m_value.toDouble(&valueOk);
+    if (dataOk && valueOk)
+        return dataNumber == valueNumber;
+    return data.toString() == m_value.toString();
+}
+
+/*!
+    \qmltype FunctionFilter
+//!    \nativetype QQmlFunctionFilter
+    \inqmlmodule QtQml.Models
+    \inherits Filter
+    \since 6.10
+    \brief Accepts the rows for which a function returns \c true.
+
+    The \l callback is called with an object holding the data of all the roles
+    of the row, as well as its \c index in the source model. Since the roles the
+    function depends on are not known, it is re-evaluated whenever any role of
+    the row changes.
+
+    Keep the function free of side effects and of dependencies other than its
+    argument, so that it can be compiled ahead of time by the QML script
+    compiler:
+
+    \qml
+    SortFilterProxyModel {
+        model: contacts
+        filters: FunctionFilter {
+            callback: function(row) { return row.age >= 18 }
+        }
+    }
+    \endqml
+*/
+QQmlFunctionFilter::QQmlFunctionFilter(QObject *parent)
+    : QQmlFilterBase(parent)
+{
+}
+
+/*!
+    \qmlproperty function QtQml.Models::FunctionFilter::callback
+    This property holds the function deciding whether a row is accepted.
+*/
+void QQmlFunctionFilter::setCallback(const QJSValue &callback)
+{
+    if (!callback.isCallable() && !callback.isUndefined()) {
+        qmlWarning(this) << "callback must be a function";
+        return;
+    }
+    m_callback = callback;
+    emit callbackChanged();
+    emit changed();
+}
+
+bool QQmlFunctionFilter::filterAcceptsRow(const QQmlSortFilterProxyModel *model, int sourceRow) const
+{
+    if (!m_callback.isCallable())
+        return true;
+    const QJSValue result = m_callback.call({ model->rowData(sourceRow) });
+    if (result.isError()) {
+        qmlWarning(this) << result.toString();
+        return true;
+    }
+    return result.toBool();
+}
+
+/*!
+    \qmltype Sorter
+//!    \nativetype QQmlSorterBase
+    \inqmlmodule QtQml.Models
+    \since 6.10
+    \brief Abstract base type of the sorters of a SortFilterProxyModel.
+
+    The rows of a \l SortFilterProxyModel are ordered by its first enabled
+    sorter, ties are broken by the next one, and so on. Rows that compare equal
+    for all sorters keep the order of the source model.
+
+    \sa RoleSorter, FunctionSorter
+*/
+QQmlSorterBase::QQmlSorterBase(QObject *parent)
+    : QQmlSortFilterRule(parent)
+{
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::Sorter::sortOrder
+    This property holds the order in which the rows are sorted.
+
+    \value Qt.AscendingOrder    Smaller values come first (the default).
+    \value Qt.DescendingOrder   Larger values come first.
+*/
+void QQmlSorterBase::setSortOrder(Qt::SortOrder order)
+{
+    if (m_sortOrder == order)
+        return;
+    m_sortOrder = order;
+    emit sortOrderChanged();
+    emit changed();
+}
+
+QVariant QQmlSorterBase::sortKey(const QQmlSortFilterProxyModel *model, int sourceRow) const
+{
+    Q_UNUSED(model);
+    Q_UNUSED(sourceRow);
+    return QVariant();
+}
+
+int QQmlSorterBase::compareRows(const QQmlSortFilterProxyModel *model, int lhsRow, int rhsRow) const
+{
+    return compareValues(sortKey(model, lhsRow), sortKey(model, rhsRow));
+}
+
+int QQmlSorterBase::compareValues(const QVariant &lhs, const QVariant &rhs)
+{
+    // Invalid values are sorted last
+    if (!lhs.isValid() || !rhs.isValid())
+        return int(!lhs.isValid()) - int(!rhs.isValid());
+
+    if (lhs.metaType().id() == QMetaType::QString && rhs.metaType().id() == QMetaType::QString)
+        return QString::compare(*static_cast<const QString *>(lhs.constData()),
+                                *static_cast<const QString *>(rhs.constData()));
+
+    const QPartialOrdering order = QVariant::compare(lhs, rhs);
+    if (order == QPartialOrdering::Less)
+        return -1;
+    if (order == QPartialOrdering::Greater)
+        return 1;
+    if (order == QPartialOrdering::Equivalent)
+        return 0;
+    return QString::compare(lhs.toString(), rhs.toString());
+}
+
+/*!
+    \qmltype RoleSorter
+//!    \nativetype QQmlRoleSorter
+    \inqmlmodule QtQml.Models
+    \inherits Sorter
+    \since 6.10
+    \brief Sorts the rows by the data of a role.
+
+    RoleSorter compares the data of \l roleName entirely in C++. The data is
+    cached by the \l SortFilterProxyModel, which allows large models to be
+    sorted in parallel when all the sorters are RoleSorters.
+
+    \qml
+    SortFilterProxyModel {
+        model: contacts
+        sorters: [
+            RoleSorter { roleName: "lastName" },
+            RoleSorter { roleName: "age"; sortOrder: Qt.DescendingOrder }
+        ]
+    }
+    \endqml
+*/
+QQmlRoleSorter::QQmlRoleSorter(QObject *parent)
+    : QQmlSorterBase(parent)
+{
+}
+
+/*!
+    \qmlproperty string QtQml.Models::RoleSorter::roleName
+    This property holds the name of the role whose data is compared.
+*/
+void QQmlRoleSorter::setRoleName(const QString &roleName)
+{
+    if (m_roleName == roleName)
+        return;
+    m_roleName = roleName;
+    emit roleNameChanged();
+    emit changed();
+}
+
+QVariant QQmlRoleSorter::sortKey(const QQmlSortFilterProxyModel *model, int sourceRow) const
+{
+    return model->sourceData(sourceRow, m_roleName);
+}
+
+/*!
+    \qmltype FunctionSorter
+//!    \nativetype QQmlFunctionSorter
+    \inqmlmodule QtQml.Models
+    \inherits Sorter
+    \since 6.10
+    \brief Sorts the rows with a comparison function.
+
+    The \l callback is called with two objects holding the data of the rows to
+    compare, and returns a negative number, zero, or a positive number if the
+    first row is respectively less than, equal to, or greater than the second
+    one.
+
+    \qml
+    SortFilterProxyModel {
+        model: contacts
+        sorters: FunctionSorter {
+            callback: function(lhs, rhs) { return lhs.name.length - rhs.name.length }
+        }
+    }
+    \endqml
+*/
+QQmlFunctionSorter::QQmlFunctionSorter(QObject *parent)
+    : QQmlSorterBase(parent)
+{
+}
+
+/*!
+    \qmlproperty function QtQml.Models::FunctionSorter::callback
+    This property holds the function comparing two rows.
+*/
+void QQmlFunctionSorter::setCallback(const QJSValue &callback)
+{
+    if (!callback.isCallable() && !callback.isUndefined()) {
+        qmlWarning(this) << "callback must be a function";
+        return;
+    }
+    m_callback = callback;
+    emit callbackChanged();
+    emit changed();
+}
+
+int QQmlFunctionSorter::compareRows(const QQmlSortFilterProxyModel *model, int lhsRow, int rhsRow) const
+{
+    if (!m_callback.isCallable())
+        return 0;
+    const QJSValue result = m_callback.call({ model->rowData(lhsRow), model->rowData(rhsRow) });
+    if (result.isError()) {
+        qmlWarning(this) << result.toString();
+        return 0;
+    }
+    const double value = result.toNumber();
+    return value < 0 ? -1 : (value > 0 ? 1 : 0);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qqmlsortfilterrules_p.cpp"
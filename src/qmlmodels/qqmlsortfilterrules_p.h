@@ -0,0 +1,216 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQMLSORTFILTERRULES_P_H
+#define QQMLSORTFILTERRULES_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQmlModels/private/qtqmlmodelsglobal_p.h>
+#include <QtQml/qjsvalue.h>
+#include <QtQml/qqml.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qvariant.h>
+
+QT_REQUIRE_CONFIG(qml_itemmodel);
+
+QT_BEGIN_NAMESPACE
+
+class QQmlSortFilterProxyModel;
+
+class Q_QMLMODELS_EXPORT QQmlSortFilterRule : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged FINAL)
+    QML_ANONYMOUS
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlSortFilterRule(QObject *parent = nullptr);
+
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enabled);
+
+    // Names of the roles the rule depends on, or an empty list if it may
+    // depend on any role.
+    virtual QStringList roleNames() const { return QStringList(); }
+
+Q_SIGNALS:
+    void enabledChanged();
+    void changed();
+
+private:
+    bool m_enabled = true;
+};
+
+class Q_QMLMODELS_EXPORT QQmlFilterBase : public QQmlSortFilterRule
+{
+    Q_OBJECT
+    Q_PROPERTY(bool invert READ invert WRITE setInvert NOTIFY invertChanged FINAL)
+    QML_NAMED_ELEMENT(Filter)
+    QML_UNCREATABLE("Filter is an abstract type.")
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlFilterBase(QObject *parent = nullptr);
+
+    bool invert() const { return m_invert; }
+    void setInvert(bool invert);
+
+    bool accepts(const QQmlSortFilterProxyModel *model, int sourceRow) const
+    {
+        return filterAcceptsRow(model, sourceRow) != m_invert;
+    }
+
+Q_SIGNALS:
+    void invertChanged();
+
+protected:
+    virtual bool filterAcceptsRow(const QQmlSortFilterProxyModel *model, int sourceRow) const = 0;
+
+private:
+    bool m_invert = false;
+};
+
+class Q_QMLMODELS_EXPORT QQmlValueFilter : public QQmlFilterBase
+{
+    Q_OBJECT
+    Q_PROPERTY(QString roleName READ roleName WRITE setRoleName NOTIFY roleNameChanged FINAL)
+    Q_PROPERTY(QVariant value READ value WRITE setValue NOTIFY valueChanged FINAL)
+    QML_NAMED_ELEMENT(ValueFilter)
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlValueFilter(QObject *parent = nullptr);
+
+    QString roleName() const { return m_roleName; }
+    void setRoleName(const QString &roleName);
+
+    QVariant value() const { return m_value; }
+    void setValue(const QVariant &value);
+
+    QStringList roleNames() const override { return QStringList(m_roleName); }
+
+Q_SIGNALS:
+    void roleNameChanged();
+    void valueChanged();
+
+protected:
+    bool filterAcceptsRow(const QQmlSortFilterProxyModel *model, int sourceRow) const override;
+
+private:
+    QString m_roleName;
+    QVariant m_value;
+};
+
+class Q_QMLMODELS_EXPORT QQmlFunctionFilter : public QQmlFilterBase
+{
+    Q_OBJECT
+    Q_PROPERTY(QJSValue callback READ callback WRITE setCallback NOTIFY callbackChanged FINAL)
+    QML_NAMED_ELEMENT(FunctionFilter)
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlFunctionFilter(QObject *parent = nullptr);
+
+    QJSValue callback() const { return m_callback; }
+    void setCallback(const QJSValue &callback);
+
+Q_SIGNALS:
+    void callbackChanged();
+
+protected:
+    bool filterAcceptsRow(const QQmlSortFilterProxyModel *model, int sourceRow) const override;
+
+private:
+    QJSValue m_callback;
+};
+
+class Q_QMLMODELS_EXPORT QQmlSorterBase : public QQmlSortFilterRule
+{
+    Q_OBJECT
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged FINAL)
+    QML_NAMED_ELEMENT(Sorter)
+    QML_UNCREATABLE("Sorter is an abstract type.")
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlSorterBase(QObject *parent = nullptr);
+
+    Qt::SortOrder sortOrder() const { return m_sortOrder; }
+    void setSortOrder(Qt::SortOrder order);
+
+    // Sorters with a sort key have it cached by the proxy model, and are
+    // then compared without calling into the sorter. Comparing cached keys
+    // is thread-safe, which allows sorting in parallel.
+    virtual bool hasSortKey() const { return false; }
+    virtual QVariant sortKey(const QQmlSortFilterProxyModel *model, int sourceRow) const;
+    virtual int compareRows(const QQmlSortFilterProxyModel *model, int lhsRow, int rhsRow) const;
+
+    static int compareValues(const QVariant &lhs, const QVariant &rhs);
+
+Q_SIGNALS:
+    void sortOrderChanged();
+
+private:
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+};
+
+class Q_QMLMODELS_EXPORT QQmlRoleSorter : public QQmlSorterBase
+{
+    Q_OBJECT
+    Q_PROPERTY(QString roleName READ roleName WRITE setRoleName NOTIFY roleNameChanged FINAL)
+    QML_NAMED_ELEMENT(RoleSorter)
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlRoleSorter(QObject *parent = nullptr);
+
+    QString roleName() const { return m_roleName; }
+    void setRoleName(const QString &roleName);
+
+    QStringList roleNames() const override { return QStringList(m_roleName); }
+    bool hasSortKey() const override { return true; }
+    QVariant sortKey(const QQmlSortFilterProxyModel *model, int sourceRow) const override;
+
+Q_SIGNALS:
+    void roleNameChanged();
+
+private:
+    QString m_roleName;
+};
+
+class Q_QMLMODELS_EXPORT QQmlFunctionSorter : public QQmlSorterBase
+{
+    Q_OBJECT
+    Q_PROPERTY(QJSValue callback READ callback WRITE setCallback NOTIFY callbackChanged FINAL)
+    QML_NAMED_ELEMENT(FunctionSorter)
+    QML_ADDED_IN_VERSION(6, 10)
+
+public:
+    explicit QQmlFunctionSorter(QObject *parent = nullptr);
+
+    QJSValue callback() const { return m_callback; }
+    void setCallback(const QJSValue &callback);
+
+    int compareRows(const QQmlSortFilterProxyModel *model, int lhsRow, int rhsRow) const override;
+
+Q_SIGNALS:
+    void callbackChanged();
+
+private:
+    QJSValue m_callback;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQMLSORTFILTERRULES_P_H
@@ -111,6 +111,14 @@ QQmlDelegateModelItem *QQmlTableInstanceModel::resolveModelItem(int index)
     if (modelItem) {
         modelItem->delegate = delegate;
         m_modelItems.insert(index, modelItem);
+
+        // Another model using the same delegate might have left an object
+        // behind that we can adopt instead of incubating a new one.
+        if (adoptSharedObject(modelItem)) {
+            modelItem->object->setProperty(kModelItemTag, QVariant::fromValue(modelItem));
+            emit initItem(index, modelItem->object);
+            reuseItem(modelItem, index);
+        }
         return modelItem;
     }
 
@@ -249,11 +257,43 @@ void QQmlTableInstanceModel::cancel(int index)
 
 void QQmlTableInstanceModel::drainReusableItemsPool(int maxPoolTime)
 {
+    // See QQmlDelegateModelPrivate::drainReusableItemsPool()
+    QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::get(m_metaType->v4Engine);
+    if (sharedPool && maxPoolTime > 0)
+        sharedPool->drain(maxPoolTime);
+
     m_reusableItemsPool.drain(maxPoolTime, [this](QQmlDelegateModelItem *modelItem) {
-        destroyModelItem(modelItem, Immediate);
+        // Let other models with the same delegate pick up the object, if the
+        // engine has a shared pool. Otherwise, the item is no longer needed.
+        if (QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::poolFor(modelItem)) {
+            emit destroyingItem(modelItem->object);
+            modelItem->object->setProperty(kModelItemTag, QVariant());
+            sharedPool->insertItem(modelItem);
+            delete modelItem;
+        } else {
+            destroyModelItem(modelItem, Immediate);
+        }
     });
 }
 
+bool QQmlTableInstanceModel::sharesPooledItems() const
+{
+    return QQmlSharedDelegateItemsPool::get(m_metaType->v4Engine);
+}
+
+bool QQmlTableInstanceModel::adoptSharedObject(QQmlDelegateModelItem *modelItem)
+{
+    if (!m_qmlContext || !m_qmlContext->isValid() || QQmlComponentPrivate::get(modelItem->delegate)->isBound())
+        return false;
+
+    QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::get(m_metaType->v4Engine);
+    if (!sharedPool)
+        return false;
+
+    QQmlContext *creationContext = modelItem->delegate->creationContext();
+    return sharedPool->takeItem(modelItem, QQmlContextData::get(creationContext ? creationContext : m_qmlContext.data()));
+}
+
 void QQmlTableInstanceModel::reuseItem(QQmlDelegateModelItem *item, int newModelIndex)
 {
     // Update the context properties index, row and column on
@@ -81,6 +81,7 @@ public:
 
     void drainReusableItemsPool(int maxPoolTime) override;
     int poolSize() override { return m_reusableItemsPool.size(); }
+    bool sharesPooledItems() const override;
     void reuseItem(QQmlDelegateModelItem *item, int newModelIndex);
 
     QQmlIncubator::Status incubationStatus(int index) override;
@@ -114,6 +115,7 @@ private:
     void deleteIncubationTaskLater(QQmlIncubator *incubationTask);
     void deleteAllFinishedIncubationTasks();
     QQmlDelegateModelItem *resolveModelItem(int index);
+    bool adoptSharedObject(QQmlDelegateModelItem *modelItem);
     void destroyModelItem(QQmlDelegateModelItem *modelItem, DestructionMode mode);
 
     void dataChangedCallback(const QModelIndex &begin, const QModelIndex &end, const QVector<int> &roles);
@@ -41,7 +41,7 @@ public:
     virtual ~WorkerDataEvent();
 
     int workerId() const;
-    QByteArray data() const;
+    QByteArray takeData();
 
 private:
     int m_id;
@@ -109,7 +109,8 @@ class QQuickWorkerScriptEnginePrivate : public QObject
     Q_OBJECT
 public:
     enum WorkerEventTypes {
-        WorkerDestroyEvent = QEvent::User + 100
+        WorkerDestroyEvent = QEvent::User + 100,
+        WorkerQueueEvent
     };
 
     QQuickWorkerScriptEnginePrivate(QQmlTypeLoader *typeLoader)
@@ -128,6 +129,14 @@ public:
     // the worker script.
     QHash<int, QBiPointer<QV4::ExecutionEngine, QQuickWorkerScript>> workers;
 
+    // Messages posted to each worker that it has not processed yet. The owner
+    // is notified once per batch of processed messages.
+    struct MessageQueue {
+        int pending = 0;
+        bool notifying = false;
+    };
+    QHash<int, MessageQueue> queues;
+
     int m_nextId = 0;
 
     static QV4::ReturnedValue method_sendMessage(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
@@ -153,11 +162,14 @@ QV4::ReturnedValue QQuickWorkerScriptEnginePrivate::method_sendMessage(const QV4
     Q_ASSERT(script);
 
     QV4::ScopedValue v(scope, argc > 0 ? argv[0] : QV4::Value::undefinedValue());
-    QByteArray data = QV4::Serialize::serialize(v, scope.engine);
+    QV4::ScopedValue transfer(scope, argc > 1 ? argv[1] : QV4::Value::undefinedValue());
+    QByteArray data = QV4::Serialize::serialize(v, transfer, scope.engine);
 
     QMutexLocker locker(&script->p->m_lock);
     if (script->owner)
         QCoreApplication::postEvent(script->owner, new WorkerDataEvent(0, data));
+    else
+        QV4::Serialize::release(data);
 
     return QV4::Encode::undefined();
 }
@@ -166,7 +178,7 @@ bool QQuickWorkerScriptEnginePrivate::event(QEvent *event)
 {
     if (event->type() == (QEvent::Type)WorkerDataEvent::WorkerData) {
         WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
-        processMessage(workerEvent->workerId(), workerEvent->data());
+        processMessage(workerEvent->workerId(), workerEvent->takeData());
         return true;
     } else if (event->type() == (QEvent::Type)WorkerLoadEvent::WorkerLoad) {
         WorkerLoadEvent *workerEvent = static_cast<WorkerLoadEvent *>(event);
@@ -209,9 +221,28 @@ QV4::ExecutionEngine *QQuickWorkerScriptEnginePrivate::workerEngine(int id)
 
 void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &data)
 {
+    {
+        QMutexLocker locker(&m_lock);
+        const auto queue = queues.find(id);
+        if (queue != queues.end()) {
+            --queue->pending;
+            const auto worker = workers.constFind(id);
+            if (!queue->notifying && worker != workers.cend()) {
+                QObject *owner = worker->isT1() ? workerScriptExtension(worker->asT1())->owner
+                                                : static_cast<QObject *>(worker->asT2());
+                if (owner) {
+                    queue->notifying = true;
+                    QCoreApplication::postEvent(owner, new QEvent(QEvent::Type(WorkerQueueEvent)));
+                }
+            }
+        }
+    }
+
     QV4::ExecutionEngine *engine = workerEngine(id);
-    if (!engine)
+    if (!engine) {
+        QV4::Serialize::release(data);
         return;
+    }
 
     QV4::Scope scope(engine);
     QV4::ScopedString v(scope, engine->newString(QStringLiteral("WorkerScript")));
@@ -220,8 +251,10 @@ void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &d
     if (worker)
         onmessage = worker->get((v = engine->newString(QStringLiteral("onMessage"))));
 
-    if (!onmessage)
+    if (!onmessage) {
+        QV4::Serialize::release(data);
         return;
+    }
 
     QV4::ScopedValue value(scope, QV4::Serialize::deserialize(data, engine));
 
@@ -292,6 +325,8 @@ WorkerDataEvent::WorkerDataEvent(int workerId, const QByteArray &data)
 
 WorkerDataEvent::~WorkerDataEvent()
 {
+    // The message was never delivered, if it still has its data
+    QV4::Serialize::release(m_data);
 }
 
 int WorkerDataEvent::workerId() const
@@ -299,9 +334,9 @@ int WorkerDataEvent::workerId() const
     return m_id;
 }
 
-QByteArray WorkerDataEvent::data() const
+QByteArray WorkerDataEvent::takeData()
 {
-    return m_data;
+    return std::exchange(m_data, QByteArray());
 }
 
 WorkerLoadEvent::WorkerLoadEvent(int workerId, const QUrl &url)
@@ -404,8 +439,10 @@ int QQuickWorkerScriptEngine::registerWorkerScript(QQuickWorkerScript *owner)
 
     d->m_lock.lock();
     d->workers.insert(id, owner);
+    d->queues.insert(id, {});
     d->m_lock.unlock();
 
+    ++m_workerCount;
     return id;
 }
 
@@ -415,6 +452,13 @@ void QQuickWorkerScriptEngine::removeWorkerScript(int id)
     if (it == d->workers.cend())
         return;
 
+    --m_workerCount;
+
+    // The owner must not be notified anymore, even before the worker is gone
+    d->m_lock.lock();
+    d->queues.remove(id);
+    d->m_lock.unlock();
+
     if (it->isT1()) {
         QV4::ExecutionEngine *engine = it->asT1();
         workerScriptExtension(engine)->owner = nullptr;
@@ -429,9 +473,31 @@ void QQuickWorkerScriptEngine::executeUrl(int id, const QUrl &url)
 
 void QQuickWorkerScriptEngine::sendMessage(int id, const QByteArray &data)
 {
+    d->m_lock.lock();
+    const auto queue = d->queues.find(id);
+    if (queue != d->queues.end())
+        ++queue->pending;
+    d->m_lock.unlock();
+
     QCoreApplication::postEvent(d, new WorkerDataEvent(id, data));
 }
 
+int QQuickWorkerScriptEngine::pendingMessages(int id) const
+{
+    QMutexLocker locker(&d->m_lock);
+    return d->queues.value(id).pending;
+}
+
+// Called by the owner once it has handled a queue notification, so that the
+// next processed message notifies it again.
+void QQuickWorkerScriptEngine::acknowledgePendingMessages(int id)
+{
+    QMutexLocker locker(&d->m_lock);
+    const auto queue = d->queues.find(id);
+    if (queue != d->queues.end())
+        queue->notifying = false;
+}
+
 void QQuickWorkerScriptEngine::run()
 {
     d->m_lock.lock();
@@ -448,6 +514,39 @@ void QQuickWorkerScriptEngine::run()
     d->workers.clear();
 }
 
+QQuickWorkerScriptEnginePool::QQuickWorkerScriptEnginePool(QQmlEngine *parent)
+    : QObject(parent), m_qmlEngine(parent)
+{
+    m_maxThreadCount = qEnvironmentVariableIntValue("QML_WORKERSCRIPT_MAX_THREADS");
+    if (m_maxThreadCount <= 0)
+        m_maxThreadCount = QThread::idealThreadCount();
+}
+
+// Worker engines cannot migrate between threads once created, so messages are
+// balanced by placing each new worker on the thread hosting the fewest workers.
+// Threads are only started when all existing ones are busy.
+QQuickWorkerScriptEngine *QQuickWorkerScriptEnginePool::sharedEngine()
+{
+    QQuickWorkerScriptEngine *engine = nullptr;
+    for (QQuickWorkerScriptEngine *candidate : std::as_const(m_engines)) {
+        if (!engine || candidate->workerCount() < engine->workerCount())
+            engine = candidate;
+    }
+
+    if (!engine || (engine->workerCount() > 0 && m_engines.size() < m_maxThreadCount)) {
+        engine = new QQuickWorkerScriptEngine(m_qmlEngine);
+        m_engines.append(engine);
+    }
+    return engine;
+}
+
+// The thread of a dedicated engine only hosts the worker requesting it. The
+// worker deletes it when it goes away.
+QQuickWorkerScriptEngine *QQuickWorkerScriptEnginePool::dedicatedEngine()
+{
+    return new QQuickWorkerScriptEngine(m_qmlEngine);
+}
+
 
 /*!
     \qmltype WorkerScript
@@ -488,6 +587,17 @@ void QQuickWorkerScriptEngine::run()
     isolation and thread-safety. If the impact of that results in a memory consumption that is too
     high for your environment, then consider sharing a WorkerScript element.
 
+    \section3 Threads
+
+    The worker scripts of a QML engine run in a pool of threads, so that several workers can use
+    separate cores at the same time. The pool grows up to QThread::idealThreadCount() threads, or
+    to the number given in the \c QML_WORKERSCRIPT_MAX_THREADS environment variable. Setting the
+    variable to 1 runs all worker scripts in a single thread. Messages to one worker are always
+    processed in order, in the thread that loaded its script.
+
+    A worker can be given a thread of its own with the \l dedicatedThread property. The
+    \l pendingMessages property tells how many messages are waiting for a worker.
+
     \section3 Restrictions
 
     Since the \c WorkerScript.onMessage() function is run in a separate thread, the
@@ -511,6 +621,8 @@ QQuickWorkerScript::QQuickWorkerScript(QObject *parent)
 QQuickWorkerScript::~QQuickWorkerScript()
 {
     if (m_scriptId != -1) m_engine->removeWorkerScript(m_scriptId);
+    if (m_engine && m_dedicatedThread)
+        m_engine->deleteLater();
 }
 
 /*!
@@ -555,7 +667,56 @@ bool QQuickWorkerScript::ready() const
 }
 
 /*!
-    \qmlmethod WorkerScript::sendMessage(jsobject message)
+    \qmlproperty bool WorkerScript::dedicatedThread
+    \since 6.10
+
+    This holds whether the worker script runs in a thread of its own.
+
+    By default, worker scripts share a pool of threads. Each new worker is
+    placed on the thread hosting the fewest workers. Set this property to
+    \c true for a long running or latency sensitive worker that should not
+    share its thread with other workers.
+
+    The property has to be set before the WorkerScript becomes \l ready.
+    Changing it later has no effect.
+*/
+bool QQuickWorkerScript::dedicatedThread() const
+{
+    return m_dedicatedThread;
+}
+
+void QQuickWorkerScript::setDedicatedThread(bool dedicated)
+{
+    if (m_dedicatedThread == dedicated)
+        return;
+
+    if (m_engine) {
+        qWarning("QQuickWorkerScript: Cannot change dedicatedThread after WorkerScript establishment");
+        return;
+    }
+
+    m_dedicatedThread = dedicated;
+    emit dedicatedThreadChanged();
+}
+
+/*!
+    \qmlproperty int WorkerScript::pendingMessages
+    \readonly
+    \since 6.10
+
+    This holds the number of messages sent to the worker script through
+    sendMessage() that it has not started processing yet.
+
+    A queue that keeps growing shows that the worker cannot keep up with the
+    messages sent to it.
+*/
+int QQuickWorkerScript::pendingMessages() const
+{
+    return m_engine ? m_engine->pendingMessages(m_scriptId) : 0;
+}
+
+/*!
+    \qmlmethod WorkerScript::sendMessage(jsobject message, list transfer)
 
     Sends the given \a message to a worker script handler in another
     thread. The other worker script handler can receive this message
@@ -567,12 +728,25 @@ bool QQuickWorkerScript::ready() const
     \list
     \li boolean, number, string
     \li JavaScript objects and arrays
+    \li ArrayBuffer, SharedArrayBuffer and typed arrays
     \li ListModel objects (any other type of QObject* is not allowed)
     \endlist
 
     All objects and arrays are copied to the \c message. With the exception
-    of ListModel objects, any modifications by the other thread to an object
-    passed in \c message will not be reflected in the original object.
+    of ListModel objects and SharedArrayBuffers, any modifications by the
+    other thread to an object passed in \c message will not be reflected in
+    the original object. A SharedArrayBuffer refers to the same memory in both
+    threads, which can be synchronized using \c Atomics. A typed array that is
+    copied only takes the part of its buffer that it views along.
+
+    The optional \a transfer array lists ArrayBuffers in \c message that are
+    moved to the other thread instead of being copied. A typed array in the
+    list stands for its buffer. The contents of a transferred buffer are
+    handed over without copying, and the buffer becomes detached, with a
+    \c byteLength of 0, in the sending thread. \c sendMessage() inside the
+    worker script accepts the same argument.
+
+    The buffer types and the \a transfer argument were added in Qt 6.10.
 */
 void QQuickWorkerScript::sendMessage(QQmlV4FunctionPtr args)
 {
@@ -585,8 +759,12 @@ void QQuickWorkerScript::sendMessage(QQmlV4FunctionPtr args)
     QV4::ScopedValue argument(scope, QV4::Value::undefinedValue());
     if (args->length() != 0)
         argument = (*args)[0];
+    QV4::ScopedValue transfer(scope, QV4::Value::undefinedValue());
+    if (args->length() > 1)
+        transfer = (*args)[1];
 
-    m_engine->sendMessage(m_scriptId, QV4::Serialize::serialize(argument, scope.engine));
+    m_engine->sendMessage(m_scriptId, QV4::Serialize::serialize(argument, transfer, scope.engine));
+    emit pendingMessagesChanged();
 }
 
 void QQuickWorkerScript::classBegin()
@@ -607,9 +785,10 @@ QQuickWorkerScriptEngine *QQuickWorkerScript::engine()
 
         QQmlEnginePrivate *enginePrivate = QQmlEnginePrivate::get(engine);
         if (enginePrivate->workerScriptEngine == nullptr)
-            enginePrivate->workerScriptEngine = new QQuickWorkerScriptEngine(engine);
-        m_engine = qobject_cast<QQuickWorkerScriptEngine *>(enginePrivate->workerScriptEngine);
-        Q_ASSERT(m_engine);
+            enginePrivate->workerScriptEngine = new QQuickWorkerScriptEnginePool(engine);
+        auto *pool = qobject_cast<QQuickWorkerScriptEnginePool *>(enginePrivate->workerScriptEngine);
+        Q_ASSERT(pool);
+        m_engine = m_dedicatedThread ? pool->dedicatedEngine() : pool->sharedEngine();
         m_scriptId = m_engine->registerWorkerScript(this);
 
         if (m_source.isValid())
@@ -638,17 +817,23 @@ void QQuickWorkerScript::componentComplete()
 bool QQuickWorkerScript::event(QEvent *event)
 {
     if (event->type() == (QEvent::Type)WorkerDataEvent::WorkerData) {
+        WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
         if (QQmlEngine *engine = qmlEngine(this)) {
             QV4::ExecutionEngine *v4 = engine->handle();
-            WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
             emit message(QJSValuePrivate::fromReturnedValue(
-                             QV4::Serialize::deserialize(workerEvent->data(), v4)));
+                             QV4::Serialize::deserialize(workerEvent->takeData(), v4)));
         }
         return true;
     } else if (event->type() == (QEvent::Type)WorkerErrorEvent::WorkerError) {
         WorkerErrorEvent *workerEvent = static_cast<WorkerErrorEvent *>(event);
         QQmlEnginePrivate::warning(qmlEngine(this), workerEvent->error());
         return true;
+    } else if (event->type() == (QEvent::Type)QQuickWorkerScriptEnginePrivate::WorkerQueueEvent) {
+        if (m_engine) {
+            m_engine->acknowledgePendingMessages(m_scriptId);
+            emit pendingMessagesChanged();
+        }
+        return true;
     } else {
         return QObject::event(event);
     }
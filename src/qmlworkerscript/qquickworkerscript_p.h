@@ -19,6 +19,7 @@
 
 #include <QtQmlWorkerScript/private/qtqmlworkerscriptglobal_p.h>
 #include <QtQml/qqmlparserstatus.h>
+#include <QtCore/qlist.h>
 #include <QtCore/qthread.h>
 #include <QtQml/qjsvalue.h>
 #include <QtCore/qurl.h>
@@ -40,11 +41,31 @@ public:
     void executeUrl(int, const QUrl &);
     void sendMessage(int, const QByteArray &);
 
+    int workerCount() const { return m_workerCount; }
+    int pendingMessages(int) const;
+    void acknowledgePendingMessages(int);
+
 protected:
     void run() override;
 
 private:
     QQuickWorkerScriptEnginePrivate *d;
+    int m_workerCount = 0;
+};
+
+class QQuickWorkerScriptEnginePool : public QObject
+{
+    Q_OBJECT
+public:
+    QQuickWorkerScriptEnginePool(QQmlEngine *parent);
+
+    QQuickWorkerScriptEngine *sharedEngine();
+    QQuickWorkerScriptEngine *dedicatedEngine();
+
+private:
+    QQmlEngine *m_qmlEngine;
+    QList<QQuickWorkerScriptEngine *> m_engines;
+    int m_maxThreadCount;
 };
 
 class Q_QMLWORKERSCRIPT_EXPORT QQuickWorkerScript : public QObject, public QQmlParserStatus
@@ -53,6 +74,10 @@ class Q_QMLWORKERSCRIPT_EXPORT QQuickWorkerScript : public QObject, public QQmlP
     Q_DISABLE_COPY_MOVE(QQuickWorkerScript)
     Q_PROPERTY(QUrl source READ source WRITE setSource NOTIFY sourceChanged)
     Q_PROPERTY(bool ready READ ready NOTIFY readyChanged REVISION(2, 15))
+    Q_PROPERTY(bool dedicatedThread READ dedicatedThread WRITE setDedicatedThread
+               NOTIFY dedicatedThreadChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(int pendingMessages READ pendingMessages NOTIFY pendingMessagesChanged
+               REVISION(6, 10) FINAL)
 
     QML_NAMED_ELEMENT(WorkerScript);
     QML_ADDED_IN_VERSION(2, 0)
@@ -67,12 +92,19 @@ public:
 
     bool ready() const;
 
+    bool dedicatedThread() const;
+    void setDedicatedThread(bool dedicated);
+
+    int pendingMessages() const;
+
 public Q_SLOTS:
     void sendMessage(QQmlV4FunctionPtr);
 
 Q_SIGNALS:
     void sourceChanged();
     Q_REVISION(2, 15) void readyChanged();
+    Q_REVISION(6, 10) void dedicatedThreadChanged();
+    Q_REVISION(6, 10) void pendingMessagesChanged();
     void message(const QJSValue &messageObject);
 
 protected:
@@ -86,6 +118,7 @@ private:
     int m_scriptId;
     QUrl m_source;
     bool m_componentComplete;
+    bool m_dedicatedThread = false;
 };
 
 QT_END_NAMESPACE
@@ -3,12 +3,15 @@
 
 #include "qv4serialize_p.h"
 
+#include <private/qv4arraybuffer_p.h>
 #include <private/qv4dateobject_p.h>
+#include <private/qv4mm_p.h>
 #include <private/qv4objectproto_p.h>
 #include <private/qv4qobjectwrapper_p.h>
 #include <private/qv4regexp_p.h>
 #include <private/qv4regexpobject_p.h>
 #include <private/qv4sequenceobject_p.h>
+#include <private/qv4typedarray_p.h>
 #include <private/qv4value_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -27,7 +30,13 @@ using namespace QV4;
 //    + Number
 //    + Date
 //    + RegExp
+//    + ArrayBuffer, SharedArrayBuffer
+//    + TypedArray
 // <quint8 type><quint24 size><data>
+//
+// The data of SharedArrayBuffers, and of ArrayBuffers in the transfer list of
+// the message, is not copied. The message holds a QByteArray referencing it,
+// which the receiving engine adopts, in the same way as ListModel agents.
 
 enum Type {
     WorkerUndefined,
@@ -45,7 +54,11 @@ enum Type {
     WorkerRegexp,
     WorkerListModel,
     WorkerUrl,
-    WorkerSequence
+    WorkerSequence,
+    WorkerArrayBuffer,
+    WorkerTransferredArrayBuffer,
+    WorkerSharedArrayBuffer,
+    WorkerTypedArray
 };
 
 static inline quint32 valueheader(Type type, quint32 size = 0)
@@ -124,10 +137,35 @@ static inline void serializeString(QByteArray &data, const QString &str, Type ty
     memcpy(buffer, str.constData(), length*sizeof(QChar));
 }
 
+static inline void serializeArrayBufferData(QByteArray &data, const char *bytes, quint32 length)
+{
+    reserve(data, 2 * sizeof(quint32) + ALIGN(length));
+    push(data, valueheader(WorkerArrayBuffer));
+    push(data, length);
+    data.append(bytes, length);
+    data.append(ALIGN(length) - length, '\0');
+}
+
+static inline void serializeArrayBuffer(QByteArray &data, Heap::SharedArrayBuffer *buffer,
+                                        const QList<Heap::SharedArrayBuffer *> &transfer)
+{
+    if (buffer->isSharedArrayBuffer() || transfer.contains(buffer)) {
+        push(data, valueheader(buffer->isSharedArrayBuffer() ? WorkerSharedArrayBuffer
+                                                             : WorkerTransferredArrayBuffer));
+        push(data, (void *)new QByteArray(buffer->sharedArrayData()));
+        return;
+    }
+
+    // Plain ArrayBuffers are copied in one go
+    const quint32 length = buffer->hasDetachedArrayData() ? 0 : buffer->arrayDataLength();
+    serializeArrayBufferData(data, buffer->constArrayData(), length);
+}
+
 // XXX TODO: Check that worker script is exception safe in the case of
 // serialization/deserialization failures
 
-void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine)
+void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine,
+                          const TransferList &transfer)
 {
     QV4::Scope scope(engine);
 
@@ -155,7 +193,7 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         push(data, valueheader(WorkerArray, length));
         ScopedValue val(scope);
         for (uint ii = 0; ii < length; ++ii)
-            serialize(data, (val = array->get(ii)), engine);
+            serialize(data, (val = array->get(ii)), engine, transfer);
     } else if (v.isInteger()) {
         reserve(data, 2 * sizeof(quint32));
         push(data, valueheader(WorkerInt32));
@@ -218,13 +256,33 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
 
         // sequence type
         serialize(data, QV4::Value::fromInt32(
-                                QV4::SequencePrototype::metaTypeForSequence(s).id()), engine);
+                                QV4::SequencePrototype::metaTypeForSequence(s).id()), engine, transfer);
 
         ScopedValue val(scope);
         for (uint ii = 0; ii < seqLength; ++ii)
-            serialize(data, (val = s->get(ii)), engine); // sequence elements
+            serialize(data, (val = s->get(ii)), engine, transfer); // sequence elements
 
         return;
+    } else if (const SharedArrayBuffer *buffer = v.as<SharedArrayBuffer>()) {
+        serializeArrayBuffer(data, buffer->d(), transfer);
+    } else if (const TypedArray *array = v.as<TypedArray>()) {
+        // <header with the array type><byte offset><length><buffer>
+        const bool detached = array->hasDetachedArrayData();
+        Heap::SharedArrayBuffer *buffer = array->d()->buffer;
+        reserve(data, 3 * sizeof(quint32));
+        push(data, valueheader(WorkerTypedArray, array->arrayType()));
+        if (detached || buffer->isSharedArrayBuffer() || transfer.contains(buffer)) {
+            // The receiver gets the same buffer, so the view keeps its place in it
+            push(data, quint32(detached ? 0 : array->byteOffset()));
+            push(data, quint32(detached ? 0 : array->length()));
+            serializeArrayBuffer(data, buffer, transfer);
+        } else {
+            // A copy only needs the bytes the view covers, not its whole buffer
+            push(data, quint32(0));
+            push(data, quint32(array->length()));
+            serializeArrayBufferData(data, array->constArrayData() + array->byteOffset(),
+                                     array->byteLength());
+        }
     } else if (const Object *o = v.as<Object>()) {
         const QVariant variant = QV4::ExecutionEngine::toVariant(
                     v, QMetaType::fromType<QUrl>(), false);
@@ -246,14 +304,14 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         QV4::ScopedValue s(scope);
         for (quint32 ii = 0; ii < length; ++ii) {
             s = properties->get(ii);
-            serialize(data, s, engine);
+            serialize(data, s, engine, transfer);
 
             QV4::String *str = s->as<String>();
             val = o->get(str);
             if (scope.hasException())
                 scope.engine->catchException();
 
-            serialize(data, val, engine);
+            serialize(data, val, engine, transfer);
         }
         return;
     } else {
@@ -382,6 +440,34 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         agent->setProperty("engine", QVariant::fromValue(engine));
         return rv->asReturnedValue();
     }
+    case WorkerArrayBuffer:
+    {
+        quint32 length = popUint32(data);
+        Scoped<ArrayBuffer> buffer(scope, engine->newArrayBuffer(size_t(length)));
+        if (length > 0 && !buffer->hasDetachedArrayData())
+            memcpy(buffer->arrayData(), data, length);
+        data += ALIGN(length);
+        return buffer.asReturnedValue();
+    }
+    case WorkerTransferredArrayBuffer:
+    case WorkerSharedArrayBuffer:
+    {
+        const std::unique_ptr<QByteArray> array(reinterpret_cast<QByteArray *>(popPtr(data)));
+        if (type == WorkerSharedArrayBuffer)
+            return Encode(engine->memoryManager->allocate<SharedArrayBuffer>(*array));
+        return Encode(engine->newArrayBuffer(*array));
+    }
+    case WorkerTypedArray:
+    {
+        const uint arrayType = headersize(header);
+        Value *arguments = scope.alloc(3);
+        arguments[1] = Value::fromUInt32(popUint32(data));
+        arguments[2] = Value::fromUInt32(popUint32(data));
+        arguments[0] = deserialize(data, engine);
+        Q_ASSERT(arrayType < uint(NTypedArrayTypes));
+        ScopedFunctionObject constructor(scope, engine->typedArrayCtors[arrayType]);
+        return constructor->callAsConstructor(arguments, 3);
+    }
     case WorkerSequence:
     {
         ScopedValue value(scope);
@@ -407,7 +493,37 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
 QByteArray Serialize::serialize(const QV4::Value &value, ExecutionEngine *engine)
 {
     QByteArray rv;
-    serialize(rv, value, engine);
+    serialize(rv, value, engine, TransferList());
+    return rv;
+}
+
+// The data of the ArrayBuffers in \a transfer moves to the message without
+// being copied, and the buffers are detached from the sending engine.
+// TypedArrays can be listed instead of their buffer.
+QByteArray Serialize::serialize(const QV4::Value &value, const QV4::Value &transfer,
+                                ExecutionEngine *engine)
+{
+    Scope scope(engine);
+    TransferList buffers;
+    if (const ArrayObject *list = transfer.as<ArrayObject>()) {
+        ScopedValue item(scope);
+        const uint length = list->getLength();
+        for (uint ii = 0; ii < length; ++ii) {
+            item = list->get(ii);
+            if (const TypedArray *array = item->as<TypedArray>())
+                buffers.append(array->d()->buffer);
+            else if (const SharedArrayBuffer *buffer = item->as<SharedArrayBuffer>())
+                buffers.append(buffer->d());
+        }
+    }
+
+    QByteArray rv;
+    serialize(rv, value, engine, buffers);
+
+    for (Heap::SharedArrayBuffer *buffer : std::as_const(buffers)) {
+        if (!buffer->isSharedArrayBuffer())
+            buffer->detachArrayData();
+    }
     return rv;
 }
 
@@ -417,4 +533,88 @@ ReturnedValue Serialize::deserialize(const QByteArray &data, ExecutionEngine *en
     return deserialize(stream, engine);
 }
 
+void Serialize::release(const char *&data)
+{
+    quint32 header = popUint32(data);
+    Type type = headertype(header);
+
+    switch (type) {
+    case WorkerUndefined:
+    case WorkerNull:
+    case WorkerTrue:
+    case WorkerFalse:
+        return;
+    case WorkerString:
+    case WorkerUrl:
+        data += ALIGN(headersize(header) * sizeof(quint16));
+        return;
+    case WorkerFunction:
+        Q_ASSERT(!"Unreachable");
+        return;
+    case WorkerArray:
+    case WorkerSequence:
+    {
+        quint32 size = headersize(header);
+        for (quint32 ii = 0; ii < size; ++ii)
+            release(data);
+        return;
+    }
+    case WorkerObject:
+    {
+        quint32 size = headersize(header);
+        for (quint32 ii = 0; ii < size; ++ii) {
+            release(data); // name
+            release(data); // value
+        }
+        return;
+    }
+    case WorkerInt32:
+    case WorkerUint32:
+        data += sizeof(quint32);
+        return;
+    case WorkerNumber:
+    case WorkerDate:
+        data += sizeof(double);
+        return;
+    case WorkerRegexp:
+    {
+        quint32 length = popUint32(data);
+        data += ALIGN(length * sizeof(quint16));
+        return;
+    }
+    case WorkerListModel:
+    {
+        QObject *agent = reinterpret_cast<QObject *>(popPtr(data));
+        QMetaObject::invokeMethod(agent, "release");
+        return;
+    }
+    case WorkerArrayBuffer:
+    {
+        quint32 length = popUint32(data);
+        data += ALIGN(length);
+        return;
+    }
+    case WorkerTransferredArrayBuffer:
+    case WorkerSharedArrayBuffer:
+        delete reinterpret_cast<QByteArray *>(popPtr(data));
+        return;
+    case WorkerTypedArray:
+        data += 2 * sizeof(quint32);
+        release(data); // buffer
+        return;
+    }
+    Q_ASSERT(!"Unreachable");
+}
+
+// Releases what a message that is dropped without being deserialized holds
+// on to: the data of transferred and shared ArrayBuffers, and the
+// references to ListModel agents.
+void Serialize::release(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+    const char *stream = data.constData();
+    release(stream);
+}
+
 QT_END_NAMESPACE
@@ -16,6 +16,7 @@
 //
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
 #include <private/qv4value_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -26,11 +27,16 @@ class Serialize {
 public:
 
     static QByteArray serialize(const Value &, ExecutionEngine *);
+    static QByteArray serialize(const Value &, const Value &transfer, ExecutionEngine *);
     static ReturnedValue deserialize(const QByteArray &, ExecutionEngine *);
+    static void release(const QByteArray &);
 
 private:
-    static void serialize(QByteArray &, const Value &, ExecutionEngine *);
+    using TransferList = QList<Heap::SharedArrayBuffer *>;
+
+    static void serialize(QByteArray &, const Value &, ExecutionEngine *, const TransferList &);
     static ReturnedValue deserialize(const char *&, ExecutionEngine *);
+    static void release(const char *&);
 };
 
 }
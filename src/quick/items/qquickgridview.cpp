@@ -1608,6 +1608,13 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
 
     The cacheBuffer operates outside of any display margins specified by
     displayMarginBeginning or displayMarginEnd.
+
+    While the view is flicked, delegates further ahead in the direction of
+    travel are also created asynchronously, as far as the velocity of the flick
+    lets the view predict. This only happens if the cacheBuffer is greater than
+    zero. The \c qt.quick.itemview.prefetch logging category reports, for every
+    frame, how many delegates the view needed that had or had not been prepared
+    in advance.
 */
 
 /*!
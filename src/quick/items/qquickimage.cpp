@@ -570,6 +570,11 @@ qreal QQuickImage::paintedHeight() const
     Note that this property is only valid for images read from the
     local filesystem.  Images loaded via a network resource (e.g. HTTP)
     are always loaded asynchronously.
+
+    Since Qt 6.10, local images are decoded by a small pool of threads,
+    whose size can be set with the \c QML_PIXMAP_READER_THREADS environment
+    variable. Images that are visible in their viewport, such as a
+    \l Flickable, are decoded before the ones that are scrolled out of view.
 */
 
 /*!
@@ -578,6 +583,13 @@ qreal QQuickImage::paintedHeight() const
     Specifies whether the image should be cached. The default value is
     true. Setting \a cache to false is useful when dealing with large images,
     to make sure that they aren't cached at the expense of small 'ui element' images.
+
+    Since Qt 6.10, decoded images from the local filesystem can also be kept
+    in a cache on disk, so that they do not need to be decoded again when the
+    application restarts. Set the \c QML_PIXMAP_DISK_CACHE environment
+    variable to \c 1 to use the application's cache location, or
+    \c QML_PIXMAP_DISK_CACHE_PATH to use another directory.
+    \c QML_PIXMAP_DISK_CACHE_SIZE limits its size in megabytes; the default is 256.
 */
 
 /*!
@@ -54,6 +54,55 @@ void QQuickImageBasePrivate::setProgress(qreal value)
     emit q->progressChanged(progress);
 }
 
+/*! \internal
+    While an image loads asynchronously, the item observes the viewport,
+    so that the load can be given a lower priority when the item is scrolled
+    out of view, or a higher one when it comes back.
+*/
+void QQuickImageBasePrivate::setObservesViewportWhileLoading(bool observe)
+{
+    Q_Q(QQuickImageBase);
+
+    if (observe == observesViewportWhileLoading)
+        return;
+    // Leave the flag alone if someone else has set it
+    if (observe && (flags & QQuickItem::ItemObservesViewport))
+        return;
+
+    observesViewportWhileLoading = observe;
+    q->setFlag(QQuickItem::ItemObservesViewport, observe);
+}
+
+void QQuickImageBasePrivate::updateLoadingPriority()
+{
+    Q_Q(QQuickImageBase);
+
+    if (!pendingPix->isLoading())
+        return;
+
+    QQuickPixmap::Priority priority = QQuickPixmap::VisiblePriority;
+    if (!effectiveVisible) {
+        priority = QQuickPixmap::BackgroundPriority;
+    } else if (flags & QQuickItem::ItemObservesViewport) {
+        // The size may not be known until the image is loaded
+        QQuickItem *viewport = q->viewportItem();
+        if (viewport && viewport != q) {
+            const QRectF rect = q->mapRectToItem(viewport, QRectF(0, 0, qMax<qreal>(width, 1),
+                                                                  qMax<qreal>(height, 1)));
+            if (!viewport->clipRect().intersects(rect))
+                priority = QQuickPixmap::PrefetchPriority;
+        }
+    }
+    pendingPix->setPriority(priority);
+}
+
+bool QQuickImageBasePrivate::transformChanged(QQuickItem *transformedItem)
+{
+    if (observesViewportWhileLoading)
+        updateLoadingPriority();
+    return QQuickImplicitSizeItemPrivate::transformChanged(transformedItem);
+}
+
 QQuickImageBase::QQuickImageBase(QQuickItem *parent)
 : QQuickImplicitSizeItem(*(new QQuickImageBasePrivate), parent)
 {
@@ -264,6 +313,7 @@ int QQuickImageBase::frameCount() const
 void QQuickImageBase::loadEmptyUrl()
 {
     Q_D(QQuickImageBase);
+    d->setObservesViewportWhileLoading(false);
     d->currentPix->clear(this);
     d->pendingPix->clear(this);
     d->setProgress(0);
@@ -331,6 +381,11 @@ void QQuickImageBase::loadPixmap(const QUrl &url, LoadPixmapOptions loadOptions)
         d->setProgress(0);
         d->setStatus(Loading);
 
+        if (d->async) {
+            d->setObservesViewportWhileLoading(true);
+            d->updateLoadingPriority();
+        }
+
         static int thisRequestProgress = -1;
         static int thisRequestFinished = -1;
         if (thisRequestProgress == -1) {
@@ -364,6 +419,7 @@ void QQuickImageBase::load()
 void QQuickImageBase::requestFinished()
 {
     Q_D(QQuickImageBase);
+    d->setObservesViewportWhileLoading(false);
     if (d->pendingPix != d->currentPix
         && d->pendingPix->status() != QQuickPixmap::Null
         && d->pendingPix->status() != QQuickPixmap::Loading) {
@@ -413,6 +469,8 @@ void QQuickImageBase::requestProgress(qint64 received, qint64 total)
 void QQuickImageBase::itemChange(ItemChange change, const ItemChangeData &value)
 {
     Q_D(QQuickImageBase);
+    if (change == ItemVisibleHasChanged)
+        d->updateLoadingPriority();
     // If the screen DPI changed, reload image.
     if (change == ItemDevicePixelRatioHasChanged && value.realValue != d->devicePixelRatio) {
         const auto oldDpr = d->devicePixelRatio;
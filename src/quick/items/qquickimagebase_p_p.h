@@ -34,13 +34,18 @@ public:
         mirrorHorizontally(false),
         mirrorVertically(false),
         oldAutoTransform(false),
-        retainWhileLoading(false)
+        retainWhileLoading(false),
+        observesViewportWhileLoading(false)
     {
         pendingPix = &pix1;
         currentPix = &pix1;
     }
 
     virtual bool updateDevicePixelRatio(qreal targetDevicePixelRatio);
+    bool transformChanged(QQuickItem *transformedItem) override;
+
+    void setObservesViewportWhileLoading(bool observe);
+    void updateLoadingPriority();
 
     void setStatus(QQuickImageBase::Status value);
     void setProgress(qreal value);
@@ -68,6 +73,7 @@ public:
     bool mirrorVertically : 1;
     bool oldAutoTransform : 1;
     bool retainWhileLoading : 1;
+    bool observesViewportWhileLoading : 1;
 };
 
 QT_END_NAMESPACE
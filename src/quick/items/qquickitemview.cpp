@@ -3,6 +3,7 @@
 
 #include "qquickitemview_p_p.h"
 #include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
 #include "qquickitemviewfxitem_p_p.h"
 #include <QtQuick/private/qquicktransition_p.h>
 #include <QtQml/QQmlInfo>
@@ -12,6 +13,14 @@ QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(lcItemViewDelegateLifecycle, "qt.quick.itemview.lifecycle")
 Q_STATIC_LOGGING_CATEGORY(lcCount, "qt.quick.itemview.count")
+Q_STATIC_LOGGING_CATEGORY(lcPrefetch, "qt.quick.itemview.prefetch")
+
+// Delegates are prefetched for the distance a flick travels in this time, in seconds
+static const qreal PrefetchHorizon = 0.3;
+// Number of prefetch incubations that can be started in a frame, and be in flight
+static const int PrefetchBudget = 4;
+// Number of delegates that can be held by the prefetcher
+static const int PrefetchLimit = 32;
 
 // Default cacheBuffer for all views.
 #ifndef QML_VIEW_DEFAULTCACHEBUFFER
@@ -964,7 +973,11 @@ void QQuickItemView::forceLayout()
 void QQuickItemViewPrivate::applyPendingChanges()
 {
     Q_Q(QQuickItemView);
-    if (q->isComponentComplete() && currentChanges.hasPendingChanges())
+    if (!q->isComponentComplete())
+        return;
+    if (model)
+        model->deliverCoalescedChanges();
+    if (currentChanges.hasPendingChanges())
         layout();
 }
 
@@ -1713,7 +1726,10 @@ void QQuickItemViewPrivate::clear(bool onDestruction)
     bufferedChanges.reset();
     timeline.clear();
 
-    releaseVisibleItems(QQmlInstanceModel::NotReusable);
+    // When the view goes away together with its model, pool the delegates so
+    // that the model can hand them over to other views using the same delegate.
+    releaseVisibleItems(onDestruction && ownModel && model && model->sharesPooledItems()
+                                ? reusableFlag : QQmlInstanceModel::NotReusable);
     visibleIndex = 0;
 
 #if QT_CONFIG(quick_viewtransitions)
@@ -1736,6 +1752,8 @@ void QQuickItemViewPrivate::clear(bool onDestruction)
             model->cancel(requestedIndex);
         requestedIndex = -1;
     }
+    cancelPrefetchRequests(0, -1);
+    releasePrefetchedItems();
 
     markExtentsDirty();
     itemCount = 0;
@@ -1771,6 +1789,8 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
     Q_Q(QQuickItemView);
     if (!model || !model->isValid() || !q->isComponentComplete())
         return;
+    // Delegates must not be requested at indexes the view has not been told about yet
+    model->deliverCoalescedChanges();
     if (q->size().isNull() && visibleItems.isEmpty())
         return;
     if (!model->count()) {
@@ -1826,6 +1846,129 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
             emitCountChanged();
     } while (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges());
     storeFirstVisibleItemPosition();
+    prefetch();
+}
+
+/*
+  Incubates the delegates a flick is about to reach, beyond the cache buffer.
+  The number of delegates predicted follows the velocity of the flick, and
+  the ones nearest in the direction of travel are requested first. At most
+  PrefetchBudget incubations are started per refill and are in flight, so that
+  prefetching does not starve the delegates the view needs right now.
+*/
+void QQuickItemViewPrivate::prefetch()
+{
+    Q_Q(QQuickItemView);
+
+    if (framePrefetchStats.hits || framePrefetchStats.misses) {
+        qCDebug(lcPrefetch) << "frame: hits" << framePrefetchStats.hits
+                            << "misses" << framePrefetchStats.misses
+                            << "prefetched" << prefetchedItems.size()
+                            << "incubating" << prefetchRequests.size();
+        framePrefetchStats = PrefetchStats();
+    }
+
+    FxViewItem *first = nullptr;
+    FxViewItem *last = nullptr;
+    for (FxViewItem *item : std::as_const(visibleItems)) {
+        if (item->index == -1)
+            continue;
+        if (!first)
+            first = item;
+        last = item;
+    }
+
+    // Prefetching only pays off if delegates are incubated asynchronously
+    const QQmlEngine *engine = qmlEngine(q);
+    const AxisData &axisData = layoutOrientation() == Qt::Vertical ? vData : hData;
+    const bool forwards = bufferMode == BufferAfter;
+    int from = 0;
+    int to = -1;
+    if (axisData.flicking && buffer && first && (forwards || bufferMode == BufferBefore)
+            && engine && engine->incubationController()) {
+        const qreal extent = last->endPosition() - first->position();
+        if (extent > 0) {
+            const qreal itemsPerPixel = (last->index - first->index + 1) / extent;
+            const qreal distance = qAbs(axisData.smoothVelocity.value()) * PrefetchHorizon;
+            const int count = qMin(int((distance - buffer) * itemsPerPixel), PrefetchLimit);
+            if (forwards) {
+                from = last->index + 1;
+                to = qMin(last->index + count, model->count() - 1);
+            } else {
+                from = qMax(first->index - count, 0);
+                to = first->index - 1;
+            }
+        }
+    }
+
+    for (auto it = prefetchedItems.begin(); it != prefetchedItems.end();) {
+        if (it.key() < from || it.key() > to) {
+            model->release(it.value(), reusableFlag);
+            it = prefetchedItems.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    cancelPrefetchRequests(from, to);
+
+    int started = 0;
+    for (int i = 0; i <= to - from; ++i) {
+        if (started == PrefetchBudget || prefetchRequests.size() == PrefetchBudget)
+            break;
+        const int index = forwards ? from + i : to - i;
+        if (index == requestedIndex || prefetchedItems.contains(index) || prefetchRequests.contains(index))
+            continue;
+
+        ++started;
+        inRequest = true;
+        if (QObject *object = model->object(index, QQmlIncubator::Asynchronous))
+            prefetchedItems.insert(index, object); // taken from the reuse pool
+        else if (model->incubationStatus(index) == QQmlIncubator::Loading)
+            prefetchRequests.insert(index);
+        inRequest = false;
+    }
+}
+
+/*
+  Drops the reference the prefetcher holds on the delegate at \a modelIndex,
+  once the view has taken its own. Returns whether the delegate was prefetched.
+*/
+bool QQuickItemViewPrivate::takePrefetchedItem(int modelIndex)
+{
+    QObject *object = prefetchedItems.take(modelIndex);
+    if (!object)
+        return false;
+    model->release(object);
+    return true;
+}
+
+/*
+  Cancels the incubations the prefetcher started for the delegates outside
+  of \a from to \a to, so that they do not use up the incubation time of the
+  frames to come.
+*/
+void QQuickItemViewPrivate::cancelPrefetchRequests(int from, int to)
+{
+    for (auto it = prefetchRequests.begin(); it != prefetchRequests.end();) {
+        const int index = *it;
+        if (index < from || index > to) {
+            if (model && index != requestedIndex && index < model->count())
+                model->cancel(index);
+            it = prefetchRequests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void QQuickItemViewPrivate::releasePrefetchedItems()
+{
+    if (model) {
+        for (QObject *object : std::as_const(prefetchedItems))
+            model->release(object, QQmlInstanceModel::NotReusable);
+    }
+    prefetchedItems.clear();
+    prefetchRequests.clear();
 }
 
 void QQuickItemViewPrivate::regenerate(bool orientationChanged)
@@ -1865,6 +2008,11 @@ void QQuickItemViewPrivate::layout()
     if (inLayout)
         return;
 
+    // Take the model changes that the model has been holding back,
+    // so that they are applied together with any others below.
+    if (model)
+        model->deliverCoalescedChanges();
+
     inLayout = true;
 
     // viewBounds contains bounds before any add/remove/move operation to the view
@@ -2014,6 +2162,10 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
     }
 
     updateUnrequestedIndexes();
+    // The indexes of prefetched delegates are outdated now. The incubations
+    // still in flight can't be cancelled by index anymore; they are handed
+    // over to createdItem() like any other delegate the view did not ask for.
+    releasePrefetchedItems();
 
     FxViewItem *prevVisibleItemsFirst = visibleItems.size() ? *visibleItems.constBegin() : nullptr;
     int prevItemCount = itemCount;
@@ -2036,6 +2188,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
 
     const QVector<QQmlChangeSet::Change> &removals = currentChanges.pendingChanges.removes();
     const QVector<QQmlChangeSet::Change> &insertions = currentChanges.pendingChanges.inserts();
+    modelItemsChanged(removals, insertions);
     ChangeResult insertionResult(prevFirstItemInViewPos);
     ChangeResult removalResult(prevFirstItemInViewPos);
 
@@ -2389,6 +2542,7 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
     // Since we handle this result graciously in our code, we preempt this warning by checking the range ourselves.
     QObject* object = modelIndex < model->count() ? model->object(modelIndex, incubationMode) : nullptr;
     QQuickItem *item = qmlobject_cast<QQuickItem*>(object);
+    const bool prefetched = takePrefetchedItem(modelIndex);
 
     if (!item) {
         if (!object) {
@@ -2412,6 +2566,15 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
         item->setParentItem(q->contentItem());
         if (requestedIndex == modelIndex)
             requestedIndex = -1;
+        if (incubationMode != QQmlIncubator::Asynchronous && q->isMoving()) {
+            if (prefetched) {
+                ++prefetchStats.hits;
+                ++framePrefetchStats.hits;
+            } else {
+                ++prefetchStats.misses;
+                ++framePrefetchStats.misses;
+            }
+        }
         FxViewItem *viewItem = newViewItem(modelIndex, item);
         if (viewItem) {
             viewItem->index = modelIndex;
@@ -2430,6 +2593,15 @@ void QQuickItemView::createdItem(int index, QObject* object)
     Q_D(QQuickItemView);
 
     QQuickItem* item = qmlobject_cast<QQuickItem*>(object);
+    if (d->prefetchRequests.remove(index) && !d->inRequest) {
+        // Hold on to the delegate until the view reaches it
+        d->inRequest = true;
+        if (QObject *prefetched = d->model->object(index, QQmlIncubator::Asynchronous))
+            d->prefetchedItems.insert(index, prefetched);
+        d->inRequest = false;
+        if (index != d->requestedIndex)
+            return;
+    }
     if (!d->inRequest) {
         d->unrequestedItems.insert(item, index);
         d->requestedIndex = -1;
@@ -30,6 +30,7 @@ QT_REQUIRE_CONFIG(quick_itemview);
 #include <QtQmlModels/private/qqmlchangeset_p.h>
 
 #include <QtCore/qpointer.h>
+#include <QtCore/qset.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -145,6 +146,10 @@ public:
     void mirrorChange() override;
 
     FxViewItem *createItem(int modelIndex,QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
+    void prefetch();
+    bool takePrefetchedItem(int modelIndex);
+    void cancelPrefetchRequests(int from, int to);
+    void releasePrefetchedItems();
     bool releaseCurrentItem(QQmlInstanceModel::ReusableFlag reusableFlag)
     {
         auto oldCurrentItem = std::exchange(currentItem, nullptr);
@@ -208,6 +213,8 @@ public:
     }
 
     void refillOrLayout() {
+        if (model)
+            model->deliverCoalescedChanges();
         if (hasPendingChanges())
             layout();
         else
@@ -256,6 +263,18 @@ public:
     FxViewItem *trackedItem;
     QHash<QQuickItem*,int> unrequestedItems;
     int requestedIndex;
+
+    // Delegates incubated ahead of a flick, beyond the cache buffer. The view
+    // holds a reference on each of them until it needs them or they fall out
+    // of the predicted range.
+    QHash<int, QObject *> prefetchedItems;
+    QSet<int> prefetchRequests;
+    struct PrefetchStats {
+        int hits = 0;   // delegates needed while moving that had been prefetched
+        int misses = 0; // delegates needed while moving that had to be created
+    };
+    PrefetchStats prefetchStats;
+    PrefetchStats framePrefetchStats;
     QQuickItemViewChangeSet currentChanges;
     QQuickItemViewChangeSet bufferedChanges;
     QPauseAnimationJob bufferPause;
@@ -354,6 +373,7 @@ protected:
                 QList<FxViewItem *> *newItems, QList<MovedItem> *movingIntoView) = 0;
 
     virtual bool needsRefillForAddedOrRemovedIndex(int) const { return false; }
+    virtual void modelItemsChanged(const QVector<QQmlChangeSet::Change> &, const QVector<QQmlChangeSet::Change> &) {}
 #if QT_CONFIG(quick_viewtransitions)
     virtual void translateAndTransitionItemsAfter(int afterIndex, const ChangeResult &insertionResult, const ChangeResult &removalResult) = 0;
 #endif
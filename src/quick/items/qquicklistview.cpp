@@ -4,6 +4,7 @@
 #include "qquicklistview_p.h"
 #include "qquickitemview_p_p.h"
 #include "qquickflickablebehavior_p.h"
+#include "qquicklistviewsizeindex_p_p.h"
 
 #include <private/qqmlobjectmodel_p.h>
 #include <QtQml/qqmlexpression.h>
@@ -41,6 +42,7 @@ public:
     qreal endPositionAt(int index) const override;
     qreal originPosition() const override;
     qreal lastPosition() const override;
+    qreal estimatedExtent(int from, int to) const;
 
     FxViewItem *itemBefore(int modelIndex) const;
     QString sectionAt(int modelIndex);
@@ -74,6 +76,7 @@ public:
     void layoutVisibleItems(int fromModelIndex = 0) override;
 
     bool applyInsertionChange(const QQmlChangeSet::Change &insert, ChangeResult *changeResult, QList<FxViewItem *> *addedItems, QList<MovedItem> *movingIntoView) override;
+    void modelItemsChanged(const QVector<QQmlChangeSet::Change> &removals, const QVector<QQmlChangeSet::Change> &insertions) override;
 #if QT_CONFIG(quick_viewtransitions)
     void translateAndTransitionItemsAfter(int afterIndex, const ChangeResult &insertionResult, const ChangeResult &removalResult) override;
 #endif
@@ -102,6 +105,7 @@ public:
     void initializeCurrentItem() override;
 
     void updateAverage();
+    void updateItemSizes();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override;
     void fixupPosition() override;
@@ -145,6 +149,9 @@ public:
 
     qreal overshootDist;
 
+    // The sizes of all items seen so far, when trackItemSizes is set
+    QQuickListViewSizeIndex sizeIndex;
+
     qreal desiredViewportPosition;
     qreal fixupHeaderPosition;
     bool headerNeedsSeparateFixup : 1;
@@ -153,6 +160,7 @@ public:
     bool correctFlick : 1;
     bool inFlickCorrection : 1;
     bool wantedMousePress : 1;
+    bool trackItemSizes : 1;
 
     QQuickListViewPrivate()
         : orient(QQuickListView::Vertical)
@@ -167,6 +175,7 @@ public:
         , overshootDist(0.0), desiredViewportPosition(0.0), fixupHeaderPosition(0.0)
         , headerNeedsSeparateFixup(false), desiredHeaderVisible(false)
         , correctFlick(false), inFlickCorrection(false), wantedMousePress(false)
+        , trackItemSizes(false)
     {
         highlightMoveDuration = -1; //override default value set in base class
     }
@@ -490,7 +499,7 @@ qreal QQuickListViewPrivate::originPosition() const
     if (!visibleItems.isEmpty()) {
         pos = (*visibleItems.constBegin())->position();
         if (visibleIndex > 0)
-            pos -= visibleIndex * (averageSize + spacing);
+            pos -= estimatedExtent(0, visibleIndex);
     }
     return pos;
 }
@@ -517,13 +526,25 @@ qreal QQuickListViewPrivate::lastPosition() const
         }
         pos = (*(visibleItems.constEnd() - 1))->endPosition();
         if (invisibleCount > 0)
-            pos += invisibleCount * (averageSize + spacing);
+            pos += estimatedExtent(model->count() - invisibleCount, model->count());
     } else if (model && model->count()) {
-        pos = (model->count() * averageSize + (model->count()-1) * spacing);
+        pos = estimatedExtent(0, model->count()) - spacing;
     }
     return pos;
 }
 
+/*
+    Returns the distance from the start of the item at \a from to the start
+    of the item at \a to, including spacing. Unless trackItemSizes is set,
+    every item is assumed to have the average size.
+*/
+qreal QQuickListViewPrivate::estimatedExtent(int from, int to) const
+{
+    if (trackItemSizes)
+        return sizeIndex.extent(from, to, averageSize, spacing);
+    return (to - from) * (averageSize + spacing);
+}
+
 qreal QQuickListViewPrivate::positionAt(int modelIndex) const
 {
     if (FxViewItem *item = visibleItem(modelIndex)) {
@@ -531,16 +552,16 @@ qreal QQuickListViewPrivate::positionAt(int modelIndex) const
     }
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
+            int from = modelIndex;
             qreal cs = 0;
             if (modelIndex == currentIndex && currentItem) {
                 cs = currentItem->size() + spacing;
-                --count;
+                ++from;
             }
-            return (*visibleItems.constBegin())->position() - count * (averageSize + spacing) - cs;
+            return (*visibleItems.constBegin())->position() - estimatedExtent(from, visibleIndex) - cs;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(visibleItems.constEnd() - 1))->endPosition() + spacing + count * (averageSize + spacing);
+            int from = findLastVisibleIndex(visibleIndex) + 1;
+            return (*(visibleItems.constEnd() - 1))->endPosition() + spacing + estimatedExtent(from, modelIndex);
         }
     }
     return 0;
@@ -552,11 +573,10 @@ qreal QQuickListViewPrivate::endPositionAt(int modelIndex) const
         return item->endPosition();
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
-            return (*visibleItems.constBegin())->position() - (count - 1) * (averageSize + spacing) - spacing;
+            return (*visibleItems.constBegin())->position() - estimatedExtent(modelIndex + 1, visibleIndex) - spacing;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(visibleItems.constEnd() - 1))->endPosition() + count * (averageSize + spacing);
+            int from = findLastVisibleIndex(visibleIndex) + 1;
+            return (*(visibleItems.constEnd() - 1))->endPosition() + estimatedExtent(from, modelIndex);
         }
     }
     return 0;
@@ -650,6 +670,7 @@ void QQuickListViewPrivate::clear(bool onDestruction)
     releaseSectionItem(nextSectionItem);
     nextSectionItem = nullptr;
     lastVisibleSection = QString();
+    sizeIndex.reset();
     QQuickItemViewPrivate::clear(onDestruction);
 }
 
@@ -740,14 +761,19 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         || bufferTo < visiblePos - averageSize - spacing)) {
         // We've jumped more than a page.  Estimate which items are now
         // visible and fill from there.
-        int count = (fillFrom - itemEnd) / (averageSize + spacing);
-        int newModelIdx = qBound(0, modelIndex + count, model->count());
-        count = newModelIdx - modelIndex;
-        if (count) {
+        int newModelIdx = modelIndex;
+        if (trackItemSizes) {
+            const qreal extent = sizeIndex.extent(0, modelIndex, averageSize, spacing) + fillFrom - itemEnd;
+            newModelIdx = sizeIndex.indexAt(extent, averageSize, spacing);
+        } else {
+            newModelIdx += int((fillFrom - itemEnd) / (averageSize + spacing));
+        }
+        newModelIdx = qBound(0, newModelIdx, model->count());
+        if (newModelIdx != modelIndex) {
             releaseVisibleItems(reusableFlag);
+            visiblePos = itemEnd + estimatedExtent(modelIndex, newModelIdx);
             modelIndex = newModelIdx;
             visibleIndex = modelIndex;
-            visiblePos = itemEnd + count * (averageSize + spacing);
             itemEnd = visiblePos;
         }
     }
@@ -906,6 +932,7 @@ void QQuickListViewPrivate::layoutVisibleItems(int fromModelIndex)
             fixedCurrent = fixedCurrent || (currentItem && item->item == currentItem->item);
         }
         averageSize = qRound(sum / visibleItems.size());
+        updateItemSizes();
 
         // move current item if it is not a visible item.
         if (currentIndex >= 0 && currentItem && !fixedCurrent)
@@ -1434,6 +1461,43 @@ void QQuickListViewPrivate::updateAverage()
     for (FxViewItem *item : std::as_const(visibleItems))
         sum += item->size();
     averageSize = qRound(sum / visibleItems.size());
+    updateItemSizes();
+}
+
+void QQuickListViewPrivate::updateItemSizes()
+{
+    if (!trackItemSizes)
+        return;
+    if (!currentChanges.active)
+        sizeIndex.resize(itemCount);
+    for (FxViewItem *item : std::as_const(visibleItems)) {
+        if (item->index >= 0)
+            sizeIndex.setSize(item->index, item->size());
+    }
+}
+
+void QQuickListViewPrivate::modelItemsChanged(const QVector<QQmlChangeSet::Change> &removals, const QVector<QQmlChangeSet::Change> &insertions)
+{
+    if (!trackItemSizes)
+        return;
+
+    // Carry the sizes of moved items over to their new indexes
+    QHash<int, QList<qreal>> movedSizes;
+    for (const QQmlChangeSet::Change &removal : removals) {
+        if (removal.isMove()) {
+            QList<qreal> &sizes = movedSizes[removal.moveId];
+            if (sizes.size() < removal.offset + removal.count)
+                sizes.resize(removal.offset + removal.count, -1);
+            const QList<qreal> removed = sizeIndex.sizes(removal.index, removal.count);
+            std::copy(removed.cbegin(), removed.cend(), sizes.begin() + removal.offset);
+        }
+        sizeIndex.remove(removal.index, removal.count);
+    }
+    for (const QQmlChangeSet::Change &insertion : insertions) {
+        sizeIndex.insert(insertion.index, insertion.count);
+        if (insertion.isMove())
+            sizeIndex.setSizes(insertion.index, movedSizes.value(insertion.moveId).mid(insertion.offset, insertion.count));
+    }
 }
 
 qreal QQuickListViewPrivate::headerSize() const
@@ -2245,6 +2309,17 @@ QQuickItemViewAttached *QQuickListViewPrivate::getAttachedObject(const QObject *
     of the view, \e including the extra margins set with \l {ListView::}{cacheBuffer}.
     Some items will also never be pooled or reused, such as \l currentItem.
 
+    Since 6.10, items can also be shared between several views that use the
+    same \l delegate component, for example views on different pages of a tab
+    bar that are loaded and unloaded. Set the \c QML_SHARED_DELEGATE_POOL_SIZE
+    environment variable to the maximum number of items to keep in a pool
+    shared by all views of a QQmlEngine. Items that are drained from the reuse
+    pool of a view, or that are pooled when a view is destroyed, are then moved
+    to the shared pool, from which other views can reuse them. The least
+    recently pooled items are destroyed first when the pool is full. Only
+    delegates without \l {Required Properties}{required properties} can be
+    shared this way.
+
     The following example shows a delegate that animates a spinning rectangle. When
     it is pooled, the animation is temporarily paused:
 
@@ -2767,6 +2842,13 @@ void QQuickListView::setOrientation(QQuickListView::Orientation orientation)
 
     The cacheBuffer operates outside of any display margins specified by
     displayMarginBeginning or displayMarginEnd.
+
+    While the view is flicked, delegates further ahead in the direction of
+    travel are also created asynchronously, as far as the velocity of the flick
+    lets the view predict. This only happens if the cacheBuffer is greater than
+    zero. The \c qt.quick.itemview.prefetch logging category reports, for every
+    frame, how many delegates the view needed that had or had not been prepared
+    in advance.
 */
 
 /*!
@@ -3158,6 +3240,86 @@ void QQuickListView::setFooterPositioning(QQuickListView::FooterPositioning posi
     }
 }
 
+/*!
+    \qmlproperty bool QtQuick::ListView::trackItemSizes
+    \since 6.10
+
+    This property determines whether the view remembers the size of every
+    delegate it has created.
+
+    By default, ListView only knows the sizes of the delegates that currently
+    exist, and assumes that all other delegates have their average size. When
+    the delegates vary a lot in size, this makes the \l contentHeight (or
+    \l contentWidth) and the positions computed by positionViewAtIndex()
+    inaccurate, and the content jumps as delegates are created.
+
+    When this property is \c true, the view keeps the sizes that it has
+    measured, and any hints given with setItemSizeHints(), in an index that
+    maps between model indexes and positions in logarithmic time. Only items
+    whose size is still unknown are assumed to have the average size. The
+    index costs a few bytes of memory per model item.
+
+    The recorded sizes follow the items when they are moved, and are
+    discarded when the model is reset.
+
+    The default value is \c false.
+
+    \sa setItemSizeHints()
+*/
+bool QQuickListView::trackItemSizes() const
+{
+    Q_D(const QQuickListView);
+    return d->trackItemSizes;
+}
+
+void QQuickListView::setTrackItemSizes(bool track)
+{
+    Q_D(QQuickListView);
+    if (d->trackItemSizes == track)
+        return;
+
+    d->applyPendingChanges();
+    d->trackItemSizes = track;
+    d->sizeIndex.reset();
+    d->updateItemSizes();
+    d->markExtentsDirty();
+    d->forceLayoutPolish();
+    emit trackItemSizesChanged();
+}
+
+/*!
+    \qmlmethod QtQuick::ListView::setItemSizeHints(int index, list<real> sizes)
+    \since 6.10
+
+    Sets the expected sizes of the items starting at \a index to \a sizes,
+    along the orientation of the view. A negative size marks the size of an
+    item as unknown.
+
+    This lets a view whose model knows the sizes of its items in advance,
+    such as a list of messages with known line counts, lay out its whole
+    content accurately before the delegates are created. A hint is replaced
+    by the measured size of the item when its delegate is created.
+
+    This method only has an effect when \l trackItemSizes is \c true.
+*/
+void QQuickListView::setItemSizeHints(int index, const QList<qreal> &sizes)
+{
+    Q_D(QQuickListView);
+    if (!d->trackItemSizes) {
+        qmlWarning(this) << tr("setItemSizeHints() requires trackItemSizes to be enabled");
+        return;
+    }
+    if (!d->model || index < 0 || index >= d->model->count())
+        return;
+
+    d->applyPendingChanges();
+    if (d->sizeIndex.count() != d->model->count())
+        d->sizeIndex.resize(d->model->count());
+    d->sizeIndex.setSizes(index, sizes);
+    d->markExtentsDirty();
+    d->forceLayoutPolish();
+}
+
 /*!
     \qmlproperty Transition QtQuick::ListView::populate
 
@@ -97,6 +97,8 @@ class Q_QUICK_EXPORT QQuickListView : public QQuickItemView
     Q_PROPERTY(HeaderPositioning headerPositioning READ headerPositioning WRITE setHeaderPositioning NOTIFY headerPositioningChanged REVISION(2, 4))
     Q_PROPERTY(FooterPositioning footerPositioning READ footerPositioning WRITE setFooterPositioning NOTIFY footerPositioningChanged REVISION(2, 4))
 
+    Q_PROPERTY(bool trackItemSizes READ trackItemSizes WRITE setTrackItemSizes NOTIFY trackItemSizesChanged REVISION(6, 10) FINAL)
+
     Q_CLASSINFO("DefaultProperty", "data")
     QML_NAMED_ELEMENT(ListView)
     QML_ADDED_IN_VERSION(2, 0)
@@ -145,6 +147,11 @@ public:
     FooterPositioning footerPositioning() const;
     void setFooterPositioning(FooterPositioning positioning);
 
+    bool trackItemSizes() const;
+    void setTrackItemSizes(bool track);
+
+    Q_REVISION(6, 10) Q_INVOKABLE void setItemSizeHints(int index, const QList<qreal> &sizes);
+
     static QQuickListViewAttached *qmlAttachedProperties(QObject *);
 
 public Q_SLOTS:
@@ -161,6 +168,7 @@ Q_SIGNALS:
     void snapModeChanged();
     Q_REVISION(2, 4) void headerPositioningChanged();
     Q_REVISION(2, 4) void footerPositioningChanged();
+    Q_REVISION(6, 10) void trackItemSizesChanged();
 
 protected:
     void viewportMoved(Qt::Orientations orient) override;
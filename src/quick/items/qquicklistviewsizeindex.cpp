@@ -0,0 +1,196 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquicklistviewsizeindex_p_p.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qmath.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+static inline int lowestBit(int i)
+{
+    return i & -i;
+}
+
+void QQuickListViewSizeIndex::reset()
+{
+    m_sizes.clear();
+    m_sizeTree.clear();
+    m_knownTree.clear();
+    m_dirty = false;
+}
+
+void QQuickListViewSizeIndex::resize(int count)
+{
+    if (count == m_sizes.size())
+        return;
+    m_sizes.resize(qMax(0, count), -1);
+    m_dirty = true;
+}
+
+void QQuickListViewSizeIndex::insert(int index, int count)
+{
+    if (index < 0 || index > m_sizes.size() || count <= 0)
+        return;
+    m_sizes.insert(index, count, -1);
+    m_dirty = true;
+}
+
+void QQuickListViewSizeIndex::remove(int index, int count)
+{
+    if (index < 0 || index >= m_sizes.size() || count <= 0)
+        return;
+    m_sizes.remove(index, qMin<qsizetype>(count, m_sizes.size() - index));
+    m_dirty = true;
+}
+
+QList<qreal> QQuickListViewSizeIndex::sizes(int index, int count) const
+{
+    if (index < 0 || index >= m_sizes.size())
+        return QList<qreal>();
+    return m_sizes.mid(index, count);
+}
+
+void QQuickListViewSizeIndex::setSizes(int index, const QList<qreal> &sizes)
+{
+    if (index < 0 || index >= m_sizes.size())
+        return;
+
+    const qsizetype count = qMin(sizes.size(), m_sizes.size() - index);
+    if (!m_dirty && count < m_sizes.size() / 16) {
+        // Cheaper to update the trees than to rebuild them
+        for (qsizetype i = 0; i < count; ++i)
+            setSize(index + i, sizes.at(i));
+        return;
+    }
+
+    std::copy(sizes.cbegin(), sizes.cbegin() + count, m_sizes.begin() + index);
+    m_dirty = true;
+}
+
+qreal QQuickListViewSizeIndex::size(int index) const
+{
+    return index >= 0 && index < m_sizes.size() ? m_sizes.at(index) : -1;
+}
+
+void QQuickListViewSizeIndex::setSize(int index, qreal size)
+{
+    if (index < 0 || index >= m_sizes.size())
+        return;
+
+    const qreal oldSize = m_sizes.at(index);
+    if (oldSize == size)
+        return;
+    m_sizes[index] = size;
+    if (m_dirty)
+        return;
+
+    const qreal sizeDelta = qMax<qreal>(size, 0) - qMax<qreal>(oldSize, 0);
+    const int knownDelta = int(size >= 0) - int(oldSize >= 0);
+    for (int i = index + 1; i <= m_sizes.size(); i += lowestBit(i)) {
+        m_sizeTree[i] += sizeDelta;
+        m_knownTree[i] += knownDelta;
+    }
+}
+
+/*
+    Returns the distance from the start of item \a from to the start of item
+    \a to. Every item counts with its size plus \a spacing, and the items with
+    an unknown size, including those outside of the index, count with
+    \a estimatedSize.
+*/
+qreal QQuickListViewSizeIndex::extent(int from, int to, qreal estimatedSize, qreal spacing) const
+{
+    return extentBefore(to, estimatedSize, spacing) - extentBefore(from, estimatedSize, spacing);
+}
+
+/*
+    Returns the index of the item that covers \a extent, measured from the
+    start of the first item. Positions outside of the index are extrapolated
+    from \a estimatedSize, and can result in indexes that are negative or
+    beyond count().
+*/
+int QQuickListViewSizeIndex::indexAt(qreal extent, qreal estimatedSize, qreal spacing) const
+{
+    const qreal estimatedExtent = estimatedSize + spacing;
+    if (extent < 0)
+        return estimatedExtent > 0 ? qFloor(extent / estimatedExtent) : -1;
+
+    if (m_dirty)
+        rebuild();
+
+    // Descend the trees, skipping over every node that ends before extent
+    const int count = m_sizes.size();
+    int index = 0;
+    qreal skipped = 0;
+    for (int step = count > 0 ? 1 << (31 - qCountLeadingZeroBits(quint32(count))) : 0; step > 0; step >>= 1) {
+        const int next = index + step;
+        if (next > count)
+            continue;
+        const qreal nodeExtent = m_sizeTree.at(next) + (step - m_knownTree.at(next)) * estimatedSize
+                + step * spacing;
+        if (skipped + nodeExtent <= extent) {
+            index = next;
+            skipped += nodeExtent;
+        }
+    }
+
+    if (index == count && estimatedExtent > 0)
+        index += qFloor((extent - skipped) / estimatedExtent);
+    return index;
+}
+
+qreal QQuickListViewSizeIndex::knownSizeBefore(int index) const
+{
+    qreal size = 0;
+    for (int i = index; i > 0; i -= lowestBit(i))
+        size += m_sizeTree.at(i);
+    return size;
+}
+
+int QQuickListViewSizeIndex::knownCountBefore(int index) const
+{
+    int count = 0;
+    for (int i = index; i > 0; i -= lowestBit(i))
+        count += m_knownTree.at(i);
+    return count;
+}
+
+qreal QQuickListViewSizeIndex::extentBefore(int index, qreal estimatedSize, qreal spacing) const
+{
+    if (index <= 0)
+        return index * (estimatedSize + spacing);
+
+    if (m_dirty)
+        rebuild();
+
+    const int indexed = qMin(index, int(m_sizes.size()));
+    return knownSizeBefore(indexed) + (indexed - knownCountBefore(indexed)) * estimatedSize
+            + indexed * spacing + (index - indexed) * (estimatedSize + spacing);
+}
+
+void QQuickListViewSizeIndex::rebuild() const
+{
+    // Build both trees bottom-up in O(n), by adding each node to its parent
+    const int count = m_sizes.size();
+    m_sizeTree.fill(0, count + 1);
+    m_knownTree.fill(0, count + 1);
+    for (int i = 1; i <= count; ++i) {
+        const qreal size = m_sizes.at(i - 1);
+        if (size >= 0) {
+            m_sizeTree[i] += size;
+            m_knownTree[i] += 1;
+        }
+        const int parent = i + lowestBit(i);
+        if (parent <= count) {
+            m_sizeTree[parent] += m_sizeTree.at(i);
+            m_knownTree[parent] += m_knownTree.at(i);
+        }
+    }
+    m_dirty = false;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKLISTVIEWSIZEINDEX_P_P_H
+#define QQUICKLISTVIEWSIZEINDEX_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+#include <QtCore/qlist.h>
+
+QT_REQUIRE_CONFIG(quick_listview);
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Keeps the sizes of the items in a ListView, indexed by model index, in
+    a pair of Fenwick trees: one summing the sizes that are known, and one
+    counting them. Items without a known size are assumed to have the size
+    that the view estimates (averageSize), which can change at any time
+    without having to touch the trees.
+
+    Mapping between an index and its position is O(log n). Inserting and
+    removing items marks the trees as dirty, and they are rebuilt in O(n)
+    the next time they are needed.
+*/
+class Q_QUICK_AUTOTEST_EXPORT QQuickListViewSizeIndex
+{
+public:
+    int count() const { return int(m_sizes.size()); }
+    void reset();
+    void resize(int count);
+
+    void insert(int index, int count);
+    void remove(int index, int count);
+    QList<qreal> sizes(int index, int count) const;
+    void setSizes(int index, const QList<qreal> &sizes);
+
+    qreal size(int index) const;
+    void setSize(int index, qreal size);
+    bool isKnown(int index) const { return size(index) >= 0; }
+
+    qreal extent(int from, int to, qreal estimatedSize, qreal spacing) const;
+    int indexAt(qreal extent, qreal estimatedSize, qreal spacing) const;
+
+private:
+    qreal knownSizeBefore(int index) const;
+    int knownCountBefore(int index) const;
+    qreal extentBefore(int index, qreal estimatedSize, qreal spacing) const;
+    void rebuild() const;
+
+    // A negative size means that the size of the item is not known
+    QList<qreal> m_sizes;
+    mutable QList<qreal> m_sizeTree;
+    mutable QList<int> m_knownTree;
+    mutable bool m_dirty = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKLISTVIEWSIZEINDEX_P_P_H
@@ -1946,6 +1946,10 @@ void QQuickPathView::refill()
         return;
     }
 
+    // Delegates must not be requested at indexes the view has not been told about yet
+    if (d->model && isComponentComplete())
+        d->model->deliverCoalescedChanges();
+
     d->layoutScheduled = false;
 
     if (!d->isValid() || !isComponentComplete())
@@ -352,6 +352,11 @@ void QQuickRepeater::regenerate()
     if (!isComponentComplete())
         return;
 
+    // Take the changes the model holds back, so they are not applied again
+    // to the items created below
+    if (d->model)
+        d->model->deliverCoalescedChanges();
+
     clear();
 
     if (!d->model || !d->model->count() || !d->model->isValid() || !parentItem() || !isComponentComplete())
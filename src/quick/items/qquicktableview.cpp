@@ -132,6 +132,11 @@
     \note While an item is in the pool, it might still be alive and respond
     to connected signals and bindings.
 
+    Since 6.10, items can also be shared with other views that use the same
+    \l delegate component, if the \c QML_SHARED_DELEGATE_POOL_SIZE environment
+    variable is set. See \l {ListView#Reusing Items}{Reusing Items in ListView}
+    for details.
+
     The following example shows a delegate that animates a spinning rectangle. When
     it is pooled, the animation is temporarily paused:
 
@@ -442,6 +447,14 @@
     You can check for this by calling \l {isRowLoaded()}{isRowLoaded(row)},
     and simply return -1 if that is not yet the case.
 
+    Since Qt 6.10, the property can also hold a C++ object that implements
+    the \c QQuickTableViewSizeProvider interface. TableView then gets the row
+    heights without calling into JavaScript, and looks up which rows are at
+    a given position in logarithmic time. This keeps flicking far, and
+    \l positionViewAtRow(), fast in tables with millions of rows, and makes
+    \l contentHeight exact. Call \l forceLayout() when the heights returned
+    by the object change.
+
     \sa rowHeightProvider, isRowLoaded(), {Row heights and column widths}
 */
 
@@ -466,6 +479,12 @@
     You can check for this by calling \l {isColumnLoaded}{isColumnLoaded(column)},
     and simply return -1 if that is not yet the case.
 
+    Since Qt 6.10, the property can also hold a C++ object that implements
+    the \c QQuickTableViewSizeProvider interface. TableView then gets the
+    column widths without calling into JavaScript, and looks up which columns
+    are at a given position in logarithmic time. Call \l forceLayout() when
+    the widths returned by the object change.
+
     \sa rowHeightProvider, isColumnLoaded(), {Row heights and column widths}
 */
 
@@ -1672,10 +1691,17 @@ QQuickTableViewPrivate::~QQuickTableViewPrivate()
     if (editModel)
         delete editModel;
 
+    // Pool the delegates rather than deleting them, if the model can hand
+    // them over to other views using the same delegate.
+    const bool shareItems = tableModel && reusableFlag == QQmlTableInstanceModel::Reusable
+            && tableModel->sharesPooledItems();
+
     for (auto *fxTableItem : loadedItems) {
         if (auto item = fxTableItem->item) {
             if (fxTableItem->ownItem)
                 delete item;
+            else if (shareItems)
+                tableModel->release(item, QQmlTableInstanceModel::Reusable);
             else if (tableModel)
                 tableModel->dispose(item);
         }
@@ -2418,9 +2444,14 @@ void QQuickTableViewPrivate::updateContentWidth()
 
     const int nextColumn = nextVisibleEdgeIndexAroundLoadedTable(Qt::RightEdge);
     const int columnsRemaining = nextColumn == kEdgeIndexAtEnd ? 0 : tableSize.width() - nextColumn;
-    const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-    const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-    const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+    qreal estimatedRemainingWidth = 0;
+    if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Horizontal); index && columnsRemaining > 0) {
+        estimatedRemainingWidth = index->extent(nextColumn, tableSize.width(), averageEdgeSize.width(), cellSpacing.width());
+    } else {
+        const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
+        const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
+        estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+    }
     const qreal estimatedWidth = loadedTableOuterRect.right() + estimatedRemainingWidth;
 
     QScopedValueRollback fixupGuard(inUpdateContentSize, true);
@@ -2454,9 +2485,14 @@ void QQuickTableViewPrivate::updateContentHeight()
 
     const int nextRow = nextVisibleEdgeIndexAroundLoadedTable(Qt::BottomEdge);
     const int rowsRemaining = nextRow == kEdgeIndexAtEnd ? 0 : tableSize.height() - nextRow;
-    const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
-    const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-    const qreal estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+    qreal estimatedRemainingHeight = 0;
+    if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Vertical); index && rowsRemaining > 0) {
+        estimatedRemainingHeight = index->extent(nextRow, tableSize.height(), averageEdgeSize.height(), cellSpacing.height());
+    } else {
+        const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
+        const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
+        estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+    }
     const qreal estimatedHeight = loadedTableOuterRect.bottom() + estimatedRemainingHeight;
 
     QScopedValueRollback fixupGuard(inUpdateContentSize, true);
@@ -2749,6 +2785,7 @@ QQuickTableViewPrivate::RebuildOptions QQuickTableViewPrivate::checkForVisibilit
 void QQuickTableViewPrivate::forceLayout(bool immediate)
 {
     clearEdgeSizeCache();
+    clearSizeIndexes();
     RebuildOptions rebuildOptions = RebuildOption::None;
 
     const QSize actualTableSize = calculateTableSize();
@@ -3187,7 +3224,11 @@ qreal QQuickTableViewPrivate::getColumnWidth(int column) const
 
     qreal columnWidth = noExplicitColumnWidth;
 
-    if (columnWidthProvider.isCallable()) {
+    if (const QQuickTableViewSizeProvider *provider = sizeProvider(Qt::Horizontal)) {
+        columnWidth = provider->sizeAt(column);
+        if (qIsNaN(columnWidth) || columnWidth < 0)
+            columnWidth = noExplicitColumnWidth;
+    } else if (columnWidthProvider.isCallable()) {
         auto const columnAsArgument = QJSValueList() << QJSValue(column);
         columnWidth = columnWidthProvider.call(columnAsArgument).toNumber();
         if (qIsNaN(columnWidth) || columnWidth < 0)
@@ -3233,7 +3274,11 @@ qreal QQuickTableViewPrivate::getRowHeight(int row) const
 
     qreal rowHeight = noExplicitRowHeight;
 
-    if (rowHeightProvider.isCallable()) {
+    if (const QQuickTableViewSizeProvider *provider = sizeProvider(Qt::Vertical)) {
+        rowHeight = provider->sizeAt(row);
+        if (qIsNaN(rowHeight) || rowHeight < 0)
+            rowHeight = noExplicitRowHeight;
+    } else if (rowHeightProvider.isCallable()) {
         auto const rowAsArgument = QJSValueList() << QJSValue(row);
         rowHeight = rowHeightProvider.call(rowAsArgument).toNumber();
         if (qIsNaN(rowHeight) || rowHeight < 0)
@@ -3251,6 +3296,40 @@ qreal QQuickTableViewPrivate::getRowHeight(int row) const
     return rowHeight;
 }
 
+const QQuickTableViewSizeProvider *QQuickTableViewPrivate::sizeProvider(Qt::Orientation orientation) const
+{
+    // Return the provider if the application assigned an object that implements
+    // QQuickTableViewSizeProvider to rowHeightProvider or columnWidthProvider,
+    // which lets us get the sizes without calling into JavaScript.
+    const QJSValue &provider = orientation == Qt::Horizontal ? columnWidthProvider : rowHeightProvider;
+    return qobject_cast<QQuickTableViewSizeProvider *>(provider.toQObject());
+}
+
+const QQuickTableViewSizeIndex *QQuickTableViewPrivate::sizeIndex(Qt::Orientation orientation) const
+{
+    // Return an index that maps between the rows (or columns) and their
+    // positions, or nullptr if there is no native size provider to build it
+    // from. Building the index asks the provider for the size of every row,
+    // which is why it's not done for JavaScript providers.
+    const QQuickTableViewSizeProvider *provider = sizeProvider(orientation);
+    QQuickTableViewSizeIndex &index = orientation == Qt::Horizontal ? columnSizeIndex : rowSizeIndex;
+    if (!provider) {
+        index.clear();
+        return nullptr;
+    }
+
+    const int count = orientation == Qt::Horizontal ? tableSize.width() : tableSize.height();
+    if (index.provider() != provider || index.count() != count)
+        index.build(provider, count);
+    return &index;
+}
+
+void QQuickTableViewPrivate::clearSizeIndexes()
+{
+    rowSizeIndex.clear();
+    columnSizeIndex.clear();
+}
+
 qreal QQuickTableViewPrivate::getAlignmentContentX(int column, Qt::Alignment alignment, const qreal offset, const QRectF &subRect)
 {
     Q_Q(QQuickTableView);
@@ -3763,13 +3842,23 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
                 return;
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftColumn) {
-            // Guesstimate new top left
-            const int newColumn = int(viewportRect.x() / (averageEdgeSize.width() + cellSpacing.width()));
-            topLeftCell.rx() = qBound(0, newColumn, tableSize.width() - 1);
-            topLeftPos.rx() = topLeftCell.x() * (averageEdgeSize.width() + cellSpacing.width());
+            if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Horizontal)) {
+                // Look up the new top left from the sizes given by the provider
+                const int newColumn = index->indexAt(viewportRect.x(), averageEdgeSize.width(), cellSpacing.width());
+                topLeftCell.rx() = qBound(0, newColumn, tableSize.width() - 1);
+                topLeftPos.rx() = index->extent(0, topLeftCell.x(), averageEdgeSize.width(), cellSpacing.width());
+            } else {
+                // Guesstimate new top left
+                const int newColumn = int(viewportRect.x() / (averageEdgeSize.width() + cellSpacing.width()));
+                topLeftCell.rx() = qBound(0, newColumn, tableSize.width() - 1);
+                topLeftPos.rx() = topLeftCell.x() * (averageEdgeSize.width() + cellSpacing.width());
+            }
         } else if (rebuildOptions & RebuildOption::PositionViewAtColumn) {
             topLeftCell.rx() = qBound(0, positionViewAtColumnAfterRebuild, tableSize.width() - 1);
-            topLeftPos.rx() = qFloor(topLeftCell.x()) * (averageEdgeSize.width() + cellSpacing.width());
+            if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Horizontal))
+                topLeftPos.rx() = index->extent(0, topLeftCell.x(), averageEdgeSize.width(), cellSpacing.width());
+            else
+                topLeftPos.rx() = qFloor(topLeftCell.x()) * (averageEdgeSize.width() + cellSpacing.width());
         } else {
             // Keep the current top left, unless it's outside model
             topLeftCell.rx() = qBound(0, leftColumn(), tableSize.width() - 1);
@@ -3789,13 +3878,23 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
                 return;
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftRow) {
-            // Guesstimate new top left
-            const int newRow = int(viewportRect.y() / (averageEdgeSize.height() + cellSpacing.height()));
-            topLeftCell.ry() = qBound(0, newRow, tableSize.height() - 1);
-            topLeftPos.ry() = topLeftCell.y() * (averageEdgeSize.height() + cellSpacing.height());
+            if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Vertical)) {
+                // Look up the new top left from the sizes given by the provider
+                const int newRow = index->indexAt(viewportRect.y(), averageEdgeSize.height(), cellSpacing.height());
+                topLeftCell.ry() = qBound(0, newRow, tableSize.height() - 1);
+                topLeftPos.ry() = index->extent(0, topLeftCell.y(), averageEdgeSize.height(), cellSpacing.height());
+            } else {
+                // Guesstimate new top left
+                const int newRow = int(viewportRect.y() / (averageEdgeSize.height() + cellSpacing.height()));
+                topLeftCell.ry() = qBound(0, newRow, tableSize.height() - 1);
+                topLeftPos.ry() = topLeftCell.y() * (averageEdgeSize.height() + cellSpacing.height());
+            }
         } else if (rebuildOptions & RebuildOption::PositionViewAtRow) {
             topLeftCell.ry() = qBound(0, positionViewAtRowAfterRebuild, tableSize.height() - 1);
-            topLeftPos.ry() = qFloor(topLeftCell.y()) * (averageEdgeSize.height() + cellSpacing.height());
+            if (const QQuickTableViewSizeIndex *index = sizeIndex(Qt::Vertical))
+                topLeftPos.ry() = index->extent(0, topLeftCell.y(), averageEdgeSize.height(), cellSpacing.height());
+            else
+                topLeftPos.ry() = qFloor(topLeftCell.y()) * (averageEdgeSize.height() + cellSpacing.height());
         } else {
             topLeftCell.ry() = qBound(0, topRow(), tableSize.height() - 1);
             topLeftPos.ry() = loadedTableOuterRect.y();
@@ -3835,6 +3934,7 @@ void QQuickTableViewPrivate::loadInitialTable()
     if (rebuildOptions & RebuildOption::All) {
         origin = QPointF(0, 0);
         endExtent = QSizeF(0, 0);
+        clearSizeIndexes();
         hData.markExtentsDirty();
         vData.markExtentsDirty();
         updateBeginningEnd();
@@ -4456,6 +4556,10 @@ void QQuickTableViewPrivate::initItemCallback(int modelIndex, QObject *object)
     item->setParentItem(q->contentItem());
     item->setZ(1);
 
+    // The item can come from the shared pool of another view
+    if (auto attached = getAttachedObject(object))
+        attached->setView(q);
+
     const QPoint cell = cellAtModelIndex(modelIndex);
     const QPoint visualCell = QPoint(visualColumnIndex(cell.x()), visualRowIndex(cell.y()));
     const bool current = currentInSelectionModel(visualCell);
@@ -4777,6 +4881,7 @@ void QQuickTableViewPrivate::rowsMovedCallback(const QModelIndex &parent, int, i
     if (parent != QModelIndex())
         return;
 
+    rowSizeIndex.clear();
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
@@ -4785,6 +4890,7 @@ void QQuickTableViewPrivate::columnsMovedCallback(const QModelIndex &parent, int
     if (parent != QModelIndex())
         return;
 
+    columnSizeIndex.clear();
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
@@ -4842,6 +4948,7 @@ void QQuickTableViewPrivate::layoutChangedCallback(const QList<QPersistentModelI
     Q_UNUSED(parents);
     Q_UNUSED(hint);
 
+    clearSizeIndexes();
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
@@ -5614,6 +5721,8 @@ QQuickTableView::QQuickTableView(QQuickTableViewPrivate &dd, QQuickItem *parent)
     d_func()->init();
 }
 
+QQuickTableViewSizeProvider::~QQuickTableViewSizeProvider() = default;
+
 QQuickTableView::~QQuickTableView()
 {
     Q_D(QQuickTableView);
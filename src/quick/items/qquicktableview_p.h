@@ -34,6 +34,20 @@ class QQuickTableViewAttached;
 class QQuickTableViewPrivate;
 class QItemSelectionModel;
 
+class Q_QUICK_EXPORT QQuickTableViewSizeProvider
+{
+public:
+    virtual ~QQuickTableViewSizeProvider();
+
+    // Returns the size of the row or column at the given index, 0 if it
+    // should be hidden, or a negative value to fall back to the implicit
+    // size of the delegate items.
+    virtual qreal sizeAt(int index) const = 0;
+};
+
+#define QQuickTableViewSizeProvider_iid "org.qt-project.Qt.QQuickTableViewSizeProvider"
+Q_DECLARE_INTERFACE(QQuickTableViewSizeProvider, QQuickTableViewSizeProvider_iid)
+
 class Q_QUICK_EXPORT QQuickTableView : public QQuickFlickable, public QQmlFinalizerHook
 {
     Q_OBJECT
@@ -31,6 +31,7 @@
 #include <QtQuick/private/qquicksinglepointhandler_p.h>
 #include <QtQuick/private/qquickhoverhandler_p.h>
 #include <QtQuick/private/qquicktaphandler_p.h>
+#include <QtQuick/private/qquicktableviewsizeindex_p_p.h>
 
 #include <QtCore/private/qminimalflatset_p.h>
 
@@ -400,6 +401,11 @@ public:
     mutable EdgeRange cachedColumnWidth;
     mutable EdgeRange cachedRowHeight;
 
+    // Only built when the row heights or column widths come from a native
+    // QQuickTableViewSizeProvider, since the index asks for all of them.
+    mutable QQuickTableViewSizeIndex rowSizeIndex;
+    mutable QQuickTableViewSizeIndex columnSizeIndex;
+
     // TableView uses contentWidth/height to report the size of the table (this
     // will e.g make scrollbars written for Flickable work out of the box). This
     // value is continuously calculated, and will change/improve as more columns
@@ -501,6 +507,9 @@ public:
     qreal getRowLayoutHeight(int row);
     qreal getColumnWidth(int column) const;
     qreal getRowHeight(int row) const;
+    const QQuickTableViewSizeProvider *sizeProvider(Qt::Orientation orientation) const;
+    const QQuickTableViewSizeIndex *sizeIndex(Qt::Orientation orientation) const;
+    void clearSizeIndexes();
     qreal getEffectiveRowY(int row) const;
     qreal getEffectiveRowHeight(int row) const;
     qreal getEffectiveColumnX(int column) const;
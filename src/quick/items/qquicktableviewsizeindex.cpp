@@ -0,0 +1,120 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquicktableviewsizeindex_p_p.h"
+#include "qquicktableview_p.h"
+
+#include <QtCore/qmath.h>
+
+QT_BEGIN_NAMESPACE
+
+void QQuickTableViewSizeIndex::build(const QQuickTableViewSizeProvider *provider, int count)
+{
+    m_provider = provider;
+    m_count = qMax(0, count);
+    m_blocks.clear();
+    m_blocks.reserve(m_count / BlockSize + 2);
+
+    Block block;
+    for (int i = 0; i < m_count; ++i) {
+        if (i % BlockSize == 0)
+            m_blocks.append(block);
+        const qreal size = provider->sizeAt(i);
+        if (size >= 0) {
+            block.knownSize += size;
+            ++block.knownCount;
+            if (size > 0)
+                ++block.visibleCount;
+        }
+    }
+    m_blocks.append(block);
+}
+
+void QQuickTableViewSizeIndex::clear()
+{
+    m_provider = nullptr;
+    m_count = 0;
+    m_blocks.clear();
+}
+
+/*
+    Returns the distance from the start of row \a from to the start of row
+    \a to. Every visible row counts with its size plus \a spacing, and the
+    rows without a known size, including those outside of the table, count
+    with \a estimatedSize.
+*/
+qreal QQuickTableViewSizeIndex::extent(int from, int to, qreal estimatedSize, qreal spacing) const
+{
+    return extentBefore(to, estimatedSize, spacing) - extentBefore(from, estimatedSize, spacing);
+}
+
+/*
+    Returns the row that covers \a extent, measured from the start of the
+    first row. Hidden rows never cover an extent. Positions outside of the
+    table are extrapolated from \a estimatedSize, and can result in rows
+    that are negative or beyond count().
+*/
+int QQuickTableViewSizeIndex::indexAt(qreal extent, qreal estimatedSize, qreal spacing) const
+{
+    const qreal estimatedExtent = estimatedSize + spacing;
+    if (extent < 0 || m_blocks.isEmpty())
+        return estimatedExtent > 0 ? qFloor(extent / estimatedExtent) : 0;
+
+    // Find the last block that starts at, or before, extent
+    int first = 0;
+    int last = int(m_blocks.size()) - 1;
+    while (first < last) {
+        const int middle = (first + last + 1) / 2;
+        if (blockExtent(middle, estimatedSize, spacing) <= extent)
+            first = middle;
+        else
+            last = middle - 1;
+    }
+
+    qreal pos = blockExtent(first, estimatedSize, spacing);
+    for (int index = qMin(first * BlockSize, m_count); index < m_count; ++index) {
+        const qreal next = pos + sizeExtent(index, estimatedSize, spacing);
+        if (next > extent)
+            return index;
+        pos = next;
+    }
+
+    if (estimatedExtent <= 0)
+        return m_count;
+    return m_count + qFloor((extent - pos) / estimatedExtent);
+}
+
+qreal QQuickTableViewSizeIndex::sizeExtent(int index, qreal estimatedSize, qreal spacing) const
+{
+    const qreal size = m_provider->sizeAt(index);
+    if (!(size >= 0))
+        return estimatedSize + spacing;
+    return size > 0 ? size + spacing : 0;
+}
+
+qreal QQuickTableViewSizeIndex::blockExtent(int block, qreal estimatedSize, qreal spacing) const
+{
+    const Block &sizes = m_blocks.at(block);
+    const int rows = qMin(block * BlockSize, m_count);
+    return sizes.knownSize + sizes.visibleCount * spacing
+            + (rows - sizes.knownCount) * (estimatedSize + spacing);
+}
+
+qreal QQuickTableViewSizeIndex::extentBefore(int index, qreal estimatedSize, qreal spacing) const
+{
+    if (index <= 0 || m_blocks.isEmpty())
+        return index * (estimatedSize + spacing);
+
+    if (index >= m_count) {
+        const qreal total = blockExtent(int(m_blocks.size()) - 1, estimatedSize, spacing);
+        return total + (index - m_count) * (estimatedSize + spacing);
+    }
+
+    const int block = index / BlockSize;
+    qreal extent = blockExtent(block, estimatedSize, spacing);
+    for (int i = block * BlockSize; i < index; ++i)
+        extent += sizeExtent(i, estimatedSize, spacing);
+    return extent;
+}
+
+QT_END_NAMESPACE
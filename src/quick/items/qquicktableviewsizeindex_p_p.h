@@ -0,0 +1,77 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKTABLEVIEWSIZEINDEX_P_P_H
+#define QQUICKTABLEVIEWSIZEINDEX_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+#include <QtCore/qlist.h>
+
+QT_REQUIRE_CONFIG(quick_tableview);
+
+QT_BEGIN_NAMESPACE
+
+class QQuickTableViewSizeProvider;
+
+/*
+    Maps between the rows (or columns) of a TableView and their positions,
+    using the sizes returned by a QQuickTableViewSizeProvider.
+
+    The index stores the prefix sums of the sizes for every block of
+    BlockSize rows, which keeps it small also for tables with millions of
+    rows. A lookup binary searches the blocks, and then asks the provider
+    for the sizes of at most BlockSize - 1 rows inside the block. Rows
+    for which the provider has no size are assumed to have the estimated
+    size, and hidden rows (of size 0) don't add any spacing.
+
+    The index has no way to know when the provider starts to return other
+    sizes, so it needs to be rebuilt whenever the application calls
+    forceLayout().
+*/
+class Q_QUICK_AUTOTEST_EXPORT QQuickTableViewSizeIndex
+{
+public:
+    static constexpr int BlockSize = 64;
+
+    const QQuickTableViewSizeProvider *provider() const { return m_provider; }
+    int count() const { return m_count; }
+    bool isValid() const { return m_provider; }
+
+    void build(const QQuickTableViewSizeProvider *provider, int count);
+    void clear();
+
+    qreal extent(int from, int to, qreal estimatedSize, qreal spacing) const;
+    int indexAt(qreal extent, qreal estimatedSize, qreal spacing) const;
+
+private:
+    // The sizes of all the rows before the block
+    struct Block {
+        qreal knownSize = 0;
+        int knownCount = 0;
+        int visibleCount = 0;
+    };
+
+    qreal sizeExtent(int index, qreal estimatedSize, qreal spacing) const;
+    qreal blockExtent(int block, qreal estimatedSize, qreal spacing) const;
+    qreal extentBefore(int index, qreal estimatedSize, qreal spacing) const;
+
+    const QQuickTableViewSizeProvider *m_provider = nullptr;
+    int m_count = 0;
+    QList<Block> m_blocks;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTABLEVIEWSIZEINDEX_P_P_H
@@ -25,6 +25,11 @@
 #include <QtGui/qguiapplication.h>
 #include <QtGui/qinputmethod.h>
 
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
+
 #include <private/qtextengine_p.h>
 #include <private/qquickstyledtext_p.h>
 #include <QtQuick/private/qquickpixmap_p.h>
@@ -46,6 +51,9 @@ const QChar QQuickTextPrivate::elideChar = QChar(0x2026);
 // if QString::size() > largeTextSizeThreshold, we render more often, but only visible lines
 const int QQuickTextPrivate::largeTextSizeThreshold = QQUICKTEXT_LARGETEXT_THRESHOLD;
 
+// The approximate memory, in kilobytes, that QQuickTextLayoutCache may use; 0 disables it
+int QQuickTextPrivate::layoutCacheSize = qEnvironmentVariableIntValue("QML_TEXT_LAYOUT_CACHE_SIZE");
+
 QQuickTextPrivate::QQuickTextPrivate()
     : fontInfo(font), lineWidth(0)
     , color(0xFF000000), linkColor(0xFF0000FF), styleColor(0xFF000000)
@@ -63,6 +71,8 @@ QQuickTextPrivate::QQuickTextPrivate()
     , polishSize(false)
     , updateSizeRecursionGuard(false)
     , containsUnscalableGlyphs(false)
+    , asynchronous(false)
+    , asyncLayoutPending(false)
 {
     implicitAntialiasing = true;
 }
@@ -450,6 +460,22 @@ void QQuickTextPrivate::updateSize()
     qreal hPadding = q->leftPadding() + q->rightPadding();
     qreal vPadding = q->topPadding() + q->bottomPadding();
 
+    if ((asynchronous || layoutCacheSize > 0) && canLayoutWithoutItem()) {
+        if (asynchronous) {
+            // Keep the current geometry until the text has been laid out
+            asyncLayoutPending = true;
+            q->polish();
+        } else {
+            layoutWithoutItem();
+        }
+        return;
+    }
+    asyncLayoutPending = false;
+    if (asyncLayoutJob || sharedLayout) {
+        cancelAsyncLayout();
+        sharedLayout.reset();
+    }
+
     const QSizeF previousSize(q->contentWidth(), q->contentHeight());
 
     if (text.isEmpty() && !isLineLaidOutConnected() && fontSizeMode() == QQuickText::FixedSize) {
@@ -1280,6 +1306,408 @@ QRectF QQuickTextPrivate::setupTextLayout(qreal *const baseline)
     return br;
 }
 
+/*
+    Everything that the layout of plain text depends on, when it is neither
+    elided, nor scaled to fit, nor laid out line by line in QML. Also the key
+    of the layout cache.
+*/
+struct QQuickTextPrivate::LayoutKey
+{
+    QString text;
+    QFont font;
+    Qt::Alignment alignment;
+    QTextOption::WrapMode wrapMode = QTextOption::NoWrap;
+    Qt::LayoutDirection textDirection = Qt::LayoutDirectionAuto;
+    bool useDesignMetrics = false;
+    bool widthValid = false;
+    bool canWrap = false;
+    qreal firstLineWidth = FLT_MAX;
+    qreal availableWidth = 0;
+    int maximumLineCount = INT_MAX;
+    qreal lineHeight = 1.0;
+    QQuickText::LineHeightMode lineHeightMode = QQuickText::ProportionalHeight;
+
+    friend bool operator==(const LayoutKey &a, const LayoutKey &b)
+    {
+        return a.text == b.text && a.font == b.font && a.alignment == b.alignment
+                && a.wrapMode == b.wrapMode && a.textDirection == b.textDirection
+                && a.useDesignMetrics == b.useDesignMetrics && a.widthValid == b.widthValid
+                && a.canWrap == b.canWrap && a.firstLineWidth == b.firstLineWidth
+                && a.availableWidth == b.availableWidth && a.maximumLineCount == b.maximumLineCount
+                && a.lineHeight == b.lineHeight && a.lineHeightMode == b.lineHeightMode;
+    }
+
+    friend size_t qHash(const LayoutKey &key, size_t seed = 0)
+    {
+        return qHashMulti(seed, key.text, key.font, int(key.alignment), int(key.wrapMode),
+                          key.firstLineWidth, key.availableWidth, key.maximumLineCount,
+                          key.lineHeight);
+    }
+};
+
+struct QQuickTextPrivate::LayoutResult
+{
+    QSharedPointer<QTextLayout> layout;
+    QRectF rect;
+    QSizeF advance;
+    qreal baseline = 0;
+    qreal lineWidth = 0;
+    qreal naturalWidth = 0;
+    qreal naturalHeight = 0;
+    int lineCount = 0;
+    bool truncated = false;
+    bool widthExceeded = false;
+};
+
+/*
+    Lays out the lines of \a layout in the given width, up to the maximum
+    line count of \a key, and returns their height. This is the part of
+    setupTextLayout() that applies to the text that LayoutKey describes.
+*/
+static qreal layoutLines(QTextLayout *layout, const QQuickTextPrivate::LayoutKey &key, qreal width,
+                         QQuickTextPrivate::LayoutResult *result)
+{
+    qreal height = 0;
+    result->rect = QRectF();
+    result->lineCount = 0;
+    result->truncated = false;
+    result->widthExceeded = false;
+
+    layout->beginLayout();
+    for (;;) {
+        QTextLine line = layout->createLine();
+        if (!line.isValid())
+            break;
+        line.setLineWidth(width);
+        line.setPosition(QPointF(line.position().x(), height));
+        height += key.lineHeightMode == QQuickText::FixedHeight ? key.lineHeight
+                                                               : line.height() * key.lineHeight;
+        result->rect = result->rect.united(line.naturalTextRect());
+        ++result->lineCount;
+
+        const int end = line.textStart() + line.textLength();
+        if (end >= key.text.size())
+            break;
+        result->widthExceeded |= key.text.at(end - 1) != QChar::LineSeparator;
+        if (result->lineCount == key.maximumLineCount) {
+            result->truncated = true;
+            break;
+        }
+    }
+    layout->endLayout();
+    return height;
+}
+
+/*
+    Shapes and lays out the text that \a key describes. This does not touch
+    the item, so that it can run on any thread.
+*/
+QQuickTextPrivate::LayoutResult QQuickTextPrivate::layoutText(
+        const LayoutKey &key, const QList<QTextLayout::FormatRange> &formats)
+{
+    LayoutResult result;
+    result.layout = QSharedPointer<QTextLayout>::create(key.text, key.font);
+    QTextLayout *layout = result.layout.get();
+    QTextOption option(key.alignment);
+    option.setWrapMode(key.wrapMode);
+    option.setTextDirection(key.textDirection);
+    option.setUseDesignMetrics(key.useDesignMetrics);
+    layout->setCacheEnabled(true);
+    layout->setTextOption(option);
+    layout->setFormats(formats);
+
+    // Mirror the passes of setupTextLayout(): the first one determines the
+    // implicit size, and the text is laid out again if the width it ends up
+    // with affects wrapping or alignment.
+    qreal height = layoutLines(layout, key, key.firstLineWidth, &result);
+    result.naturalWidth = layout->maximumWidth();
+    result.naturalHeight = height;
+
+    result.lineWidth = key.widthValid ? key.availableWidth : result.naturalWidth;
+    if ((!qFuzzyCompare(result.lineWidth, key.firstLineWidth)
+         || (result.widthExceeded && result.lineWidth > key.firstLineWidth))
+            && (key.canWrap || key.alignment != Qt::AlignLeft)) {
+        height = layoutLines(layout, key, result.lineWidth, &result);
+    }
+
+    result.rect.moveTop(0);
+    result.rect.setHeight(height);
+    if (layout->lineCount() > 0) {
+        const QTextLine firstLine = layout->lineAt(0);
+        const QTextLine lastLine = layout->lineAt(layout->lineCount() - 1);
+        result.baseline = firstLine.y() + firstLine.ascent();
+        result.advance = QSizeF(lastLine.horizontalAdvance(), lastLine.y() - firstLine.y());
+    }
+    return result;
+}
+
+/*
+    A cache of laid out texts, shared by all Text items of the GUI thread, so
+    that items showing the same text with the same font and constraints, as
+    many delegates of a view do, shape it only once. The layouts themselves
+    are shared; they stay alive as long as an item shows them.
+
+    The approximate memory that the cache may use, in kilobytes, is set with
+    the QML_TEXT_LAYOUT_CACHE_SIZE environment variable; it is disabled by
+    default. The cache is destroyed with the application, since the layouts
+    refer to its font engines.
+*/
+class QQuickTextLayoutCache
+{
+public:
+    static QQuickTextLayoutCache *instance()
+    {
+        const int size = QQuickTextPrivate::layoutCacheSize;
+        if (size <= 0)
+            return nullptr;
+        const QCoreApplication *application = QCoreApplication::instance();
+        if (!application || application->thread() != QThread::currentThread())
+            return nullptr;
+        if (!s_instance) {
+            s_instance = new QQuickTextLayoutCache;
+            qAddPostRoutine(cleanup);
+        }
+        s_instance->m_entries.setMaxCost(qsizetype(size) * 1024);
+        return s_instance;
+    }
+
+    const QQuickTextPrivate::LayoutResult *find(const QQuickTextPrivate::LayoutKey &key)
+    {
+        return m_entries.object(key);
+    }
+
+    void insert(const QQuickTextPrivate::LayoutKey &key, const QQuickTextPrivate::LayoutResult &result)
+    {
+        m_entries.insert(key, new QQuickTextPrivate::LayoutResult(result), cost(key, result));
+    }
+
+private:
+    // Rough per character and per line memory use of a QTextLayout: the
+    // glyphs and their attributes, and the script lines
+    enum { BytesPerCharacter = 40, BytesPerLine = 64 };
+
+    static qsizetype cost(const QQuickTextPrivate::LayoutKey &key, const QQuickTextPrivate::LayoutResult &result)
+    {
+        return qsizetype(sizeof(QTextLayout) + sizeof(QTextEngine))
+                + key.text.size() * BytesPerCharacter + result.lineCount * BytesPerLine;
+    }
+
+    static void cleanup()
+    {
+        delete s_instance;
+        s_instance = nullptr;
+    }
+
+    static inline QQuickTextLayoutCache *s_instance = nullptr;
+    QCache<QQuickTextPrivate::LayoutKey, QQuickTextPrivate::LayoutResult> m_entries;
+};
+
+/*
+    The state shared with the thread that lays out the text asynchronously.
+*/
+struct QQuickTextPrivate::AsyncLayoutJob
+{
+    LayoutKey key;
+    QList<QTextLayout::FormatRange> formats;
+    LayoutResult result;
+
+    // The item to deliver the result to; cleared when the job is cancelled
+    QMutex mutex;
+    QQuickText *receiver = nullptr;
+};
+
+/*!
+    Returns whether the text can be laid out without the item, by
+    layoutText(): only plain and styled text without inline images
+    qualifies, and only if none of the features that need the item while
+    laying out are in use.
+*/
+bool QQuickTextPrivate::canLayoutWithoutItem()
+{
+    return !richText
+            && !text.isEmpty()
+            && multilengthEos == -1
+            && elideMode == QQuickText::ElideNone
+            && fontSizeMode() == QQuickText::FixedSize
+            && !(extra.isAllocated() && !extra->imgTags.isEmpty())
+            && !isLineLaidOutConnected();
+}
+
+QQuickTextPrivate::LayoutKey QQuickTextPrivate::layoutKey() const
+{
+    Q_Q(const QQuickText);
+    const QTextOption option = layout.textOption();
+    LayoutKey key;
+    key.text = layout.text();
+    key.font = font;
+    key.alignment = Qt::Alignment(q->effectiveHAlign());
+    key.wrapMode = QTextOption::WrapMode(wrapMode);
+    key.textDirection = option.textDirection();
+    key.useDesignMetrics = renderType != QQuickText::NativeRendering;
+    key.widthValid = q->widthValid() && q->width() > 0;
+    key.canWrap = wrapMode != QQuickText::NoWrap && q->widthValid();
+    if ((q->widthValid() || implicitWidthValid) && q->width() > 0)
+        key.firstLineWidth = q->width();
+    key.availableWidth = availableWidth();
+    key.maximumLineCount = maximumLineCount();
+    key.lineHeight = lineHeight();
+    key.lineHeightMode = lineHeightMode();
+    return key;
+}
+
+/*!
+    Lays out the text with layoutText() right away, or takes the layout from
+    the cache if another item has laid out the same text already.
+*/
+void QQuickTextPrivate::layoutWithoutItem()
+{
+    cancelAsyncLayout();
+    const LayoutKey key = layoutKey();
+    const QList<QTextLayout::FormatRange> formats = layout.formats();
+    QQuickTextLayoutCache *cache = formats.isEmpty() ? QQuickTextLayoutCache::instance() : nullptr;
+    if (cache) {
+        if (const LayoutResult *result = cache->find(key)) {
+            applyLayout(key, *result);
+            return;
+        }
+    }
+    const LayoutResult result = layoutText(key, formats);
+    if (cache)
+        cache->insert(key, result);
+    applyLayout(key, result);
+}
+
+void QQuickTextPrivate::startAsyncLayout()
+{
+    Q_Q(QQuickText);
+    asyncLayoutPending = false;
+    cancelAsyncLayout();
+
+    auto job = QSharedPointer<AsyncLayoutJob>::create();
+    job->key = layoutKey();
+    job->formats = layout.formats();
+    if (job->formats.isEmpty()) {
+        if (QQuickTextLayoutCache *cache = QQuickTextLayoutCache::instance()) {
+            if (const LayoutResult *result = cache->find(job->key)) {
+                applyLayout(job->key, *result);
+                return;
+            }
+        }
+    }
+    job->receiver = q;
+    asyncLayoutJob = job;
+
+    QThreadPool::globalInstance()->start([job] {
+        {
+            QMutexLocker locker(&job->mutex);
+            if (!job->receiver)
+                return;
+        }
+        job->result = layoutText(job->key, job->formats);
+
+        QMutexLocker locker(&job->mutex);
+        // The item cannot be destroyed while the mutex is held, see cancelAsyncLayout()
+        if (QQuickText *receiver = job->receiver) {
+            QMetaObject::invokeMethod(receiver, [receiver, job] {
+                QQuickTextPrivate::get(receiver)->finishAsyncLayout(job);
+            }, Qt::QueuedConnection);
+        }
+    });
+}
+
+/*!
+    Publishes the result of the asynchronous layout \a job, unless the item
+    has started another one since.
+*/
+void QQuickTextPrivate::finishAsyncLayout(const QSharedPointer<AsyncLayoutJob> &job)
+{
+    if (job != asyncLayoutJob)
+        return;
+    asyncLayoutJob.reset();
+
+    // The layout was made with the font engines of the other thread
+    job->result.layout->engine()->resetFontEngineCache();
+    if (job->formats.isEmpty()) {
+        if (QQuickTextLayoutCache *cache = QQuickTextLayoutCache::instance())
+            cache->insert(job->key, job->result);
+    }
+    applyLayout(job->key, job->result);
+}
+
+/*!
+    Shows the \a result of laying out the text that \a key describes, and
+    updates the geometry of the item to match.
+*/
+void QQuickTextPrivate::applyLayout(const LayoutKey &key, const LayoutResult &result)
+{
+    Q_Q(QQuickText);
+    const QSizeF previousSize(q->contentWidth(), q->contentHeight());
+    const bool wasTruncated = truncated;
+    const int previousLineCount = lineCount;
+
+    sharedLayout = result.layout;
+    elideLayout.reset();
+
+    lineWidth = result.lineWidth;
+    widthExceeded = result.widthExceeded;
+    heightExceeded = result.truncated;
+    truncated = result.truncated;
+    lineCount = result.lineCount;
+    layedOutTextRect = result.rect;
+    advance = result.advance;
+    implicitWidthValid = true;
+    implicitHeightValid = true;
+
+    const qreal hPadding = q->leftPadding() + q->rightPadding();
+    const qreal vPadding = q->topPadding() + q->bottomPadding();
+    const bool wasInLayout = internalWidthUpdate;
+    internalWidthUpdate = true;
+    q->setImplicitSize(result.naturalWidth + hPadding,
+                       result.naturalHeight + qMax(lineHeightOffset(), 0) + vPadding);
+    internalWidthUpdate = wasInLayout;
+    updateBaseline(result.baseline, q->height() - layedOutTextRect.height() - vPadding);
+
+    const QFontInfo currentFontInfo(font);
+    if (fontInfo.weight() != currentFontInfo.weight()
+            || fontInfo.pixelSize() != currentFontInfo.pixelSize()
+            || fontInfo.italic() != currentFontInfo.italic()
+            || !qFuzzyCompare(fontInfo.pointSizeF(), currentFontInfo.pointSizeF())
+            || fontInfo.family() != currentFontInfo.family()
+            || fontInfo.styleName() != currentFontInfo.styleName()) {
+        fontInfo = currentFontInfo;
+        emit q->fontInfoChanged();
+    }
+    assignedFont = currentFontInfo.family();
+
+    if (lineCount != previousLineCount)
+        emit q->lineCountChanged();
+    if (truncated != wasTruncated)
+        emit q->truncatedChanged();
+    signalSizeChange(previousSize);
+    updateType = UpdatePaintNode;
+    q->update();
+
+    // The new implicit size may have resized the item, in which case the
+    // text has to be laid out again for its final width
+    const bool widthValid = q->widthValid() && q->width() > 0;
+    if ((widthValid != key.widthValid || (widthValid && !qFuzzyCompare(availableWidth(), key.availableWidth)))
+            && !updateSizeRecursionGuard) {
+        updateSizeRecursionGuard = true;
+        updateSize();
+        updateSizeRecursionGuard = false;
+    }
+}
+
+void QQuickTextPrivate::cancelAsyncLayout()
+{
+    if (!asyncLayoutJob)
+        return;
+    QMutexLocker locker(&asyncLayoutJob->mutex);
+    asyncLayoutJob->receiver = nullptr;
+    locker.unlock();
+    asyncLayoutJob.reset();
+}
+
 void QQuickTextPrivate::setLineGeometry(QTextLine &line, qreal lineWidth, qreal &height)
 {
     Q_Q(QQuickText);
@@ -1481,6 +1909,7 @@ QQuickText::QQuickText(QQuickTextPrivate &dd, QQuickItem *parent)
 QQuickText::~QQuickText()
 {
     Q_D(QQuickText);
+    d->cancelAsyncLayout();
     if (d->extra.isAllocated()) {
         qDeleteAll(d->extra->pixmapsInProgress);
         d->extra->pixmapsInProgress.clear();
@@ -2829,7 +3258,7 @@ QSGNode *QQuickText::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data
         if (d->elideLayout)
             unelidedLineCount -= 1;
         if (unelidedLineCount > 0)
-            node->addTextLayout(QPointF(dx, dy), &d->layout, -1, -1,0, unelidedLineCount);
+            node->addTextLayout(QPointF(dx, dy), d->activeLayout(), -1, -1,0, unelidedLineCount);
 
         if (d->elideLayout)
             node->addTextLayout(QPointF(dx, dy), d->elideLayout.get());
@@ -2869,6 +3298,8 @@ void QQuickText::updatePolish()
         d->updateSize();
         d->polishSize = false;
     }
+    if (d->asyncLayoutPending)
+        d->startAsyncLayout();
     invalidateFontCaches();
 }
 
@@ -3124,7 +3555,7 @@ QString QQuickTextPrivate::anchorAt(const QPointF &mousePos) const
     translatedMousePos.rx() -= q->leftPadding();
     translatedMousePos.ry() -= q->topPadding() + QQuickTextUtil::alignedY(layedOutTextRect.height() + lineHeightOffset(), availableHeight(), vAlign);
     if (styledText) {
-        QString link = anchorAt(&layout, translatedMousePos);
+        QString link = anchorAt(activeLayout(), translatedMousePos);
         if (link.isEmpty() && elideLayout)
             link = anchorAt(elideLayout.get(), translatedMousePos);
         return link;
@@ -3216,7 +3647,7 @@ static void getLinks_helper(const QTextLayout *layout, QVector<QQuickTextPrivate
 QVector<QQuickTextPrivate::LinkDesc> QQuickTextPrivate::getLinks() const
 {
     QVector<QQuickTextPrivate::LinkDesc> links;
-    getLinks_helper(&layout, &links);
+    getLinks_helper(activeLayout(), &links);
     return links;
 }
 
@@ -3424,7 +3855,12 @@ void QQuickText::doLayout()
 void QQuickText::forceLayout()
 {
     Q_D(QQuickText);
+    // Lay out now, even if the text is otherwise laid out asynchronously
+    const bool wasAsynchronous = d->asynchronous;
+    d->asynchronous = false;
+    d->asyncLayoutPending = false;
     d->updateSize();
+    d->asynchronous = wasAsynchronous;
 }
 
 /*!
@@ -3461,6 +3897,8 @@ void QQuickText::invalidateFontCaches()
     } else {
         if (d->layout.engine() != nullptr)
             d->layout.engine()->resetFontEngineCache();
+        if (d->sharedLayout && d->sharedLayout->engine() != nullptr)
+            d->sharedLayout->engine()->resetFontEngineCache();
     }
 }
 
@@ -3679,6 +4117,48 @@ QSizeF QQuickText::advance() const
     return d->advance;
 }
 
+/*!
+    \qmlproperty bool QtQuick::Text::asynchronous
+    \since 6.10
+
+    Specifies that the text should be shaped and laid out in a separate
+    thread. The default value is \c false, causing the user interface thread
+    to lay out the text whenever it, or a property that affects its layout,
+    changes.
+
+    While the text is being laid out, the item keeps showing the previous
+    text, and keeps its previous implicit size, \l contentWidth,
+    \l contentHeight and \l lineCount. They all change together once the new
+    layout is ready. Setting \a asynchronous to \c true is useful for views
+    with many text delegates, or for long texts, where a responsive user
+    interface is more desirable than having the text immediately visible.
+
+    Only plain text and styled text without images can be laid out
+    asynchronously, and only if \l elide is \c Text.ElideNone,
+    \l fontSizeMode is \c Text.FixedSize, and \l lineLaidOut is not
+    connected. Otherwise, the text is laid out in the user interface thread.
+    \l forceLayout() always lays out the text immediately.
+*/
+bool QQuickText::asynchronous() const
+{
+    Q_D(const QQuickText);
+    return d->asynchronous;
+}
+
+void QQuickText::setAsynchronous(bool asynchronous)
+{
+    Q_D(QQuickText);
+    if (d->asynchronous == asynchronous)
+        return;
+
+    d->asynchronous = asynchronous;
+    if (!asynchronous && (d->asyncLayoutPending || d->asyncLayoutJob)) {
+        d->asyncLayoutPending = false;
+        d->updateSize();
+    }
+    emit asynchronousChanged();
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qquicktext_p.cpp"
@@ -67,6 +67,7 @@ class Q_QUICK_EXPORT QQuickText : public QQuickImplicitSizeItem, public QQuickTe
 
     Q_PROPERTY(QJSValue fontInfo READ fontInfo NOTIFY fontInfoChanged REVISION(2, 9))
     Q_PROPERTY(QSizeF advance READ advance NOTIFY contentSizeChanged REVISION(2, 10))
+    Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY asynchronousChanged REVISION(6, 10))
     QML_NAMED_ELEMENT(Text)
     QML_ADDED_IN_VERSION(2, 0)
 
@@ -241,6 +242,9 @@ public:
     QJSValue fontInfo() const;
     QSizeF advance() const;
 
+    bool asynchronous() const;
+    void setAsynchronous(bool asynchronous);
+
     void invalidate() override;
 
 Q_SIGNALS:
@@ -281,6 +285,7 @@ Q_SIGNALS:
     Q_REVISION(2, 6) void bottomPaddingChanged();
     Q_REVISION(2, 9) void fontInfoChanged();
     Q_REVISION(6, 0) void renderTypeQualityChanged();
+    Q_REVISION(6, 10) void asynchronousChanged();
 
 protected:
     QQuickText(QQuickTextPrivate &dd, QQuickItem *parent = nullptr);
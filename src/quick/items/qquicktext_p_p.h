@@ -18,6 +18,7 @@
 #include "qquicktext_p.h"
 #include "qquickimplicitsizeitem_p_p.h"
 
+#include <QtCore/qsharedpointer.h>
 #include <QtQml/qqml.h>
 #include <QtGui/qabstracttextdocumentlayout.h>
 #include <QtGui/qtextlayout.h>
@@ -98,6 +99,11 @@ public:
     QScopedPointer<QTextLayout> elideLayout;
     QScopedPointer<QQuickTextLine> textLine;
 
+    // The text as laid out by layoutText(), on another thread or for another
+    // item with the same text; shown instead of layout when set
+    QSharedPointer<QTextLayout> sharedLayout;
+    QSharedPointer<AsyncLayoutJob> asyncLayoutJob;
+
     qreal lineWidth;
 
     QRgb color;
@@ -145,9 +151,12 @@ public:
     bool polishSize:1; // Workaround for problem with polish called after updateSize (QTBUG-42636)
     bool updateSizeRecursionGuard:1;
     bool containsUnscalableGlyphs:1;
+    bool asynchronous:1;
+    bool asyncLayoutPending:1;
 
     static const QChar elideChar;
     static const int largeTextSizeThreshold;
+    static int layoutCacheSize;
 
     qreal getImplicitWidth() const override;
     qreal getImplicitHeight() const override;
@@ -167,6 +176,21 @@ public:
     qreal devicePixelRatio() const;
 
     QRectF setupTextLayout(qreal * const baseline);
+
+    struct LayoutKey;
+    struct LayoutResult;
+    struct AsyncLayoutJob;
+    static LayoutResult layoutText(const LayoutKey &key, const QList<QTextLayout::FormatRange> &formats);
+    bool canLayoutWithoutItem();
+    LayoutKey layoutKey() const;
+    void layoutWithoutItem();
+    void applyLayout(const LayoutKey &key, const LayoutResult &result);
+    void startAsyncLayout();
+    void finishAsyncLayout(const QSharedPointer<AsyncLayoutJob> &job);
+    void cancelAsyncLayout();
+    QTextLayout *activeLayout() { return sharedLayout ? sharedLayout.get() : &layout; }
+    const QTextLayout *activeLayout() const { return sharedLayout ? sharedLayout.get() : &layout; }
+
     void setupCustomLineGeometry(QTextLine &line, qreal &height, int fullLayoutTextLength, int lineOffset = 0);
     bool isLinkActivatedConnected();
     bool isLinkHoveredConnected();
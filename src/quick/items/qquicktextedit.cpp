@@ -2599,6 +2599,21 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
                     frameBoundaries.append(frame->firstPosition());
                 std::sort(frameBoundaries.begin(), frameBoundaries.end());
 
+                // In a long flow of blocks, such as a log, skip the ones above the viewport
+                // without looking at their layouts. The skip must not go past the first clean
+                // node, or the nodes from there on would be created a second time.
+                const int unskippedFirstDirtyPos = firstDirtyPos;
+                if (!viewport.isNull() && textFrame == d->document->rootFrame()
+                        && textFrame->childFrames().isEmpty()) {
+                    int firstPosInViewport = d->firstFlowBlockBelow(viewport.top());
+                    if (firstCleanNode.textNode())
+                        firstPosInViewport = qMin(firstPosInViewport, firstCleanNode.startPos());
+                    if (firstPosInViewport > firstDirtyPos) {
+                        qCDebug(lcVP) << "skipping to block at" << firstPosInViewport << "from" << firstDirtyPos;
+                        firstDirtyPos = firstPosInViewport;
+                    }
+                }
+
                 QTextFrame::iterator it = textFrame->begin();
                 while (!it.atEnd()) {
                     QTextBlock block = it.currentBlock();
@@ -2617,7 +2632,7 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
                             coveredRegion = block.layout()->boundingRect().adjusted(nodeOffset.x(), nodeOffset.y(), nodeOffset.x(), nodeOffset.y());
                             inView = coveredRegion.bottom() > viewport.top();
                         }
-                        const bool potentiallyScrollingBackwards = firstPosAcrossAllNodes && *firstPosAcrossAllNodes == firstDirtyPos;
+                        const bool potentiallyScrollingBackwards = firstPosAcrossAllNodes && *firstPosAcrossAllNodes == unskippedFirstDirtyPos;
                         if (d->firstBlockInViewport < 0 && inView && potentiallyScrollingBackwards) {
                             // During backward scrolling, we need to iterate backwards from textNodeMap.begin() to fill the top of the viewport.
                             if (coveredRegion.top() > viewport.top() + 1) {
@@ -2900,11 +2915,28 @@ void QQuickTextEdit::q_textChanged()
         if (d->contentDirection != Qt::LayoutDirectionAuto)
             break;
     }
+    const QTextOption oldTextOption = d->document->defaultTextOption();
+    const qreal oldTextWidth = d->document->textWidth();
     d->determineHorizontalAlignment();
     d->updateDefaultTextOption();
     updateSize();
 
-    markDirtyNodesForRange(0, d->document->characterCount(), 0);
+    // Text that grows through edits, such as a log, needs culling as much as text set at once
+    if (!flags().testFlag(QQuickItem::ItemObservesViewport)
+            && d->document->characterCount() > QQuickTextEditPrivate::largeTextSizeThreshold) {
+        setFlag(QQuickItem::ItemObservesViewport);
+    }
+
+    // Appending plain text only affects the nodes at the end of the document, which
+    // q_contentsChange() marked already, unless the existing lines are aligned differently now
+    const QTextOption textOption = d->document->defaultTextOption();
+    const bool appendedOnly = d->appendOnlyChange && !d->richText && !d->markdownText
+            && textOption.alignment() == oldTextOption.alignment()
+            && textOption.textDirection() == oldTextOption.textDirection()
+            && d->document->textWidth() == oldTextWidth;
+    d->appendOnlyChange = false;
+    if (!appendedOnly)
+        markDirtyNodesForRange(0, d->document->characterCount(), 0);
     if (isComponentComplete()) {
         polish();
         d->updateType = QQuickTextEditPrivate::UpdatePaintNode;
@@ -2955,6 +2987,9 @@ void QQuickTextEdit::q_contentsChange(int pos, int charsRemoved, int charsAdded)
     const int editRange = pos + qMax(charsAdded, charsRemoved);
     const int delta = charsAdded - charsRemoved;
 
+    // Checked by q_textChanged(), which follows for the same change
+    d->appendOnlyChange = charsRemoved == 0 && charsAdded > 0
+            && pos + charsAdded >= d->document->characterCount() - 1;
     markDirtyNodesForRange(pos, editRange, delta);
 
     if (isComponentComplete()) {
@@ -3359,6 +3394,29 @@ QSGInternalTextNode *QQuickTextEditPrivate::createTextNode()
     return node;
 }
 
+/*
+    Returns the position of the block of the root frame that the document
+    layout has placed right before the first one reaching below \a y. The
+    layout keeps the position of every block, so this bisects the blocks
+    instead of visiting all those above \a y; it is only valid when the
+    root frame is a single flow of blocks, without child frames.
+*/
+int QQuickTextEditPrivate::firstFlowBlockBelow(qreal y) const
+{
+    QAbstractTextDocumentLayout *layout = document->documentLayout();
+    int first = 0;
+    int last = document->blockCount() - 1;
+    while (first < last) {
+        const int middle = first + (last - first) / 2;
+        if (layout->blockBoundingRect(document->findBlockByNumber(middle)).bottom() <= y)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    // Let updatePaintNode() see the block above as well, to find the first one in view itself
+    return document->findBlockByNumber(qMax(0, first - 1)).position();
+}
+
 void QQuickTextEdit::q_canPasteChanged()
 {
     Q_D(QQuickTextEdit);
@@ -93,7 +93,7 @@ public:
         , selectByMouse(true), canPaste(false), canPasteValid(false), hAlignImplicit(true)
         , textCached(true), inLayout(false), selectByKeyboard(false), selectByKeyboardSet(false)
         , hadSelection(false), markdownText(false), inResize(false), ownsDocument(false)
-        , containsUnscalableGlyphs(false)
+        , containsUnscalableGlyphs(false), appendOnlyChange(false)
     {
 #if QT_CONFIG(accessibility)
         QAccessible::installActivationObserver(this);
@@ -132,6 +132,7 @@ public:
     void handleFocusEvent(QFocusEvent *event);
     void addCurrentTextNodeToRoot(QQuickTextNodeEngine *, QSGTransformNode *, QSGInternalTextNode *, TextNodeIterator&, int startPos);
     QSGInternalTextNode* createTextNode();
+    int firstFlowBlockBelow(qreal y) const;
 
 #if QT_CONFIG(im)
     Qt::InputMethodHints effectiveInputMethodHints() const;
@@ -222,6 +223,7 @@ public:
     bool inResize : 1;
     bool ownsDocument : 1;
     bool containsUnscalableGlyphs : 1;
+    bool appendOnlyChange : 1; // the last change of the document only appended text
 
     static const int largeTextSizeThreshold;
 };
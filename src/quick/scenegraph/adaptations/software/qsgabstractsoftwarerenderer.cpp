@@ -9,6 +9,11 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -16,6 +21,8 @@ Q_STATIC_LOGGING_CATEGORY(lc2DRender, "qt.scenegraph.softwarecontext.abstractren
 
 QT_BEGIN_NAMESPACE
 
+Q_GLOBAL_STATIC(QThreadPool, qsgSoftwareRenderThreadPool)
+
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
@@ -109,6 +116,136 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+/*
+    Returns the smallest number of logical pixels which covers a whole number
+    of device pixels at \a devicePixelRatio, or 0 if there is no such small
+    number. Tiles are cut at multiples of it, so that no device pixel is
+    shared between two tiles.
+*/
+static int tileAlignment(qreal devicePixelRatio)
+{
+    for (int n = 1; n <= 16; ++n) {
+        const qreal devicePixels = n * devicePixelRatio;
+        if (qAbs(devicePixels - qRound(devicePixels)) < 0.001)
+            return n;
+    }
+    return 0;
+}
+
+bool QSGAbstractSoftwareRenderer::canRenderNodesInTiles(qreal devicePixelRatio) const
+{
+    if (tileAlignment(devicePixelRatio) == 0)
+        return false;
+
+    for (auto node : m_renderableNodes) {
+        // Render nodes paint through the context's active painter, which is
+        // not available when painting tiles
+        if (node->type() == QSGSoftwareRenderableNode::RenderNode) {
+            if (node->isDirty())
+                return false;
+        } else if (node->needsPainting() && !node->isImageBacked()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    Splits updateRegion into tiles of at least tileSize logical pixels and
+    paints them in parallel, each thread using its own QPainter on a QImage
+    which shares the pixel data of \a image. Tile edges fall on whole device
+    pixels, so threads never touch pixels outside of their current tile, and
+    every tile paints the render list in order, so the result is the same as
+    with renderNodes().
+*/
+QRegion QSGAbstractSoftwareRenderer::renderNodesInTiles(QImage *image, const QRegion &updateRegion,
+                                                        int tileSize, int threadCount)
+{
+    QRegion dirtyRegion;
+    if (m_renderableNodes.isEmpty())
+        return dirtyRegion;
+
+    const int alignment = tileAlignment(image->devicePixelRatio());
+    Q_ASSERT(alignment > 0);
+    tileSize = ((tileSize + alignment - 1) / alignment) * alignment;
+
+    QVarLengthArray<QRegion, 64> tiles;
+    const QRect bounds = updateRegion.boundingRect();
+    for (int y = (bounds.top() / tileSize) * tileSize; y <= bounds.bottom(); y += tileSize) {
+        for (int x = (bounds.left() / tileSize) * tileSize; x <= bounds.right(); x += tileSize) {
+            const QRegion tile = updateRegion.intersected(QRect(x, y, tileSize, tileSize));
+            if (!tile.isEmpty())
+                tiles.append(tile);
+        }
+    }
+
+    // Settle all lazily updated caches up front, painting must not modify the nodes
+    QVarLengthArray<QSGSoftwareRenderableNode *, 256> nodes;
+    auto iterator = m_renderableNodes.begin();
+    auto backgroundNode = *iterator;
+    if (m_clearColorEnabled) {
+        if (backgroundNode->needsPainting())
+            nodes.append(backgroundNode);
+        else
+            backgroundNode->finishPainting(false);
+    }
+    for (++iterator; iterator != m_renderableNodes.end(); ++iterator) {
+        auto node = *iterator;
+        if (node->needsPainting()) {
+            node->preparePaint(image->devicePixelRatio());
+            nodes.append(node);
+        } else {
+            node->finishPainting(false);
+        }
+    }
+
+    // Glyph nodes share font engines, and with them glyph caches, between threads
+    QMutex glyphMutex;
+    QAtomicInt nextTile;
+    uchar *bits = image->bits();
+    const auto paintTiles = [&]() {
+        QImage target(bits, image->width(), image->height(), image->bytesPerLine(), image->format());
+        target.setDevicePixelRatio(image->devicePixelRatio());
+        QPainter painter(&target);
+        painter.setRenderHint(QPainter::Antialiasing);
+        for (int t = nextTile.fetchAndAddRelaxed(1); t < tiles.size(); t = nextTile.fetchAndAddRelaxed(1)) {
+            for (auto node : nodes) {
+                const QRegion clipRegion = node->dirtyRegion().intersected(tiles.at(t));
+                if (clipRegion.isEmpty())
+                    continue;
+                const bool forceOpaquePainting = node == backgroundNode;
+                if (node->type() == QSGSoftwareRenderableNode::Glyph) {
+                    QMutexLocker locker(&glyphMutex);
+                    node->paint(&painter, clipRegion, forceOpaquePainting);
+                } else {
+                    node->paint(&painter, clipRegion, forceOpaquePainting);
+                }
+            }
+        }
+    };
+
+    // The calling thread takes part, so only threadCount - 1 helpers are needed
+    QThreadPool *pool = qsgSoftwareRenderThreadPool();
+    if (pool->maxThreadCount() < threadCount - 1)
+        pool->setMaxThreadCount(threadCount - 1);
+    const int helperCount = qMin(threadCount, int(tiles.size())) - 1;
+    QSemaphore done;
+    for (int i = 0; i < helperCount; ++i) {
+        pool->start([&]() {
+            paintTiles();
+            done.release();
+        });
+    }
+    paintTiles();
+    done.acquire(helperCount);
+
+    for (auto node : nodes)
+        dirtyRegion += node->finishPainting(true);
+
+    qCDebug(lc2DRender) << "renderNodesInTiles" << tiles.size() << "tiles on" << helperCount + 1 << "threads";
+    return dirtyRegion;
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
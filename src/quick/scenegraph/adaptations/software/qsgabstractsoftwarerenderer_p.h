@@ -21,6 +21,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QImage;
 class QSGSimpleRectNode;
 
 class QSGSoftwareRenderableNode;
@@ -45,6 +46,8 @@ public:
 
 protected:
     QRegion renderNodes(QPainter *painter);
+    bool canRenderNodesInTiles(qreal devicePixelRatio) const;
+    QRegion renderNodesInTiles(QImage *image, const QRegion &updateRegion, int tileSize, int threadCount);
     void buildRenderList();
     QRegion optimizeRenderList();
 
@@ -87,8 +87,7 @@ void QSGSoftwareRenderContext::invalidate()
     qDeleteAll(m_texturesToDelete);
     m_texturesToDelete.clear();
 
-    qDeleteAll(m_textures);
-    m_textures.clear();
+    releaseFactoryTextures();
 
     Q_ASSERT(m_fontEnginesToClean.isEmpty());
 
@@ -409,7 +409,7 @@ void QSGSoftwareInternalImageNode::paint(QPainter *painter)
     // Disable antialiased clipping. It causes transformed tiles to have gaps.
     painter->setRenderHint(QPainter::Antialiasing, false);
 
-    updateCachedMirroredPixmap();
+    prepare();
     const QPixmap &pm = m_mirrorHorizontally || m_mirrorVertically || m_textureIsLayer ? m_cachedMirroredPixmap : pixmap();
 
     if (m_innerTargetRect != m_targetRect) {
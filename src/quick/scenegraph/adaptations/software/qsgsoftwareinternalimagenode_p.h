@@ -86,6 +86,7 @@ public:
 
     void preprocess() override;
 
+    void prepare() { updateCachedMirroredPixmap(); }
     void paint(QPainter *painter);
 
     QRectF rect() const;
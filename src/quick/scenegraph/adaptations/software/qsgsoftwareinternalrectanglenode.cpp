@@ -16,7 +16,7 @@ QSGSoftwareInternalRectangleNode::QSGSoftwareInternalRectangleNode()
     , m_bottomLeftRadius(-1)
     , m_bottomRightRadius(-1)
     , m_vertical(true)
-    , m_cornerPixmapIsDirty(true)
+    , m_cornerImageIsDirty(true)
     , m_devicePixelRatio(1)
 {
     m_pen.setJoinStyle(Qt::MiterJoin);
@@ -38,7 +38,7 @@ void QSGSoftwareInternalRectangleNode::setColor(const QColor &color)
 {
     if (m_color != color) {
         m_color = color;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -47,7 +47,7 @@ void QSGSoftwareInternalRectangleNode::setPenColor(const QColor &color)
 {
     if (m_penColor != color) {
         m_penColor = color;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -56,7 +56,7 @@ void QSGSoftwareInternalRectangleNode::setPenWidth(qreal width)
 {
     if (m_penWidth != width) {
         m_penWidth = width;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -153,7 +153,7 @@ void QSGSoftwareInternalRectangleNode::setGradientStops(const QGradientStops &st
     } else {
         m_stops = stops;
     }
-    m_cornerPixmapIsDirty = true;
+    m_cornerImageIsDirty = true;
     markDirty(DirtyMaterial);
 }
 
@@ -161,7 +161,7 @@ void QSGSoftwareInternalRectangleNode::setGradientVertical(bool vertical)
 {
     if (m_vertical != vertical) {
         m_vertical = vertical;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -170,7 +170,7 @@ void QSGSoftwareInternalRectangleNode::setRadius(qreal radius)
 {
     if (m_radius != radius) {
         m_radius = radius;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -179,7 +179,7 @@ void QSGSoftwareInternalRectangleNode::setTopLeftRadius(qreal radius)
 {
     if (m_topLeftRadius != radius) {
         m_topLeftRadius = radius;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -188,7 +188,7 @@ void QSGSoftwareInternalRectangleNode::setTopRightRadius(qreal radius)
 {
     if (m_topRightRadius != radius) {
         m_topRightRadius = radius;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -197,7 +197,7 @@ void QSGSoftwareInternalRectangleNode::setBottomLeftRadius(qreal radius)
 {
     if (m_bottomLeftRadius != radius) {
         m_bottomLeftRadius = radius;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -206,7 +206,7 @@ void QSGSoftwareInternalRectangleNode::setBottomRightRadius(qreal radius)
 {
     if (m_bottomRightRadius != radius) {
         m_bottomRightRadius = radius;
-        m_cornerPixmapIsDirty = true;
+        m_cornerImageIsDirty = true;
         markDirty(DirtyMaterial);
     }
 }
@@ -232,9 +232,17 @@ void QSGSoftwareInternalRectangleNode::update()
         m_brush = QBrush(m_color);
     }
 
-    if (m_cornerPixmapIsDirty) {
-        generateCornerPixmap();
-        m_cornerPixmapIsDirty = false;
+    if (m_cornerImageIsDirty) {
+        generateCornerImage();
+        m_cornerImageIsDirty = false;
+    }
+}
+
+void QSGSoftwareInternalRectangleNode::prepare(qreal devicePixelRatio)
+{
+    if (!qFuzzyCompare(devicePixelRatio, m_devicePixelRatio)) {
+        m_devicePixelRatio = devicePixelRatio;
+        generateCornerImage();
     }
 }
 
@@ -242,10 +250,7 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 {
     //We can only check for a device pixel ratio change when we know what
     //paint device is being used.
-    if (!qFuzzyCompare(painter->device()->devicePixelRatio(), m_devicePixelRatio)) {
-        m_devicePixelRatio = painter->device()->devicePixelRatio();
-        generateCornerPixmap();
-    }
+    prepare(painter->device()->devicePixelRatio());
 
     if (painter->transform().isRotating()) {
         //Rotated rectangles lose the benefits of direct rendering, and have poor rendering
@@ -268,29 +273,31 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
                    && m_bottomRightRadius < 0) {
             //Rounded Rects and Rects with Borders
             //Avoids broken behaviors of QPainter::drawRect/roundedRect
-            QPixmap pixmap = QPixmap(qRound(m_rect.width() * m_devicePixelRatio), qRound(m_rect.height() * m_devicePixelRatio));
-            pixmap.fill(Qt::transparent);
-            pixmap.setDevicePixelRatio(m_devicePixelRatio);
-            QPainter pixmapPainter(&pixmap);
-            paintRectangle(&pixmapPainter, QRect(0, 0, m_rect.width(), m_rect.height()));
+            QImage image(qRound(m_rect.width() * m_devicePixelRatio), qRound(m_rect.height() * m_devicePixelRatio),
+                         QImage::Format_ARGB32_Premultiplied);
+            image.fill(Qt::transparent);
+            image.setDevicePixelRatio(m_devicePixelRatio);
+            QPainter imagePainter(&image);
+            paintRectangle(&imagePainter, QRect(0, 0, m_rect.width(), m_rect.height()));
 
             QPainter::RenderHints previousRenderHints = painter->renderHints();
             painter->setRenderHint(QPainter::SmoothPixmapTransform, true);
-            painter->drawPixmap(m_rect, pixmap);
+            painter->drawImage(m_rect, image);
             painter->setRenderHints(previousRenderHints);
         } else {
             // Corners with different radii. Split implementation to avoid
             // performance regression of the majority of cases
-            QPixmap pixmap = QPixmap(qRound(m_rect.width() * m_devicePixelRatio), qRound(m_rect.height() * m_devicePixelRatio));
-            pixmap.fill(Qt::transparent);
-            pixmap.setDevicePixelRatio(m_devicePixelRatio);
-            QPainter pixmapPainter(&pixmap);
+            QImage image(qRound(m_rect.width() * m_devicePixelRatio), qRound(m_rect.height() * m_devicePixelRatio),
+                         QImage::Format_ARGB32_Premultiplied);
+            image.fill(Qt::transparent);
+            image.setDevicePixelRatio(m_devicePixelRatio);
+            QPainter imagePainter(&image);
             // Slow function relying on paths
-            paintRectangleIndividualCorners(&pixmapPainter, QRect(0, 0, m_rect.width(), m_rect.height()));
+            paintRectangleIndividualCorners(&imagePainter, QRect(0, 0, m_rect.width(), m_rect.height()));
 
             QPainter::RenderHints previousRenderHints = painter->renderHints();
             painter->setRenderHint(QPainter::SmoothPixmapTransform, true);
-            painter->drawPixmap(m_rect, pixmap);
+            painter->drawImage(m_rect, image);
             painter->setRenderHints(previousRenderHints);
 
         }
@@ -396,24 +403,24 @@ void QSGSoftwareInternalRectangleNode::paintRectangle(QPainter *painter, const Q
     if (radius > 0) {
 
         if (radius * 2 >= rect.width() && radius * 2 >= rect.height()) {
-            //Blit whole pixmap for circles
-            painter->drawPixmap(rect, m_cornerPixmap, m_cornerPixmap.rect());
+            //Blit whole image for circles
+            painter->drawImage(rect, m_cornerImage, m_cornerImage.rect());
         } else {
 
             //blit 4 corners to border
             int scaledRadius = qRound(radius * m_devicePixelRatio);
             QRectF topLeftCorner(QPointF(rect.x(), rect.y()),
                                  QPointF(rect.x() + radius, rect.y() + radius));
-            painter->drawPixmap(topLeftCorner, m_cornerPixmap, QRectF(0, 0, scaledRadius, scaledRadius));
+            painter->drawImage(topLeftCorner, m_cornerImage, QRectF(0, 0, scaledRadius, scaledRadius));
             QRectF topRightCorner(QPointF(rect.x() + rect.width() - radius, rect.y()),
                                   QPointF(rect.x() + rect.width(), rect.y() + radius));
-            painter->drawPixmap(topRightCorner, m_cornerPixmap, QRectF(scaledRadius, 0, scaledRadius, scaledRadius));
+            painter->drawImage(topRightCorner, m_cornerImage, QRectF(scaledRadius, 0, scaledRadius, scaledRadius));
             QRectF bottomLeftCorner(QPointF(rect.x(), rect.y() + rect.height() - radius),
                                     QPointF(rect.x() + radius, rect.y() + rect.height()));
-            painter->drawPixmap(bottomLeftCorner, m_cornerPixmap, QRectF(0, scaledRadius, scaledRadius, scaledRadius));
+            painter->drawImage(bottomLeftCorner, m_cornerImage, QRectF(0, scaledRadius, scaledRadius, scaledRadius));
             QRectF bottomRightCorner(QPointF(rect.x() + rect.width() - radius, rect.y() + rect.height() - radius),
                                      QPointF(rect.x() + rect.width(), rect.y() + rect.height()));
-            painter->drawPixmap(bottomRightCorner, m_cornerPixmap, QRectF(scaledRadius, scaledRadius, scaledRadius, scaledRadius));
+            painter->drawImage(bottomRightCorner, m_cornerImage, QRectF(scaledRadius, scaledRadius, scaledRadius, scaledRadius));
 
         }
 
@@ -525,20 +532,20 @@ void QSGSoftwareInternalRectangleNode::paintRectangleIndividualCorners(QPainter
     }
 }
 
-void QSGSoftwareInternalRectangleNode::generateCornerPixmap()
+void QSGSoftwareInternalRectangleNode::generateCornerImage()
 {
-    //Generate new corner Pixmap
+    //Generate new corner image
     int radius = qFloor(qMin(qMin(m_rect.width(), m_rect.height()) * 0.5, m_radius));
     const auto width = qRound(radius * 2 * m_devicePixelRatio);
 
-    if (m_cornerPixmap.width() != width)
-        m_cornerPixmap = QPixmap(width, width);
+    if (m_cornerImage.width() != width)
+        m_cornerImage = QImage(width, width, QImage::Format_ARGB32_Premultiplied);
 
-    m_cornerPixmap.setDevicePixelRatio(m_devicePixelRatio);
-    m_cornerPixmap.fill(Qt::transparent);
+    m_cornerImage.setDevicePixelRatio(m_devicePixelRatio);
+    m_cornerImage.fill(Qt::transparent);
 
     if (radius > 0) {
-        QPainter cornerPainter(&m_cornerPixmap);
+        QPainter cornerPainter(&m_cornerImage);
         cornerPainter.setRenderHint(QPainter::Antialiasing);
         cornerPainter.setCompositionMode(QPainter::CompositionMode_Source);
 
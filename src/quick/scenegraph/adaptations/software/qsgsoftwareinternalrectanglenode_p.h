@@ -19,7 +19,7 @@
 
 #include <QPen>
 #include <QBrush>
-#include <QPixmap>
+#include <QImage>
 
 QT_BEGIN_NAMESPACE
 
@@ -44,6 +44,7 @@ public:
 
     void update() override;
 
+    void prepare(qreal devicePixelRatio);
     void paint(QPainter *);
 
     bool isOpaque() const;
@@ -51,7 +52,7 @@ public:
 private:
     void paintRectangle(QPainter *painter, const QRect &rect);
     void paintRectangleIndividualCorners(QPainter *painter, const QRect &rect);
-    void generateCornerPixmap();
+    void generateCornerImage();
 
     QRect m_rect;
     QColor m_color;
@@ -67,8 +68,8 @@ private:
     QBrush m_brush;
     bool m_vertical;
 
-    bool m_cornerPixmapIsDirty;
-    QPixmap m_cornerPixmap;
+    bool m_cornerImageIsDirty;
+    QImage m_cornerImage;
 
     qreal m_devicePixelRatio;
 };
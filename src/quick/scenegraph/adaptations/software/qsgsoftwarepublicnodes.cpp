@@ -60,8 +60,7 @@ void QSGSoftwareImageNode::setTextureCoordinatesTransform(QSGImageNode::TextureC
 
 void QSGSoftwareImageNode::paint(QPainter *painter)
 {
-    if (m_cachedMirroredPixmapIsDirty)
-        updateCachedMirroredPixmap();
+    prepare();
 
     painter->setRenderHint(QPainter::SmoothPixmapTransform, (m_filtering == QSGTexture::Linear));
     // Disable antialiased clipping. It causes transformed tiles to have gaps.
@@ -71,6 +71,11 @@ public:
     void setOwnsTexture(bool owns) override { m_owns = owns; }
     bool ownsTexture() const override { return m_owns; }
 
+    void prepare()
+    {
+        if (m_cachedMirroredPixmapIsDirty)
+            updateCachedMirroredPixmap();
+    }
     void paint(QPainter *painter);
 
 private:
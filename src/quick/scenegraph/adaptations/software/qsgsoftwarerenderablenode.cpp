@@ -213,11 +213,8 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
 
     // Check for don't paint conditions
     if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
+        if (!needsPainting())
+            return finishPainting(false);
     } else {
         if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
             m_isDirty = false;
@@ -250,12 +247,70 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         }
     }
 
+    paint(painter, m_dirtyRegion, forceOpaquePainting);
+    return finishPainting(true);
+}
+
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    return m_isDirty && !qFuzzyIsNull(m_opacity) && !m_dirtyRegion.isEmpty();
+}
+
+/*
+    Returns whether paint() only reads QImage backed content. Unlike QPixmap,
+    QImage can be painted from threads other than the GUI thread.
+*/
+bool QSGSoftwareRenderableNode::isImageBacked() const
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::SimpleRect:
+    case QSGSoftwareRenderableNode::Rectangle:
+    case QSGSoftwareRenderableNode::Glyph:
+    case QSGSoftwareRenderableNode::SimpleRectangle:
+        return true;
+    case QSGSoftwareRenderableNode::SimpleTexture:
+        return qobject_cast<QSGPlainTexture *>(m_handle.simpleTextureNode->texture()) != nullptr;
+    default:
+        // Textures, layers and painted content are held in QPixmaps
+        return false;
+    }
+}
+
+/*
+    Settles the caches which node types otherwise update from their paint()
+    function, so that paint() can be called from several threads at once.
+*/
+void QSGSoftwareRenderableNode::preparePaint(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Image:
+        m_handle.imageNode->prepare();
+        break;
+    case QSGSoftwareRenderableNode::Rectangle:
+        m_handle.rectangleNode->prepare(devicePixelRatio);
+        break;
+    case QSGSoftwareRenderableNode::SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->prepare();
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+    Paints the node, limited to \a clipRegion which must be part of the
+    dirty region. Does not change the dirty state, see finishPainting().
+*/
+void QSGSoftwareRenderableNode::paint(QPainter *painter, const QRegion &clipRegion, bool forceOpaquePainting)
+{
+    Q_ASSERT(m_nodeType != RenderNode);
+
     painter->save();
     painter->setOpacity(m_opacity);
 
     // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
     // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    painter->setClipRegion(clipRegion, Qt::ReplaceClip);
     if (m_clipRegion.rectCount() > 1)
         painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
 
@@ -310,9 +365,15 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     }
 
     painter->restore();
+}
 
-    QRegion areaToBeFlushed = m_dirtyRegion;
-    m_previousDirtyRegion = QRegion(m_boundingRectMax);
+QRegion QSGSoftwareRenderableNode::finishPainting(bool painted)
+{
+    QRegion areaToBeFlushed;
+    if (painted) {
+        areaToBeFlushed = m_dirtyRegion;
+        m_previousDirtyRegion = QRegion(m_boundingRectMax);
+    }
     m_isDirty = false;
     m_dirtyRegion = QRegion();
 
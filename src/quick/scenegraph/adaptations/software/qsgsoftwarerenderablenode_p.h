@@ -62,6 +62,11 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+    bool needsPainting() const;
+    bool isImageBacked() const;
+    void preparePaint(qreal devicePixelRatio);
+    void paint(QPainter *painter, const QRegion &clipRegion, bool forceOpaquePainting = false);
+    QRegion finishPainting(bool painted);
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
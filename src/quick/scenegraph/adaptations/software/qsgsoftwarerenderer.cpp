@@ -10,7 +10,9 @@
 
 #include <QtGui/QPaintDevice>
 #include <QtGui/QBackingStore>
+#include <QtGui/QImage>
 #include <QElapsedTimer>
+#include <QThread>
 
 Q_STATIC_LOGGING_CATEGORY(lcRenderer, "qt.scenegraph.softwarecontext.renderer")
 
@@ -21,6 +23,12 @@ QSGSoftwareRenderer::QSGSoftwareRenderer(QSGRenderContext *context)
     , m_paintDevice(nullptr)
     , m_backingStore(nullptr)
 {
+    m_renderThreadCount = qEnvironmentVariableIsSet("QSG_SOFTWARE_RENDER_THREADS")
+            ? qEnvironmentVariableIntValue("QSG_SOFTWARE_RENDER_THREADS")
+            : QThread::idealThreadCount();
+    m_tileSize = qMax(16, qEnvironmentVariableIsSet("QSG_SOFTWARE_TILE_SIZE")
+            ? qEnvironmentVariableIntValue("QSG_SOFTWARE_TILE_SIZE")
+            : 128);
 }
 
 QSGSoftwareRenderer::~QSGSoftwareRenderer()
@@ -117,22 +125,36 @@ void QSGSoftwareRenderer::render()
         usingBackingStore = true;
     }
 
-    QPainter painter(paintDevice);
-    painter.setRenderHint(QPainter::Antialiasing);
-    auto rc = static_cast<QSGSoftwareRenderContext *>(context());
-    QPainter *prevPainter = rc->m_activePainter;
-    rc->m_activePainter = &painter;
-
     // Render the contents Renderlist
-    m_flushRegion = renderNodes(&painter);
+    // Large updates of image backed devices are split into tiles which are
+    // rasterized in parallel.
+    const QRect updateBounds = updateRegion.boundingRect();
+    const bool renderInTiles = m_renderThreadCount > 1
+            && paintDevice->devType() == QInternal::Image
+            && (updateBounds.width() > m_tileSize || updateBounds.height() > m_tileSize)
+            && canRenderNodesInTiles(paintDevice->devicePixelRatio());
+    if (renderInTiles) {
+        m_flushRegion = renderNodesInTiles(static_cast<QImage *>(paintDevice), updateRegion,
+                                           m_tileSize, m_renderThreadCount);
+    } else {
+        QPainter painter(paintDevice);
+        painter.setRenderHint(QPainter::Antialiasing);
+        auto rc = static_cast<QSGSoftwareRenderContext *>(context());
+        QPainter *prevPainter = rc->m_activePainter;
+        rc->m_activePainter = &painter;
+
+        m_flushRegion = renderNodes(&painter);
+
+        painter.end();
+        rc->m_activePainter = prevPainter;
+    }
     qint64 renderTime = renderTimer.elapsed();
 
-    painter.end();
     if (usingBackingStore)
         m_backingStore->endPaint();
 
-    rc->m_activePainter = prevPainter;
-    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime;
+    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime
+                        << (renderInTiles ? "tiled" : "");
 }
 
 QT_END_NAMESPACE
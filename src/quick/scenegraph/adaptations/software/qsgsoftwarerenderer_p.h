@@ -41,6 +41,8 @@ private:
     QPaintDevice* m_paintDevice;
     QBackingStore* m_backingStore;
     QRegion m_flushRegion;
+    int m_renderThreadCount;
+    int m_tileSize;
 };
 
 QT_END_NAMESPACE
@@ -37,7 +37,7 @@ Texture *Atlas::create(QByteArrayView data, const QSize &size)
     // Align reservation to 16x16, >= any compressed block size
     QSize paddedSize(((size.width() + 15) / 16) * 16, ((size.height() + 15) / 16) * 16);
     // No need to lock, as manager already locked it.
-    QRect rect = m_allocator.allocate(paddedSize);
+    QRect rect = allocate(paddedSize);
     if (rect.width() > 0 && rect.height() > 0) {
         Texture *t = new Texture(this, rect, data, size);
         m_pending_uploads << t;
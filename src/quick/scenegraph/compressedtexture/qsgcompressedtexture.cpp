@@ -6,6 +6,12 @@
 #include <QDebug>
 #include <QtQuick/private/qquickwindow_p.h>
 #include <QtQuick/private/qquickitem_p.h>
+#include <QtGui/private/qtexturefilereader_p.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qset.h>
 #include <rhi/qrhi.h>
 
 QT_BEGIN_NAMESPACE
@@ -436,6 +442,197 @@ QSize QSGCompressedTextureFactory::textureSize() const
     return m_textureData.size();
 }
 
+namespace {
+
+struct VariantInfo
+{
+    const char *suffix;
+    QSGCompressedTextureVariantFactory::Variant variant;
+    QRhiTexture::Format probeFormat;
+};
+
+// In order of preference
+constexpr VariantInfo variantInfos[] = {
+    { "astc", QSGCompressedTextureVariantFactory::AstcVariant, QRhiTexture::ASTC_4x4 },
+    { "bc", QSGCompressedTextureVariantFactory::BcVariant, QRhiTexture::BC3 },
+    { "etc2", QSGCompressedTextureVariantFactory::Etc2Variant, QRhiTexture::ETC2_RGBA8 }
+};
+
+// -1 until the scene graph of a window was initialized
+QBasicAtomicInt supportedVariantMask = Q_BASIC_ATOMIC_INITIALIZER(-1);
+
+}
+
+/*
+    Returns whether \a variantFileName exists. Each directory is listed only
+    once, so that looking for the variants of images that have none does not
+    cost a stat() for each of them.
+*/
+static bool variantFileExists(const QString &variantFileName)
+{
+    Q_CONSTINIT static QBasicMutex mutex;
+    static QHash<QString, QSet<QString>> directories;
+
+    const qsizetype slash = variantFileName.lastIndexOf(u'/');
+    const QString directory = slash < 0 ? QStringLiteral(".") : variantFileName.left(slash);
+    const QString name = variantFileName.mid(slash + 1);
+
+    QMutexLocker locker(&mutex);
+    auto it = directories.constFind(directory);
+    if (it == directories.constEnd()) {
+        const QStringList entries = QDir(directory).entryList({ QStringLiteral("*.ktx") }, QDir::Files);
+        it = directories.insert(directory, QSet<QString>(entries.cbegin(), entries.cend()));
+    }
+    return it->contains(name);
+}
+
+/*!
+    \internal
+    Holds the compressed textures that were generated at build time for an
+    image, so that it can be uploaded in a format the graphics API supports
+    instead of being decoded.
+
+    The variants of \c{image.png} are stored next to it as
+    \c{image.png.astc.ktx}, \c{image.png.bc.ktx} and \c{image.png.etc2.ktx}.
+    Once the scene graph of a window has been initialized, create() only loads
+    the most preferred variant that its QRhi supports. Before that, it loads
+    all of them, and the image has to be decoded as well, and passed with
+    setFallback(), in case the graphics API supports none of them. All of
+    them are kept for the lifetime of the factory, since the same factory can
+    create textures for windows that use different graphics APIs.
+*/
+QSGCompressedTextureVariantFactory::QSGCompressedTextureVariantFactory(const QList<QTextureFileData> &variants,
+                                                                       const QString &fileName,
+                                                                       bool needsFallback)
+    : m_variants(variants), m_fileName(fileName), m_needsFallback(needsFallback)
+{
+    Q_ASSERT(!m_variants.isEmpty());
+}
+
+QSGCompressedTextureVariantFactory::~QSGCompressedTextureVariantFactory() = default;
+
+/*!
+    \internal
+    Sets the factory for the decoded image, which is used if the graphics API
+    supports none of the variants. Takes ownership of \a fallback.
+*/
+void QSGCompressedTextureVariantFactory::setFallback(QQuickTextureFactory *fallback)
+{
+    QMutexLocker locker(&m_mutex);
+    m_fallback.reset(fallback);
+}
+
+/*!
+    \internal
+    Returns the factory for the compressed variants of the image in
+    \a fileName, or \nullptr if there are none that can be used.
+*/
+QSGCompressedTextureVariantFactory *QSGCompressedTextureVariantFactory::create(const QString &fileName)
+{
+    const int mask = supportedVariantMask.loadAcquire();
+    if (mask == 0)
+        return nullptr;
+
+    QList<QTextureFileData> variants;
+    for (const VariantInfo &info : variantInfos) {
+        if (mask > 0 && !(mask & info.variant))
+            continue;
+
+        const QString variantFileName = fileName + u'.' + QLatin1StringView(info.suffix)
+                + QStringLiteral(".ktx");
+        if (!variantFileExists(variantFileName))
+            continue;
+
+        QFile file(variantFileName);
+        if (!file.open(QIODevice::ReadOnly))
+            continue;
+        QTextureFileReader reader(&file, variantFileName);
+        const QTextureFileData data = reader.canRead() ? reader.read() : QTextureFileData();
+        if (!data.isValid()) {
+            qCDebug(QSG_LOG_TEXTUREIO) << "Invalid compressed variant" << variantFileName;
+            continue;
+        }
+        qCDebug(QSG_LOG_TEXTUREIO) << "Using compressed variant" << variantFileName;
+        variants.append(data);
+
+        // The graphics API is known, so this is the variant that it will use
+        if (mask > 0)
+            break;
+    }
+
+    if (variants.isEmpty())
+        return nullptr;
+    return new QSGCompressedTextureVariantFactory(variants, fileName, mask < 0);
+}
+
+/*!
+    \internal
+    Records which variants \a rhi supports, so that create() only loads the
+    one that will be used. When windows use different graphics APIs, only
+    the variants that all of them support are loaded.
+*/
+void QSGCompressedTextureVariantFactory::registerRhi(QRhi *rhi)
+{
+    int mask = 0;
+    for (const VariantInfo &info : variantInfos) {
+        if (rhi->isTextureFormatSupported(info.probeFormat))
+            mask |= info.variant;
+    }
+
+    int current = supportedVariantMask.loadRelaxed();
+    while (!supportedVariantMask.testAndSetOrdered(current, current < 0 ? mask : (current & mask), current))
+        ;
+}
+
+/*!
+    \internal
+    Returns the variants that the graphics APIs of all windows support, or -1
+    if the scene graph of no window has been initialized yet.
+*/
+int QSGCompressedTextureVariantFactory::supportedVariants()
+{
+    return supportedVariantMask.loadAcquire();
+}
+
+QSGTexture *QSGCompressedTextureVariantFactory::createTexture(QQuickWindow *window) const
+{
+    QMutexLocker locker(&m_mutex);
+    QRhi *rhi = window->rhi();
+    for (const QTextureFileData &variant : std::as_const(m_variants)) {
+        const QSGCompressedTexture::FormatInfo fmt = QSGCompressedTexture::formatInfo(variant.glInternalFormat());
+        if (fmt.rhiFormat == QRhiTexture::UnknownFormat)
+            continue;
+        QRhiTexture::Flags texFlags;
+        if (fmt.isSRGB)
+            texFlags |= QRhiTexture::sRGB;
+        if (rhi && !rhi->isTextureFormatSupported(fmt.rhiFormat, texFlags))
+            continue;
+
+        return QSGCompressedTextureFactory(variant).createTexture(window);
+    }
+
+    if (!m_fallback) {
+        qCWarning(QSG_LOG_TEXTUREIO) << "No supported compressed texture variant for" << m_fileName;
+        return nullptr;
+    }
+    qCDebug(QSG_LOG_TEXTUREIO) << "No supported compressed variant, using the decoded" << m_fileName;
+    return m_fallback->createTexture(window);
+}
+
+int QSGCompressedTextureVariantFactory::textureByteCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    int byteCount = m_fallback ? m_fallback->textureByteCount() : 0;
+    for (const QTextureFileData &variant : std::as_const(m_variants))
+        byteCount += variant.getDataView().size();
+    return byteCount;
+}
+
+QSize QSGCompressedTextureVariantFactory::textureSize() const
+{
+    return m_variants.first().size();
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qsgcompressedtexture_p.cpp"
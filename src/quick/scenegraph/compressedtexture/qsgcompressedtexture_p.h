@@ -21,6 +21,9 @@
 #include <rhi/qrhi.h>
 #include <QQuickTextureFactory>
 #include <QOpenGLFunctions>
+#include <QtCore/qmutex.h>
+
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -77,6 +80,38 @@ protected:
     QTextureFileData m_textureData;
 };
 
+class Q_QUICK_EXPORT QSGCompressedTextureVariantFactory : public QQuickTextureFactory
+{
+public:
+    enum Variant {
+        AstcVariant = 0x1,
+        BcVariant = 0x2,
+        Etc2Variant = 0x4
+    };
+
+    QSGCompressedTextureVariantFactory(const QList<QTextureFileData> &variants,
+                                       const QString &fileName, bool needsFallback);
+    ~QSGCompressedTextureVariantFactory() override;
+
+    QSGTexture *createTexture(QQuickWindow *window) const override;
+    int textureByteCount() const override;
+    QSize textureSize() const override;
+
+    bool needsFallback() const { return m_needsFallback; }
+    void setFallback(QQuickTextureFactory *fallback);
+
+    static QSGCompressedTextureVariantFactory *create(const QString &fileName);
+    static void registerRhi(QRhi *rhi);
+    static int supportedVariants();
+
+private:
+    mutable QMutex m_mutex;
+    const QList<QTextureFileData> m_variants;
+    std::unique_ptr<QQuickTextureFactory> m_fallback;
+    QString m_fileName;
+    bool m_needsFallback;
+};
+
 QT_END_NAMESPACE
 
 #endif // QSGCOMPRESSEDTEXTURE_P_H
@@ -580,6 +580,7 @@ void Updater::visitGeometryNode(Node *n)
         }
         if (m_opacityChange) {
             Element *e = n->element();
+            renderer->addDamage(e);
             if (e->batch)
                 renderer->invalidateBatchAndOverlappingRenderOrders(e->batch);
         }
@@ -863,6 +864,11 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     , m_renderOrderRebuildLower(-1)
     , m_renderOrderRebuildUpper(-1)
 #endif
+    , m_partialUpdate(false)
+    , m_fullDamage(true)
+    , m_damageScissorEnabled(false)
+    , m_damagedElements(64)
+    , m_lastRenderTarget(nullptr)
     , m_currentMaterial(nullptr)
     , m_currentShader(nullptr)
     , m_vertexUploadPool(256)
@@ -896,6 +902,9 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
     m_srbPoolThreshold = qt_sg_envInt("QSG_RENDERER_SRB_POOL_THRESHOLD", 1024);
     m_bufferPoolSizeLimit = qt_sg_envInt("QSG_RENDERER_BUFFER_POOL_LIMIT", DEFAULT_BUFFER_POOL_SIZE_LIMIT);
+    m_occlusionCulling = qt_sg_envInt("QSG_RENDERER_OCCLUSION_CULLING", 0) != 0;
+    m_partialUpdate = qt_sg_envInt("QSG_RENDERER_PARTIAL_UPDATE", 0) != 0;
+    m_damage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
 
     if (Q_UNLIKELY(debug_build() || debug_render() || debug_pools())) {
         qDebug("Batch thresholds: nodes: %d vertices: %d srb pool: %d buffer pool: %d",
@@ -1205,6 +1214,7 @@ void Renderer::nodeWasTransformed(Node *node, int *vertexCount)
         *vertexCount += gn->geometry()->vertexCount();
         Element *e  = node->element();
         if (e) {
+            addDamage(e);
             e->boundsComputed = false;
             if (e->batch) {
                 if (!e->batch->isOpaque) {
@@ -1235,10 +1245,12 @@ void Renderer::nodeWasAdded(QSGNode *node, Node *shadowParent)
     if (node->type() == QSGNode::GeometryNodeType) {
         snode->data = m_elementAllocator.allocate();
         snode->element()->setNode(static_cast<QSGGeometryNode *>(node));
+        addDamage(snode->element());
 
     } else if (node->type() == QSGNode::ClipNodeType) {
         snode->data = new ClipBatchRootInfo;
         m_rebuild |= FullRebuild;
+        m_fullDamage = true;
 
     } else if (node->type() == QSGNode::RenderNodeType) {
         QSGRenderNode *rn = static_cast<QSGRenderNode *>(node);
@@ -1274,6 +1286,7 @@ void Renderer::nodeWasRemoved(Node *node)
     if (node->type() == QSGNode::GeometryNodeType) {
         Element *e = node->element();
         if (e) {
+            addDamage(e);
             e->removed = true;
             m_elementsToDelete.add(e);
             e->node = nullptr;
@@ -1292,6 +1305,7 @@ void Renderer::nodeWasRemoved(Node *node)
         removeBatchRootFromParent(node);
         delete node->clipInfo();
         m_rebuild |= FullRebuild;
+        m_fullDamage = true;
         m_taggedRoots.remove(node);
 
     } else if (node->isBatchRoot) {
@@ -1327,6 +1341,7 @@ void Renderer::turnNodeIntoBatchRoot(Node *node)
 {
     if (Q_UNLIKELY(debug_change())) qDebug(" - new batch root");
     m_rebuild |= FullRebuild;
+    m_fullDamage = true;
     node->isBatchRoot = true;
     node->becameBatchRoot = true;
 
@@ -1417,6 +1432,10 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
 
     shadowNode->dirtyState |= state;
 
+    // Moving a batch root moves its whole subtree, which is not worth tracking
+    if (state & QSGNode::DirtyMatrix && shadowNode->isBatchRoot)
+        m_fullDamage = true;
+
     if (state & QSGNode::DirtyMatrix && !shadowNode->isBatchRoot) {
         Q_ASSERT(node->type() == QSGNode::TransformNodeType);
         if (node->m_subtreeRenderableCount > m_batchNodeThreshold) {
@@ -1434,6 +1453,7 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
         QSGGeometryNode *gn = static_cast<QSGGeometryNode *>(node);
         Element *e = shadowNode->element();
         if (e) {
+            addDamage(e);
             e->boundsComputed = false;
             Batch *b = e->batch;
             if (b) {
@@ -1446,9 +1466,13 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
         }
     }
 
+    if (state & QSGNode::DirtyGeometry && node->type() == QSGNode::ClipNodeType)
+        m_fullDamage = true;
+
     if (state & QSGNode::DirtyMaterial && node->type() == QSGNode::GeometryNodeType) {
         Element *e = shadowNode->element();
         if (e) {
+            addDamage(e);
             bool blended = hasMaterialWithBlending(static_cast<QSGGeometryNode *>(node));
             if (e->isMaterialBlended != blended) {
                 m_rebuild |= Renderer::FullRebuild;
@@ -1940,6 +1964,239 @@ static inline int qsg_fixIndexCount(int iCount, int drawMode)
     }
 }
 
+/*
+ * Occlusion culling: opaque elements which are known to cover their entire
+ * bounding rect, meaning an unclipped, axis aligned quad, are used as
+ * occluders. Batches whose elements are all inside an occluder which is
+ * rendered on top of them produce no visible pixels, and are neither uploaded
+ * nor rendered. To keep the cost down, only the largest few occluders are
+ * considered.
+ */
+
+static bool qsg_isOccluder(Element *e)
+{
+    QSGGeometryNode *gn = e->node;
+    if (gn->clipList())
+        return false;
+
+    QSGGeometry *g = gn->geometry();
+    if (g->drawingMode() != QSGGeometry::DrawTriangleStrip || g->vertexCount() != 4 || g->indexCount() != 0)
+        return false;
+
+    const QMatrix4x4 &m = *gn->matrix();
+    if (!m.isAffine() || m(0, 1) != 0 || m(1, 0) != 0)
+        return false;
+
+    const int offset = qsg_positionAttribute(g);
+    if (offset < 0)
+        return false;
+
+    Pt pts[4];
+    const char *vd = static_cast<const char *>(g->vertexData()) + offset;
+    for (int i = 0; i < 4; ++i) {
+        pts[i] = *reinterpret_cast<const Pt *>(vd);
+        vd += g->sizeOfVertex();
+    }
+    const float minX = std::min({ pts[0].x, pts[1].x, pts[2].x, pts[3].x });
+    const float maxX = std::max({ pts[0].x, pts[1].x, pts[2].x, pts[3].x });
+    const float minY = std::min({ pts[0].y, pts[1].y, pts[2].y, pts[3].y });
+    const float maxY = std::max({ pts[0].y, pts[1].y, pts[2].y, pts[3].y });
+    if (!(minX < maxX && minY < maxY))
+        return false;
+
+    // All four corners must be present, and the strip's shared edge (v1, v2)
+    // must be a diagonal, otherwise the two triangles do not fill the rect.
+    int corner[4];
+    int corners = 0;
+    for (int i = 0; i < 4; ++i) {
+        if ((pts[i].x != minX && pts[i].x != maxX) || (pts[i].y != minY && pts[i].y != maxY))
+            return false;
+        corner[i] = (pts[i].x == maxX ? 1 : 0) | (pts[i].y == maxY ? 2 : 0);
+        corners |= 1 << corner[i];
+    }
+    return corners == 0xf && (corner[0] ^ corner[3]) == 3 && (corner[1] ^ corner[2]) == 3;
+}
+
+void Renderer::findOccluders()
+{
+    m_occluders.clear();
+
+    // Occlusion is irrelevant for the visualizers and the 2D-in-3D mode
+    if (!m_occlusionCulling
+            || m_renderMode == QSGRendererInterface::RenderMode3D
+            || m_visualizer->mode() != Visualizer::VisualizeNothing) {
+        return;
+    }
+
+    const auto area = [](const Element *e) {
+        return qreal(e->bounds.br.x - e->bounds.tl.x) * qreal(e->bounds.br.y - e->bounds.tl.y);
+    };
+
+    for (int i = 0; i < m_opaqueRenderList.size(); ++i) {
+        Element *e = m_opaqueRenderList.at(i);
+        if (!e || e->removed || !e->batch || !qsg_isOccluder(e))
+            continue;
+        e->ensureBoundsValid();
+        if (e->boundsOutsideFloatRange)
+            continue;
+
+        // Keep the largest occluders, sorted by decreasing area
+        const qreal a = area(e);
+        if (m_occluders.size() == m_occluders.capacity() && a <= area(m_occluders.last()))
+            continue;
+        if (m_occluders.size() == m_occluders.capacity())
+            m_occluders.removeLast();
+        auto it = std::find_if(m_occluders.begin(), m_occluders.end(),
+                               [&](const Element *o) { return area(o) < a; });
+        m_occluders.insert(it, e);
+    }
+}
+
+bool Renderer::isBatchOccluded(Batch *batch)
+{
+    if (m_occluders.isEmpty() || batch->isRenderNode)
+        return false;
+
+    for (Element *e = batch->first; e; e = e->nextInBatch) {
+        e->ensureBoundsValid();
+        if (e->boundsOutsideFloatRange)
+            return false;
+        // Bounds are relative to the batch root, so only occluders sharing
+        // the root can be compared.
+        bool covered = false;
+        for (const Element *o : std::as_const(m_occluders)) {
+            if (o->root == e->root && o->order > e->order && o->bounds.contains(e->bounds)) {
+                covered = true;
+                break;
+            }
+        }
+        if (!covered)
+            return false;
+    }
+    return true;
+}
+
+QMatrix4x4 qsg_matrixForRoot(Node *node);
+
+/*
+ * Damage is collected in scene coordinates while nodes change: the bounds an
+ * element had in the previous frame are added right away, and its new bounds
+ * are added in computeDamage() once the updater has run. Changes which affect
+ * more than a single element, like moving a batch root or changing a clip,
+ * mark the entire target as damaged.
+ */
+void Renderer::addDamage(Element *e)
+{
+    if (m_fullDamage)
+        return;
+
+    if (e->boundsComputed) {
+        if (e->boundsOutsideFloatRange) {
+            m_fullDamage = true;
+            return;
+        }
+        Rect r = e->bounds;
+        if (e->root)
+            r.map(qsg_matrixForRoot(e->root));
+        m_damage |= r;
+    }
+
+    if (!e->damaged) {
+        e->damaged = true;
+        m_damagedElements.add(e);
+    }
+}
+
+static bool qsg_preservesColorContents(QRhiRenderTarget *rt)
+{
+    return rt->resourceType() == QRhiResource::TextureRenderTarget
+            && rt->sampleCount() <= 1
+            && static_cast<QRhiTextureRenderTarget *>(rt)->flags().testFlag(QRhiTextureRenderTarget::PreserveColorContents);
+}
+
+void Renderer::computeDamage()
+{
+    const QSGRenderTarget &rt = renderTarget();
+    const QRect fullRect(QPoint(0, 0), deviceRect().size());
+    // The current matrices are only set up when preparing the batches, which
+    // happens later in the frame, so take the projection from the source.
+    const QMatrix4x4 projection = projectionMatrixWithNativeNDCCount() > 0
+            ? projectionMatrixWithNativeNDC(0) : QMatrix4x4();
+
+    if (rt.rt != m_lastRenderTarget
+            || deviceRect() != m_lastDeviceRect
+            || projection != m_lastProjectionMatrix
+            || clearColor() != m_lastClearColor
+            || m_renderMode != QSGRendererInterface::RenderMode2D
+            || rt.multiViewCount > 1
+            || !m_renderNodeElements.isEmpty()
+            || m_visualizer->mode() != Visualizer::VisualizeNothing) {
+        m_fullDamage = true;
+    }
+    m_lastRenderTarget = rt.rt;
+    m_lastDeviceRect = deviceRect();
+    m_lastProjectionMatrix = projection;
+    m_lastClearColor = clearColor();
+
+    for (int i = 0; i < m_damagedElements.size(); ++i) {
+        Element *e = m_damagedElements.at(i);
+        e->damaged = false;
+        if (m_fullDamage || e->removed || !e->node)
+            continue;
+        e->ensureBoundsValid();
+        if (e->boundsOutsideFloatRange) {
+            m_fullDamage = true;
+            continue;
+        }
+        Rect r = e->bounds;
+        if (e->root)
+            r.map(qsg_matrixForRoot(e->root));
+        m_damage |= r;
+    }
+    m_damagedElements.reset();
+
+    if (m_fullDamage) {
+        m_damageScissor = fullRect;
+    } else if (m_damage.tl.x > m_damage.br.x || m_damage.tl.y > m_damage.br.y) {
+        m_damageScissor = QRect();
+    } else {
+        // Same mapping as for scissor clips in updateClipState(), with an
+        // extra pixel on each side to account for rounding.
+        Rect ndc = m_damage;
+        ndc.map(projection);
+        const qint32 x1 = qFloor((ndc.tl.x + 1) * fullRect.width() * qreal(0.5)) - 1;
+        const qint32 y1 = qFloor((ndc.tl.y + 1) * fullRect.height() * qreal(0.5)) - 1;
+        const qint32 x2 = qCeil((ndc.br.x + 1) * fullRect.width() * qreal(0.5)) + 1;
+        const qint32 y2 = qCeil((ndc.br.y + 1) * fullRect.height() * qreal(0.5)) + 1;
+        m_damageScissor = QRect(x1, y1, x2 - x1, y2 - y1) & fullRect;
+    }
+
+    m_damageRect = QRect(m_damageScissor.x(),
+                         fullRect.height() - m_damageScissor.y() - m_damageScissor.height(),
+                         m_damageScissor.width(),
+                         m_damageScissor.height());
+
+    // Only a render target which keeps its contents between passes allows
+    // limiting rendering to the damaged area.
+    m_damageScissorEnabled = m_partialUpdate && !m_fullDamage && qsg_preservesColorContents(rt.rt);
+}
+
+bool Renderer::isBatchOutsideDamage(Batch *batch)
+{
+    if (!m_damageScissorEnabled)
+        return false;
+
+    for (Element *e = batch->first; e; e = e->nextInBatch) {
+        e->ensureBoundsValid();
+        Rect r = e->bounds;
+        if (e->root)
+            r.map(qsg_matrixForRoot(e->root));
+        if (r.intersects(m_damage))
+            return false;
+    }
+    return true;
+}
+
 static inline float calculateElementZOrder(const Element *e, qreal zRange)
 {
     // Clamp the zOrder to within the min and max depth of the viewport.
@@ -2390,6 +2647,10 @@ void Renderer::updateClipState(const QSGClipNode *clipList, Batch *batch)
 
     ClipState::ClipType clipType = ClipState::NoClip;
     QRect scissorRect;
+    if (m_damageScissorEnabled) {
+        clipType = ClipState::ScissorClip;
+        scissorRect = m_damageScissor;
+    }
     QVarLengthArray<const QSGClipNode *, 4> stencilClipNodes;
     const QSGClipNode *clip = clipList;
 
@@ -3744,6 +4005,9 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
 
     m_resourceUpdates = m_rhi->nextResourceUpdateBatch();
 
+    // Must happen before removed elements are deleted
+    computeDamage();
+
     if (m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)) {
         bool complete = (m_rebuild & BuildRenderLists) != 0;
         if (complete)
@@ -3824,6 +4088,27 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
 
     if (Q_UNLIKELY(debug_render())) ctx->timeSorting = ctx->timer.restart();
 
+    // Occluded batches are not uploaded, they keep needsUpload set and get
+    // uploaded in the first frame where they are visible again.
+    findOccluders();
+    m_occlusionStatistics = OcclusionStatistics();
+    m_occlusionStatistics.occluderCount = m_occluders.size();
+    ctx->skippedBatches = 0;
+    for (int i=0; i<m_opaqueBatches.size(); ++i) {
+        Batch *b = m_opaqueBatches.at(i);
+        b->isOccluded = isBatchOccluded(b);
+        b->isOutsideDamage = isBatchOutsideDamage(b);
+        m_occlusionStatistics.occludedOpaqueBatches += b->isOccluded;
+        ctx->skippedBatches += b->isOutsideDamage;
+    }
+    for (int i=0; i<m_alphaBatches.size(); ++i) {
+        Batch *b = m_alphaBatches.at(i);
+        b->isOccluded = isBatchOccluded(b);
+        b->isOutsideDamage = isBatchOutsideDamage(b);
+        m_occlusionStatistics.occludedAlphaBatches += b->isOccluded;
+        ctx->skippedBatches += b->isOutsideDamage;
+    }
+
     // Set size to 0, nothing is deallocated, they will "grow" again
     // as part of uploadBatch.
     m_vertexUploadPool.reset();
@@ -3832,21 +4117,27 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
     for (int i=0; i<m_opaqueBatches.size(); ++i) {
         Batch *b = m_opaqueBatches.at(i);
-        uploadBatch(b);
+        if (!b->isOccluded && !b->isOutsideDamage)
+            uploadBatch(b);
     }
     if (Q_UNLIKELY(debug_render())) ctx->timeUploadOpaque = ctx->timer.restart();
 
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
     for (int i=0; i<m_alphaBatches.size(); ++i) {
         Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
+        if (!b->isOccluded && !b->isOutsideDamage)
+            uploadBatch(b);
     }
     if (Q_UNLIKELY(debug_render())) ctx->timeUploadAlpha = ctx->timer.restart();
 
     if (Q_UNLIKELY(debug_render())) {
         qDebug().nospace() << "Rendering:" << Qt::endl
                            << " -> Opaque: " << qsg_countNodesInBatches(m_opaqueBatches) << " nodes in " << m_opaqueBatches.size() << " batches..." << Qt::endl
-                           << " -> Alpha: " << qsg_countNodesInBatches(m_alphaBatches) << " nodes in " << m_alphaBatches.size() << " batches...";
+                           << " -> Alpha: " << qsg_countNodesInBatches(m_alphaBatches) << " nodes in " << m_alphaBatches.size() << " batches..." << Qt::endl
+                           << " -> Occluded: " << m_occlusionStatistics.occludedOpaqueBatches << " opaque and " << m_occlusionStatistics.occludedAlphaBatches
+                           << " alpha batches, by " << m_occlusionStatistics.occluderCount << " occluders..." << Qt::endl
+                           << " -> Damage: " << m_damageRect << (m_damageScissorEnabled ? " (scissored), " : ", ")
+                           << ctx->skippedBatches << " batches outside...";
     }
 
     m_current_opacity = 1;
@@ -3854,6 +4145,11 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     m_currentShader = nullptr;
     m_currentProgram = nullptr;
     m_currentClipState.reset();
+    if (m_damageScissorEnabled) {
+        m_currentClipState.type = ClipState::ScissorClip;
+        m_currentClipState.scissor = QRhiScissor(m_damageScissor.x(), m_damageScissor.y(),
+                                                 m_damageScissor.width(), m_damageScissor.height());
+    }
 
     const QRect viewport = viewportRect();
 
@@ -3889,6 +4185,8 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     if (Q_LIKELY(renderOpaque)) {
         for (int i = 0, ie = m_opaqueBatches.size(); i != ie; ++i) {
             Batch *b = m_opaqueBatches.at(i);
+            if (b->isOccluded || b->isOutsideDamage)
+                continue;
             PreparedRenderBatch renderBatch;
             bool ok;
             if (b->merged)
@@ -3919,6 +4217,8 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     if (Q_LIKELY(renderAlpha)) {
         for (int i = 0, ie = m_alphaBatches.size(); i != ie; ++i) {
             Batch *b = m_alphaBatches.at(i);
+            if (b->isOccluded || b->isOutsideDamage)
+                continue;
             PreparedRenderBatch renderBatch;
             bool ok;
             if (b->merged)
@@ -3933,6 +4233,8 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     }
 
     m_rebuild = 0;
+    m_fullDamage = false;
+    m_damage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
 
 #if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
     m_renderOrderRebuildLower = -1;
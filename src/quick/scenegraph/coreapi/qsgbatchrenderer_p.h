@@ -245,6 +245,10 @@ struct Rect {
         return xOverlap && yOverlap;
     }
 
+    bool contains(const Rect &r) const {
+        return r.tl.x >= tl.x && r.tl.y >= tl.y && r.br.x <= br.x && r.br.y <= br.y;
+    }
+
     bool isOutsideFloatRange() const {
         return tl.x < -QSG_RENDERER_COORD_LIMIT
                 || tl.y < -QSG_RENDERER_COORD_LIMIT
@@ -276,6 +280,7 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , damaged(false)
     {
     }
 
@@ -309,6 +314,7 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint damaged : 1; // queued in m_damagedElements for this frame
 };
 
 struct RenderNodeElement : public Element {
@@ -425,6 +431,8 @@ struct Batch
         isRenderNode = false;
         ubufDataValid = false;
         needsPurge = false;
+        isOccluded = false;
+        isOutsideDamage = false;
         clipState.reset();
         blendConstant = QColor();
     }
@@ -445,6 +453,8 @@ struct Batch
     uint isRenderNode : 1;
     uint ubufDataValid : 1;
     uint needsPurge : 1;
+    uint isOccluded : 1; // fully covered by an opaque element this frame
+    uint isOutsideDamage : 1; // not touching the damaged area of a partial update
 
     mutable uint uploadedThisFrame : 1; // solely for debugging purposes
 
@@ -748,6 +758,16 @@ public:
     Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMode renderMode = QSGRendererInterface::RenderMode2D);
     ~Renderer();
 
+    QRect damageRect() const override { return m_damageRect; }
+
+    struct OcclusionStatistics {
+        int occluderCount = 0;
+        int occludedOpaqueBatches = 0;
+        int occludedAlphaBatches = 0;
+    };
+    // of the last render pass that was prepared
+    OcclusionStatistics occlusionStatistics() const { return m_occlusionStatistics; }
+
 protected:
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
     void render() override;
@@ -771,6 +791,7 @@ protected:
         quint64 timeSorting;
         quint64 timeUploadOpaque;
         quint64 timeUploadAlpha;
+        int skippedBatches;
     };
 
     // update batches and queue and commit rhi resource updates
@@ -810,6 +831,11 @@ private:
     bool checkOverlap(int first, int last, const Rect &bounds);
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
+    void findOccluders();
+    bool isBatchOccluded(Batch *batch);
+    void addDamage(Element *e);
+    void computeDamage();
+    bool isBatchOutsideDamage(Batch *batch);
 
     void uploadBatch(Batch *b);
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
@@ -894,6 +920,21 @@ private:
     int m_batchVertexThreshold;
     int m_srbPoolThreshold;
     int m_bufferPoolSizeLimit;
+    bool m_occlusionCulling;
+    QVarLengthArray<Element *, 8> m_occluders;
+    OcclusionStatistics m_occlusionStatistics;
+
+    bool m_partialUpdate;
+    bool m_fullDamage;
+    bool m_damageScissorEnabled;
+    Rect m_damage; // in scene coordinates
+    QDataBuffer<Element *> m_damagedElements;
+    QRect m_damageRect; // in device pixels, top-left origin
+    QRect m_damageScissor; // in framebuffer pixels, bottom-left origin
+    QRhiRenderTarget *m_lastRenderTarget;
+    QRect m_lastDeviceRect;
+    QMatrix4x4 m_lastProjectionMatrix;
+    QColor m_lastClearColor;
 
     Visualizer *m_visualizer;
 
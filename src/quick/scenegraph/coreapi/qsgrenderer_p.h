@@ -86,6 +86,8 @@ public:
     virtual void setVisualizationMode(const QByteArray &) { }
     virtual bool hasVisualizationModeWithContinuousUpdate() const { return false; }
     virtual void releaseCachedResources() { }
+    // Area changed by the last rendered frame, in device pixels with a top-left origin
+    virtual QRect damageRect() const { return deviceRect(); }
 
     void clearChangedFlag() { m_changed_emitted = false; }
 
@@ -6,6 +6,7 @@
 #include <qmath.h>
 #include <QtQuick/private/qsgdistancefieldglyphnode_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgglyphdiskcache_p.h>
 #include <private/qrawfont_p.h>
 #include <QtGui/qguiapplication.h>
 #include <qdir.h>
@@ -69,17 +70,112 @@ QSGDistanceFieldGlyphCache::GlyphData &QSGDistanceFieldGlyphCache::glyphData(gly
     QHash<glyph_t, GlyphData>::iterator data = m_glyphsData.find(glyph);
     if (data == m_glyphsData.end()) {
         GlyphData &gd = emptyData(glyph);
+        if (loadCachedGlyphData(glyph, gd))
+            return gd;
         gd.path = m_referenceFont.pathForGlyph(glyph);
         // need bounding rect in base font size scale
         qreal scaleFactor = qreal(1) / QT_DISTANCEFIELD_SCALE(m_doubleGlyphResolution);
         QTransform scaleDown;
         scaleDown.scale(scaleFactor, scaleFactor);
         gd.boundingRect = scaleDown.mapRect(gd.path.boundingRect());
+        if (gd.boundingRect.isEmpty())
+            storeCachedDistanceField(glyph, gd, QDistanceField());
         return gd;
     }
     return data.value();
 }
 
+namespace {
+    // Record stored in the glyph disk cache for each glyph, followed by
+    // width * height bytes of distance field data
+    struct CachedDistanceField {
+        qreal boundingRect[4];
+        quint32 width;
+        quint32 height;
+    };
+}
+
+QSGGlyphDiskCache *QSGDistanceFieldGlyphCache::diskCache()
+{
+    // Created lazily, since subclasses may change the reference font and resolution
+    // when loading pregenerated glyphs in their constructors
+    if (!m_diskCacheChecked) {
+        m_diskCacheChecked = true;
+        if (QSGGlyphDiskCache::isEnabled()) {
+            m_diskCache = std::make_unique<QSGGlyphDiskCache>(m_referenceFont,
+                                                              "distancefield",
+                                                              baseFontSize(),
+                                                              m_doubleGlyphResolution ? 1 : 0);
+        }
+    }
+    return m_diskCache.get();
+}
+
+bool QSGDistanceFieldGlyphCache::loadCachedGlyphData(glyph_t glyph, GlyphData &gd)
+{
+    QSGGlyphDiskCache *cache = diskCache();
+    if (!cache)
+        return false;
+
+    const QByteArrayView data = cache->find(glyph);
+    if (data.size() < qsizetype(sizeof(CachedDistanceField)))
+        return false;
+
+    CachedDistanceField record;
+    memcpy(&record, data.data(), sizeof(record));
+    if (data.size() != qsizetype(sizeof(record) + qint64(record.width) * record.height))
+        return false;
+
+    gd.boundingRect = QRectF(record.boundingRect[0], record.boundingRect[1],
+                             record.boundingRect[2], record.boundingRect[3]);
+    return true;
+}
+
+QDistanceField QSGDistanceFieldGlyphCache::loadCachedDistanceField(glyph_t glyph, const QSize &size)
+{
+    QSGGlyphDiskCache *cache = diskCache();
+    if (!cache)
+        return QDistanceField();
+
+    const QByteArrayView data = cache->find(glyph);
+    CachedDistanceField record;
+    if (data.size() < qsizetype(sizeof(record)))
+        return QDistanceField();
+    memcpy(&record, data.data(), sizeof(record));
+    if (int(record.width) != size.width() || int(record.height) != size.height()
+            || data.size() != qsizetype(sizeof(record) + qint64(record.width) * record.height)) {
+        return QDistanceField();
+    }
+
+    // An empty path gives a cleared field of the right size, tagged with the glyph index
+    QDistanceField field(size, QPainterPath(), glyph, m_doubleGlyphResolution);
+    memcpy(field.bits(), data.data() + sizeof(record), data.size() - sizeof(record));
+    return field;
+}
+
+void QSGDistanceFieldGlyphCache::storeCachedDistanceField(glyph_t glyph,
+                                                          const GlyphData &gd,
+                                                          const QDistanceField &field)
+{
+    QSGGlyphDiskCache *cache = diskCache();
+    if (!cache)
+        return;
+
+    CachedDistanceField record;
+    record.boundingRect[0] = gd.boundingRect.x();
+    record.boundingRect[1] = gd.boundingRect.y();
+    record.boundingRect[2] = gd.boundingRect.width();
+    record.boundingRect[3] = gd.boundingRect.height();
+    record.width = field.isNull() ? 0 : field.width();
+    record.height = field.isNull() ? 0 : field.height();
+
+    QByteArray data(sizeof(record) + qsizetype(record.width) * record.height, Qt::Uninitialized);
+    memcpy(data.data(), &record, sizeof(record));
+    if (!field.isNull())
+        memcpy(data.data() + sizeof(record), field.constBits(), data.size() - sizeof(record));
+    cache->insert(glyph, data);
+}
+
 QSGDistanceFieldGlyphCache::Metrics QSGDistanceFieldGlyphCache::glyphMetrics(glyph_t glyph, qreal pixelSize)
 {
     GlyphData &gd = glyphData(glyph);
@@ -165,15 +261,22 @@ void QSGDistanceFieldGlyphCache::update()
     const int pendingGlyphsSize = m_pendingGlyphs.size();
     distanceFields.reserve(pendingGlyphsSize);
     for (int i = 0; i < pendingGlyphsSize; ++i) {
-        GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
+        const glyph_t glyph = m_pendingGlyphs.at(i);
+        GlyphData &gd = glyphData(glyph);
 
         QSize size = QSize(qCeil(gd.texCoord.width + gd.texCoord.xMargin * 2),
                            qCeil(gd.texCoord.height + gd.texCoord.yMargin * 2));
 
-        distanceFields.append(QDistanceField(size,
-                                             gd.path,
-                                             m_pendingGlyphs.at(i),
-                                             m_doubleGlyphResolution));
+        QDistanceField field = loadCachedDistanceField(glyph, size);
+        if (field.isNull()) {
+            // The path is not loaded for glyphs whose metrics came from the disk cache
+            if (gd.path.isEmpty())
+                gd.path = m_referenceFont.pathForGlyph(glyph);
+            field = QDistanceField(size, gd.path, glyph, m_doubleGlyphResolution);
+            storeCachedDistanceField(glyph, gd, field);
+        }
+
+        distanceFields.append(field);
         gd.path = QPainterPath(); // no longer needed, so release memory used by the painter path
     }
 
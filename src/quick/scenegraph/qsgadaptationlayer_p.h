@@ -33,12 +33,15 @@
 #include <private/qintrusivelist_p.h>
 #include <rhi/qshader.h>
 
+#include <memory>
+
 // ### remove
 #include <QtQuick/private/qquicktext_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QSGNode;
+class QSGGlyphDiskCache;
 class QImage;
 class TextureReference;
 class QSGDistanceFieldGlyphNode;
@@ -509,6 +512,11 @@ protected:
 
     int baseFontSize() const;
 
+    QSGGlyphDiskCache *diskCache();
+    bool loadCachedGlyphData(glyph_t glyph, GlyphData &gd);
+    QDistanceField loadCachedDistanceField(glyph_t glyph, const QSize &size);
+    void storeCachedDistanceField(glyph_t glyph, const GlyphData &gd, const QDistanceField &field);
+
 #if defined(QSG_DISTANCEFIELD_CACHE_DEBUG)
     virtual void saveTexture(QRhiTexture *texture, const QString &nameBase) const = 0;
 #endif
@@ -526,6 +534,8 @@ private:
     QDataBuffer<glyph_t> m_pendingGlyphs;
     QSet<glyph_t> m_populatingGlyphs;
     QSGDistanceFieldGlyphConsumerList m_registeredNodes;
+    std::unique_ptr<QSGGlyphDiskCache> m_diskCache;
+    bool m_diskCacheChecked = false;
 
     static Texture s_emptyTexture;
 };
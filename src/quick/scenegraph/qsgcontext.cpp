@@ -5,6 +5,7 @@
 #include <QtQuick/private/qsgtexture_p.h>
 #include <QtQuick/private/qsgrenderer_p.h>
 #include <QtQuick/private/qquickpixmap_p.h>
+#include <QtQuick/private/qquickpixmapcache_p.h>
 #include <QtQuick/private/qsgadaptationlayer_p.h>
 #include <QtQuick/private/qsginternaltextnode_p.h>
 
@@ -534,6 +535,19 @@ QRhi *QSGRenderContext::rhi() const
     QQuickShaderEffectSource used in the QML scene.
  */
 
+/*
+    An estimate of the memory that \a texture holds, for the pixmap cache's
+    texture budget. Textures in an atlas do not count, as releasing them
+    leaves the atlas as it is.
+*/
+static qsizetype textureByteCount(const QSGTexture *texture)
+{
+    if (!texture || texture->isAtlasTexture())
+        return 0;
+    const QSize size = texture->textureSize();
+    return qsizetype(size.width()) * size.height() * 4;
+}
+
 QSGTexture *QSGRenderContext::textureForFactory(QQuickTextureFactory *factory, QQuickWindow *window)
 {
     if (!factory)
@@ -550,6 +564,8 @@ QSGTexture *QSGRenderContext::textureForFactory(QQuickTextureFactory *factory, Q
         m_textures.insert(factory, texture);
         m_mutex.unlock();
 
+        QQuickPixmapCache::instance()->textureCreated(factory, textureByteCount(texture));
+
         connect(factory, SIGNAL(destroyed(QObject*)), this, SLOT(textureFactoryDestroyed(QObject*)), Qt::DirectConnection);
     }
     return texture;
@@ -558,8 +574,23 @@ QSGTexture *QSGRenderContext::textureForFactory(QQuickTextureFactory *factory, Q
 void QSGRenderContext::textureFactoryDestroyed(QObject *o)
 {
     m_mutex.lock();
-    m_texturesToDelete << m_textures.take(o);
+    QSGTexture *texture = m_textures.take(o);
+    m_texturesToDelete << texture;
     m_mutex.unlock();
+
+    QQuickPixmapCache::instance()->textureReleased(o, textureByteCount(texture));
+}
+
+/*!
+    Deletes the textures created by textureForFactory(), when the context
+    is invalidated.
+*/
+void QSGRenderContext::releaseFactoryTextures()
+{
+    for (auto it = m_textures.cbegin(); it != m_textures.cend(); ++it)
+        QQuickPixmapCache::instance()->textureReleased(it.key(), textureByteCount(it.value()));
+    qDeleteAll(m_textures);
+    m_textures.clear();
 }
 
 /*!
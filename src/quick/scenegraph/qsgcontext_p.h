@@ -206,6 +206,8 @@ protected:
     friend bool operator==(const QSGRenderContext::FontKey &f1, const QSGRenderContext::FontKey &f2);
     friend size_t qHash(const QSGRenderContext::FontKey &f, size_t seed);
 
+    void releaseFactoryTextures();
+
     // Hold m_sg with QPointer in the rare case it gets deleted before us.
     QPointer<QSGContext> m_sg;
 
@@ -6,9 +6,13 @@
 #include "qsgcurvestrokenode_p.h"
 #include "qsgcurveprocessor_p.h"
 #include "util/qquadpath_p.h"
+#include "util/qsgglyphdiskcache_p.h"
 
+#include <QtCore/qdatastream.h>
 #include <QtGui/qrawfont.h>
 #include <QtGui/qpainterpath.h>
+#include <QtGui/qvector2d.h>
+#include <QtGui/qvector3d.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -22,16 +26,101 @@ QSGCurveGlyphAtlas::QSGCurveGlyphAtlas(const QRawFont &font)
     // because this also has the benefit it's big enough that hinting will be disabled.
     static int curveGlyphAtlasFontSize = qEnvironmentVariableIntValue("QSGCURVEGLYPHATLAS_FONT_SIZE");
     m_font.setPixelSize(curveGlyphAtlasFontSize > 0 ? qreal(curveGlyphAtlasFontSize) : 64.0);
+
+    if (QSGGlyphDiskCache::isEnabled())
+        m_diskCache = std::make_unique<QSGGlyphDiskCache>(m_font, "curve", qRound(m_font.pixelSize()));
 }
 
 QSGCurveGlyphAtlas::~QSGCurveGlyphAtlas()
 {
 }
 
+namespace {
+    // The cached geometry of a glyph is stored as the lists of the Glyph struct in
+    // declaration order, each as its element count followed by the elements, with
+    // floating point values in single precision
+    template<typename T>
+    void writeList(QDataStream &stream, const QList<T> &list)
+    {
+        stream << quint32(list.size());
+        for (const T &value : list)
+            stream << value;
+    }
+
+    template<typename T>
+    bool readList(QDataStream &stream, qsizetype elementSize, QList<T> *list)
+    {
+        quint32 count;
+        stream >> count;
+        if (stream.status() != QDataStream::Ok
+                || qint64(count) * elementSize > stream.device()->bytesAvailable()) {
+            return false;
+        }
+        list->resize(count);
+        for (T &value : *list)
+            stream >> value;
+        return stream.status() == QDataStream::Ok;
+    }
+}
+
+bool QSGCurveGlyphAtlas::loadCachedGlyph(glyph_t glyphIndex, Glyph *glyph)
+{
+    if (!m_diskCache)
+        return false;
+
+    const QByteArrayView data = m_diskCache->find(glyphIndex);
+    if (data.isEmpty())
+        return false;
+
+    QDataStream stream(QByteArray::fromRawData(data.data(), data.size()));
+    stream.setByteOrder(QDataStream::ByteOrder(QSysInfo::ByteOrder));
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    return readList(stream, 2 * sizeof(float), &glyph->vertices)
+        && readList(stream, 3 * sizeof(float), &glyph->uvs)
+        && readList(stream, 2 * sizeof(float), &glyph->normals)
+        && readList(stream, 2 * sizeof(float), &glyph->duvdx)
+        && readList(stream, 2 * sizeof(float), &glyph->duvdy)
+        && readList(stream, 2 * sizeof(float), &glyph->strokeVertices)
+        && readList(stream, 2 * sizeof(float), &glyph->strokeUvs)
+        && readList(stream, 2 * sizeof(float), &glyph->strokeNormals)
+        && readList(stream, 1, &glyph->strokeElementIsLine)
+        && stream.atEnd();
+}
+
+void QSGCurveGlyphAtlas::storeCachedGlyph(glyph_t glyphIndex, const Glyph &glyph)
+{
+    if (!m_diskCache)
+        return;
+
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::ByteOrder(QSysInfo::ByteOrder));
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    writeList(stream, glyph.vertices);
+    writeList(stream, glyph.uvs);
+    writeList(stream, glyph.normals);
+    writeList(stream, glyph.duvdx);
+    writeList(stream, glyph.duvdy);
+    writeList(stream, glyph.strokeVertices);
+    writeList(stream, glyph.strokeUvs);
+    writeList(stream, glyph.strokeNormals);
+    writeList(stream, glyph.strokeElementIsLine);
+    if (stream.status() == QDataStream::Ok)
+        m_diskCache->insert(glyphIndex, data);
+}
+
 void QSGCurveGlyphAtlas::populate(const QList<glyph_t> &glyphs)
 {
     for (glyph_t glyphIndex : glyphs) {
         if (!m_glyphs.contains(glyphIndex)) {
+            Glyph cachedGlyph;
+            if (loadCachedGlyph(glyphIndex, &cachedGlyph)) {
+                m_glyphs.insert(glyphIndex, cachedGlyph);
+                continue;
+            }
+
             QPainterPath path = m_font.pathForGlyph(glyphIndex);
             QQuadPath quadPath = QQuadPath::fromPainterPath(path);
             quadPath.setFillRule(Qt::WindingFill);
@@ -86,6 +175,7 @@ void QSGCurveGlyphAtlas::populate(const QList<glyph_t> &glyphs)
                                                glyph.duvdy.append(QVector2D(uvForPoint(v.at(0) + QVector2D(0, 1))) - QVector2D(uv1));
                                            });
 
+            storeCachedGlyph(glyphIndex, glyph);
             m_glyphs.insert(glyphIndex, glyph);
         }
     }
@@ -19,10 +19,13 @@
 #include <QtGui/private/qtextengine_p.h>
 #include <QtQuick/qtquickexports.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 class QSGCurveFillNode;
 class QSGCurveStrokeNode;
+class QSGGlyphDiskCache;
 
 class Q_QUICK_EXPORT QSGCurveGlyphAtlas
 {
@@ -59,8 +62,12 @@ private:
         QList<bool> strokeElementIsLine;
     };
 
+    bool loadCachedGlyph(glyph_t glyphIndex, Glyph *glyph);
+    void storeCachedGlyph(glyph_t glyphIndex, const Glyph &glyph);
+
     QHash<glyph_t, Glyph> m_glyphs;
     QRawFont m_font;
+    std::unique_ptr<QSGGlyphDiskCache> m_diskCache;
 };
 
 QT_END_NAMESPACE
@@ -7,6 +7,8 @@
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qhash.h>
 
+#include <numeric>
+
 QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(lcSGCurveProcessor, "qt.quick.curveprocessor");
@@ -859,34 +861,42 @@ bool QSGCurveProcessor::solveOverlaps(QQuadPath &path)
 // triangles that define the elements.
 // We will order the elements first and then pool them depending on their x-values. This should
 // reduce the complexity to O(n log n), where n is the number of elements in the path.
+// The bounding rectangles are kept in separate arrays per coordinate, so that computing them and
+// testing the pool against a new element are plain loops over floats that the compiler
+// vectorizes. Paths with thousands of elements, like map overlays, spend most of their time there.
 QList<QPair<int, int>> QSGCurveProcessor::findOverlappingCandidates(const QQuadPath &path)
 {
-    struct BRect { float xmin; float xmax; float ymin; float ymax; };
+    const int elementCount = path.elementCount();
 
     // Calculate all bounding rectangles
-    QVarLengthArray<int, 64> elementStarts, elementEnds;
-    QVarLengthArray<BRect, 64> boundingRects;
-    elementStarts.reserve(path.elementCount());
-    boundingRects.reserve(path.elementCount());
-    for (int i = 0; i < path.elementCount(); i++) {
-        QQuadPath::Element e = path.elementAt(i);
-
-        BRect bR{qMin(qMin(e.startPoint().x(), e.controlPoint().x()), e.endPoint().x()),
-                 qMax(qMax(e.startPoint().x(), e.controlPoint().x()), e.endPoint().x()),
-                 qMin(qMin(e.startPoint().y(), e.controlPoint().y()), e.endPoint().y()),
-                 qMax(qMax(e.startPoint().y(), e.controlPoint().y()), e.endPoint().y())};
-        boundingRects.append(bR);
-        elementStarts.append(i);
+    QVarLengthArray<float, 64> xmin(elementCount), xmax(elementCount);
+    QVarLengthArray<float, 64> ymin(elementCount), ymax(elementCount);
+    for (int i = 0; i < elementCount; i++) {
+        const QQuadPath::Element &e = path.elementAt(i);
+        const QVector2D sp = e.startPoint();
+        const QVector2D cp = e.controlPoint();
+        const QVector2D ep = e.endPoint();
+        xmin[i] = qMin(qMin(sp.x(), cp.x()), ep.x());
+        xmax[i] = qMax(qMax(sp.x(), cp.x()), ep.x());
+        ymin[i] = qMin(qMin(sp.y(), cp.y()), ep.y());
+        ymax[i] = qMax(qMax(sp.y(), cp.y()), ep.y());
     }
 
     // Sort the bounding rectangles by x-startpoint and x-endpoint
-    auto compareXmin = [&](int i, int j){return boundingRects.at(i).xmin < boundingRects.at(j).xmin;};
-    auto compareXmax = [&](int i, int j){return boundingRects.at(i).xmax < boundingRects.at(j).xmax;};
+    QVarLengthArray<int, 64> elementStarts(elementCount), elementEnds;
+    std::iota(elementStarts.begin(), elementStarts.end(), 0);
+    auto compareXmin = [&](int i, int j){return xmin[i] < xmin[j];};
+    auto compareXmax = [&](int i, int j){return xmax[i] < xmax[j];};
     std::sort(elementStarts.begin(), elementStarts.end(), compareXmin);
     elementEnds = elementStarts;
     std::sort(elementEnds.begin(), elementEnds.end(), compareXmax);
 
-    QList<int> bRpool;
+    // The pool holds the elements in the order they were added, with copies of
+    // their y-extents for the overlap test
+    QVarLengthArray<int, 64> pool;
+    QVarLengthArray<float, 64> poolYmin, poolYmax;
+    QVarLengthArray<char, 64> inPool(elementCount, 0);
+    QVarLengthArray<char, 64> overlapsY;
     QList<QPair<int, int>> overlappingBB;
 
     // Start from x = xmin and move towards xmax. Add a rectangle to the pool and check for
@@ -894,26 +904,49 @@ QList<QPair<int, int>> QSGCurveProcessor::findOverlappingCandidates(const QQuadP
     // than the new xmin, it can be removed from the pool.
     int firstElementEnd = 0;
     for (const int addIndex : std::as_const(elementStarts)) {
-        const BRect &newR = boundingRects.at(addIndex);
+        const float newXmin = xmin[addIndex];
+        const float newYmin = ymin[addIndex];
+        const float newYmax = ymax[addIndex];
+
         // First remove elements from the pool that cannot touch the new one
         // because xmax is too small
-        while (bRpool.size() && firstElementEnd < elementEnds.size()) {
-            int removeIndex = elementEnds.at(firstElementEnd);
-            if (bRpool.contains(removeIndex) && newR.xmin > boundingRects.at(removeIndex).xmax) {
-                bRpool.removeOne(removeIndex);
+        bool removed = false;
+        while (!pool.isEmpty() && firstElementEnd < elementEnds.size()) {
+            const int removeIndex = elementEnds.at(firstElementEnd);
+            if (inPool[removeIndex] && newXmin > xmax[removeIndex]) {
+                inPool[removeIndex] = 0;
+                removed = true;
                 firstElementEnd++;
             } else {
                 break;
             }
         }
+        if (removed) {
+            qsizetype kept = 0;
+            for (qsizetype j = 0; j < pool.size(); j++) {
+                if (!inPool[pool[j]])
+                    continue;
+                pool[kept] = pool[j];
+                poolYmin[kept] = poolYmin[j];
+                poolYmax[kept] = poolYmax[j];
+                kept++;
+            }
+            pool.resize(kept);
+            poolYmin.resize(kept);
+            poolYmax.resize(kept);
+        }
+
+        // Now compare the new element with all elements in the pool. We don't have to check
+        // for x because the pooling takes care of it. Non-neighbors can also just touch.
+        const qsizetype poolSize = pool.size();
+        overlapsY.resize(poolSize);
+        for (qsizetype j = 0; j < poolSize; j++)
+            overlapsY[j] = !(poolYmax[j] < newYmin) & !(newYmax < poolYmin[j]);
 
-        // Now compare the new element with all elements in the pool.
-        for (int j = 0; j < bRpool.size(); j++) {
-            int i = bRpool.at(j);
-            const BRect &r1 = boundingRects.at(i);
-            // We don't have to check for x because the pooling takes care of it.
-            //if (r1.xmax <= newR.xmin || newR.xmax <= r1.xmin)
-            //    continue;
+        for (qsizetype j = 0; j < poolSize; j++) {
+            if (!overlapsY[j])
+                continue;
+            const int i = pool[j];
 
             bool isNeighbor = false;
             if (i - addIndex == 1) {
@@ -924,15 +957,17 @@ QList<QPair<int, int>> QSGCurveProcessor::findOverlappingCandidates(const QQuadP
                     isNeighbor = true;
             }
             // Neighbors need to be completely different (otherwise they just share a point)
-            if (isNeighbor && (r1.ymax <= newR.ymin || newR.ymax <= r1.ymin))
-                continue;
-            // Non-neighbors can also just touch
-            if (!isNeighbor && (r1.ymax < newR.ymin || newR.ymax < r1.ymin))
+            if (isNeighbor && (poolYmax[j] <= newYmin || newYmax <= poolYmin[j]))
                 continue;
             // If the bounding boxes are overlapping it is a candidate for an intersection.
             overlappingBB.append(QPair<int, int>(i, addIndex));
         }
-        bRpool.append(addIndex); //Add the new element to the pool.
+
+        //Add the new element to the pool.
+        pool.append(addIndex);
+        poolYmin.append(newYmin);
+        poolYmax.append(newYmax);
+        inPool[addIndex] = 1;
     }
     return overlappingBB;
 }
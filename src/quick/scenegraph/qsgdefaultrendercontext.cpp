@@ -48,6 +48,7 @@ void QSGDefaultRenderContext::initialize(const QSGRenderContext::InitParams *par
 
     m_rhi = m_initParams.rhi;
     m_maxTextureSize = m_rhi->resourceLimit(QRhi::TextureSizeMax);
+    QSGCompressedTextureVariantFactory::registerRhi(m_rhi);
     if (!m_rhiAtlasManager)
         m_rhiAtlasManager = new QSGRhiAtlasTexture::Manager(this, m_initParams.initialSurfacePixelSize, m_initParams.maybeSurface);
 
@@ -98,8 +99,7 @@ void QSGDefaultRenderContext::invalidate()
     qDeleteAll(m_texturesToDelete);
     m_texturesToDelete.clear();
 
-    qDeleteAll(m_textures);
-    m_textures.clear();
+    releaseFactoryTextures();
 
     /* The cleanup of the atlas textures is a bit intriguing.
        As part of the cleanup in the threaded render loop, we
@@ -76,6 +76,8 @@ public:
     QSGRenderer *createRenderer(QSGRendererInterface::RenderMode renderMode = QSGRendererInterface::RenderMode2D) override;
     QSGTexture *compressedTextureForFactory(const QSGCompressedTextureFactory *factory) const override;
 
+    QSGRhiAtlasTexture::Manager *atlasManager() const { return m_rhiAtlasManager; }
+
     virtual void initializeRhiShader(QSGMaterialShader *shader, QShader::Variant shaderVariant);
 
     int maxTextureSize() const override { return m_maxTextureSize; }
@@ -948,4 +948,81 @@ QDebug operator<<(QDebug stream, const QQuadPath &path)
     return stream;
 }
 
+#ifndef QT_NO_DATASTREAM
+QDataStream &operator<<(QDataStream &stream, const QQuadPath::Element &element)
+{
+    const quint8 bits = element.m_isSubpathStart | element.m_isSubpathEnd << 1 | element.m_isLine << 2;
+    stream << element.sp << element.cp << element.ep << qint32(element.m_firstChildIndex)
+           << element.m_numChildren << quint8(element.m_curvatureFlags) << bits;
+    return stream;
+}
+
+QDataStream &operator>>(QDataStream &stream, QQuadPath::Element &element)
+{
+    qint32 firstChildIndex;
+    quint8 curvatureFlags;
+    quint8 bits;
+    stream >> element.sp >> element.cp >> element.ep >> firstChildIndex
+           >> element.m_numChildren >> curvatureFlags >> bits;
+    const quint8 validCurvatureFlags = QQuadPath::Element::FillOnRight | QQuadPath::Element::Convex;
+    if ((curvatureFlags & ~validCurvatureFlags) || (bits & ~0x7)) {
+        stream.setStatus(QDataStream::ReadCorruptData);
+        element = QQuadPath::Element();
+        return stream;
+    }
+    element.m_firstChildIndex = firstChildIndex;
+    element.m_curvatureFlags = QQuadPath::Element::CurvatureFlags(curvatureFlags);
+    element.m_isSubpathStart = bits & 1;
+    element.m_isSubpathEnd = (bits >> 1) & 1;
+    element.m_isLine = (bits >> 2) & 1;
+    return stream;
+}
+
+/*!
+    \internal
+    Writes \a path to \a stream including the child elements and the
+    curvature data, so that a path that was processed for filling can be
+    restored without processing it again.
+*/
+QDataStream &operator<<(QDataStream &stream, const QQuadPath &path)
+{
+    stream << path.m_elements << path.m_childElements << path.m_windingFill
+           << quint8(path.m_hints.toInt());
+    return stream;
+}
+
+QDataStream &operator>>(QDataStream &stream, QQuadPath &path)
+{
+    quint8 hints;
+    path = QQuadPath();
+    stream >> path.m_elements >> path.m_childElements >> path.m_windingFill >> hints;
+
+    // The children of an element are looked up without bounds checks, so
+    // reject anything the path itself could not have produced. Children are
+    // always appended after their parent, which also rules out cycles.
+    const auto childrenInRange = [&path](const QQuadPath::Element &e, qsizetype minIndex) {
+        if (e.m_numChildren == 0)
+            return true;
+        return e.m_firstChildIndex >= minIndex
+                && qsizetype(e.m_firstChildIndex) + e.m_numChildren <= path.m_childElements.size();
+    };
+    const quint8 validHints = QQuadPath::PathLinear | QQuadPath::PathQuadratic
+            | QQuadPath::PathConvex | QQuadPath::PathFillOnRight | QQuadPath::PathSolid
+            | QQuadPath::PathNonIntersecting | QQuadPath::PathNonOverlappingControlPointTriangles;
+    bool valid = stream.status() == QDataStream::Ok && !(hints & ~validHints);
+    for (qsizetype i = 0; valid && i < path.m_elements.size(); ++i)
+        valid = childrenInRange(path.m_elements.at(i), 0);
+    for (qsizetype i = 0; valid && i < path.m_childElements.size(); ++i)
+        valid = childrenInRange(path.m_childElements.at(i), i + 1);
+
+    if (!valid) {
+        stream.setStatus(QDataStream::ReadCorruptData);
+        path = QQuadPath();
+        return stream;
+    }
+    path.m_hints = QQuadPath::PathHints(hints);
+    return stream;
+}
+#endif
+
 QT_END_NAMESPACE
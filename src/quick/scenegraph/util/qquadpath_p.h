@@ -18,6 +18,7 @@
 #include <QtCore/qrect.h>
 #include <QtCore/qlist.h>
 #include <QtCore/qdebug.h>
+#include <QtCore/qdatastream.h>
 #include <QtGui/qvector2d.h>
 #include <QtGui/qpainterpath.h>
 #include <QtQuick/qtquickexports.h>
@@ -183,6 +184,10 @@ public:
         quint8 m_isLine : 1;
         friend class QQuadPath;
         friend Q_QUICK_EXPORT QDebug operator<<(QDebug, const QQuadPath::Element &);
+#ifndef QT_NO_DATASTREAM
+        friend Q_QUICK_EXPORT QDataStream &operator<<(QDataStream &, const QQuadPath::Element &);
+        friend Q_QUICK_EXPORT QDataStream &operator>>(QDataStream &, QQuadPath::Element &);
+#endif
     };
 
     void moveTo(const QVector2D &to)
@@ -320,6 +325,10 @@ private:
     Element::CurvatureFlags coordinateOrderOfElement(const Element &element) const;
 
     friend Q_QUICK_EXPORT QDebug operator<<(QDebug, const QQuadPath &);
+#ifndef QT_NO_DATASTREAM
+    friend Q_QUICK_EXPORT QDataStream &operator<<(QDataStream &, const QQuadPath &);
+    friend Q_QUICK_EXPORT QDataStream &operator>>(QDataStream &, QQuadPath &);
+#endif
 
     QList<Element> m_elements;
     QList<Element> m_childElements;
@@ -336,6 +345,13 @@ Q_DECLARE_OPERATORS_FOR_FLAGS(QQuadPath::PathHints);
 Q_QUICK_EXPORT QDebug operator<<(QDebug, const QQuadPath::Element &);
 Q_QUICK_EXPORT QDebug operator<<(QDebug, const QQuadPath &);
 
+#ifndef QT_NO_DATASTREAM
+Q_QUICK_EXPORT QDataStream &operator<<(QDataStream &, const QQuadPath::Element &);
+Q_QUICK_EXPORT QDataStream &operator>>(QDataStream &, QQuadPath::Element &);
+Q_QUICK_EXPORT QDataStream &operator<<(QDataStream &, const QQuadPath &);
+Q_QUICK_EXPORT QDataStream &operator>>(QDataStream &, QQuadPath &);
+#endif
+
 QT_END_NAMESPACE
 
 #endif
@@ -0,0 +1,259 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qsgglyphdiskcache_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qscopeguard.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(lcGlyphDiskCache, "qt.scenegraph.glyphdiskcache")
+
+/*!
+    \internal
+    \class QSGGlyphDiskCache
+
+    Persistent, per-font store of pre-processed glyph data, such as distance
+    field bitmaps or curve renderer geometry. It is only active when the
+    \c QSG_GLYPH_DISK_CACHE_PATH environment variable points to a writable
+    directory.
+
+    Each cache file is identified by a hash of the font data, the kind of data
+    stored, the pixel size and a caller defined variant. The file starts with a
+    header holding the format version, followed by a sequence of self-contained
+    records which are appended as new glyphs are generated, and it is memory
+    mapped lazily on the first lookup. Records are stored in native byte order,
+    since the cache is not meant to be shared between machines.
+
+    A file of a different format version is discarded, and a truncated or
+    corrupted record discards the rest of the file.
+
+    Several processes can use the same file. Appending records and replacing
+    the file are serialized through a lock file, and the file is never
+    shrunk in place, since other processes may have it mapped. Instead, a
+    new file is written and renamed over the old one.
+*/
+
+namespace {
+    enum : quint32 {
+        FileMagic = 0x46475351, // "QSGF"
+        RecordMagic = 0x47475351, // "QSGG"
+        FormatVersion = 2
+    };
+
+    struct FileHeader {
+        quint32 magic;
+        quint32 version;
+    };
+
+    struct RecordHeader {
+        quint32 magic;
+        quint32 glyph;
+        quint32 size;
+    };
+
+    // The cache is only an optimization, so rather skip it than wait for long
+    constexpr int LockTimeout = 100;
+    constexpr int StaleLockTime = 5000;
+
+    constexpr qsizetype alignedSize(qsizetype size)
+    {
+        return (size + 3) & ~qsizetype(3);
+    }
+}
+
+static QString glyphDiskCachePath()
+{
+    static const QString path = qEnvironmentVariable("QSG_GLYPH_DISK_CACHE_PATH");
+    return path;
+}
+
+bool QSGGlyphDiskCache::isEnabled()
+{
+    return !glyphDiskCachePath().isEmpty();
+}
+
+QSGGlyphDiskCache::QSGGlyphDiskCache(const QRawFont &font,
+                                     QByteArrayView kind,
+                                     int pixelSize,
+                                     quint32 variant)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    const auto addInt = [&hash](quint32 value) {
+        hash.addData(QByteArrayView(reinterpret_cast<const char *>(&value), sizeof(value)));
+    };
+
+    addInt(FormatVersion);
+    addInt(QT_VERSION);
+    addInt(Q_BYTE_ORDER);
+    hash.addData(kind);
+    hash.addData(font.familyName().toUtf8());
+    hash.addData(font.styleName().toUtf8());
+    addInt(quint32(font.weight()));
+    addInt(quint32(font.style()));
+    addInt(quint32(pixelSize));
+    addInt(variant);
+
+    // The head table contains the checksum of the entire font file as well as its
+    // modification date, which makes it a cheap fingerprint of the font file itself.
+    hash.addData(font.fontTable("head"));
+    hash.addData(font.fontTable("maxp"));
+
+    const QString path = glyphDiskCachePath();
+    QDir().mkpath(path);
+    m_file.setFileName(path + QLatin1Char('/')
+                       + QString::fromLatin1(hash.result().toHex())
+                       + QLatin1String(".qsgglyphs"));
+    m_lockFile = std::make_unique<QLockFile>(m_file.fileName() + QLatin1String(".lock"));
+    m_lockFile->setStaleLockTime(StaleLockTime);
+}
+
+QSGGlyphDiskCache::~QSGGlyphDiskCache()
+{
+    if (m_mapped)
+        m_file.unmap(const_cast<uchar *>(m_mapped));
+}
+
+void QSGGlyphDiskCache::load()
+{
+    m_loaded = true;
+
+    // Without the lock, another process may be appending to the file, so it
+    // is only read
+    const bool locked = m_lockFile->tryLock(LockTimeout);
+    const auto unlock = qScopeGuard([&] {
+        if (locked)
+            m_lockFile->unlock();
+    });
+    if (!locked)
+        qCDebug(lcGlyphDiskCache) << "Cannot lock" << m_file.fileName() << "reading only";
+
+    if (!m_file.open(QIODevice::ReadOnly) || m_file.size() == 0) {
+        if (locked)
+            replace({});
+        return;
+    }
+
+    const qint64 size = m_file.size();
+    m_mapped = m_file.map(0, size);
+    if (!m_mapped) {
+        qCDebug(lcGlyphDiskCache) << "Cannot map" << m_file.fileName() << m_file.errorString();
+        return;
+    }
+
+    FileHeader fileHeader = {};
+    if (size >= qint64(sizeof(fileHeader)))
+        memcpy(&fileHeader, m_mapped, sizeof(fileHeader));
+    if (fileHeader.magic != FileMagic || fileHeader.version != FormatVersion) {
+        qCDebug(lcGlyphDiskCache) << "Discarding" << m_file.fileName() << "of a different format";
+        if (locked)
+            replace({});
+        return;
+    }
+
+    const uchar *p = m_mapped + sizeof(fileHeader);
+    const uchar *end = m_mapped + size;
+    qsizetype validSize = size;
+    while (p < end) {
+        RecordHeader header = {};
+        if (end - p >= qsizetype(sizeof(header)))
+            memcpy(&header, p, sizeof(header));
+
+        // A truncated or corrupted record invalidates the rest of the file
+        if (header.magic != RecordMagic
+                || end - p - qsizetype(sizeof(header)) < qsizetype(header.size)) {
+            qCDebug(lcGlyphDiskCache) << "Ignoring corrupted tail of" << m_file.fileName();
+            validSize = p - m_mapped;
+            break;
+        }
+        p += sizeof(header);
+
+        m_entries.insert(header.glyph,
+                         QByteArrayView(reinterpret_cast<const char *>(p), header.size));
+        m_written.insert(header.glyph);
+        p += qMin(alignedSize(header.size), qsizetype(end - p));
+    }
+
+    if (locked) {
+        // Drop the tail, so that records appended later can be found again
+        if (validSize < size)
+            replace(QByteArrayView(reinterpret_cast<const char *>(m_mapped), validSize));
+        else
+            openForAppend();
+    }
+
+    qCDebug(lcGlyphDiskCache) << "Loaded" << m_entries.size() << "glyphs from" << m_file.fileName();
+}
+
+/*
+    Replaces the file with one holding \a contents, or only the header of the
+    current format if \a contents is empty. The file is renamed over the old
+    one, which stays intact for the processes that have it mapped, including
+    this one. Needs the lock.
+*/
+void QSGGlyphDiskCache::replace(QByteArrayView contents)
+{
+    const FileHeader header = { FileMagic, FormatVersion };
+    if (contents.isEmpty())
+        contents = QByteArrayView(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    QSaveFile file(m_file.fileName());
+    if (!file.open(QIODevice::WriteOnly) || file.write(contents.data(), contents.size()) != contents.size()
+            || !file.commit()) {
+        qCDebug(lcGlyphDiskCache) << "Cannot write to" << m_file.fileName() << file.errorString();
+        return;
+    }
+    openForAppend();
+}
+
+void QSGGlyphDiskCache::openForAppend()
+{
+    // Unbuffered, so that every record ends up in the file through a single write
+    m_appendFile.setFileName(m_file.fileName());
+    m_writable = m_appendFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered);
+    if (!m_writable)
+        qCDebug(lcGlyphDiskCache) << "Cannot open" << m_file.fileName() << m_appendFile.errorString();
+}
+
+QByteArrayView QSGGlyphDiskCache::find(quint32 glyph)
+{
+    if (!m_loaded)
+        load();
+    return m_entries.value(glyph);
+}
+
+void QSGGlyphDiskCache::insert(quint32 glyph, QByteArrayView data)
+{
+    if (!m_loaded)
+        load();
+    if (!m_writable || m_written.contains(glyph))
+        return;
+
+    RecordHeader header = { RecordMagic, glyph, quint32(data.size()) };
+    QByteArray record(sizeof(header) + alignedSize(data.size()), Qt::Uninitialized);
+    memcpy(record.data(), &header, sizeof(header));
+    memcpy(record.data() + sizeof(header), data.data(), data.size());
+    memset(record.data() + sizeof(header) + data.size(), 0,
+           record.size() - sizeof(header) - data.size());
+
+    if (!m_lockFile->tryLock(LockTimeout)) {
+        qCDebug(lcGlyphDiskCache) << "Cannot lock" << m_file.fileName() << "to add glyph" << glyph;
+        return;
+    }
+    const bool written = m_appendFile.write(record) == record.size();
+    m_lockFile->unlock();
+
+    if (!written) {
+        qCDebug(lcGlyphDiskCache) << "Cannot write to" << m_file.fileName() << m_appendFile.errorString();
+        m_writable = false;
+        return;
+    }
+
+    m_written.insert(glyph);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,60 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSGGLYPHDISKCACHE_P_H
+#define QSGGLYPHDISKCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlockfile.h>
+#include <QtCore/qset.h>
+#include <QtGui/qrawfont.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICK_EXPORT QSGGlyphDiskCache
+{
+public:
+    QSGGlyphDiskCache(const QRawFont &font, QByteArrayView kind, int pixelSize, quint32 variant = 0);
+    ~QSGGlyphDiskCache();
+
+    static bool isEnabled();
+
+    QByteArrayView find(quint32 glyph);
+    void insert(quint32 glyph, QByteArrayView data);
+
+    QString fileName() const { return m_file.fileName(); }
+
+private:
+    void load();
+    void replace(QByteArrayView contents);
+    void openForAppend();
+
+    QFile m_file;
+    QFile m_appendFile;
+    std::unique_ptr<QLockFile> m_lockFile;
+    const uchar *m_mapped = nullptr;
+    QHash<quint32, QByteArrayView> m_entries;
+    QSet<quint32> m_written;
+    bool m_loaded = false;
+    bool m_writable = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSGGLYPHDISKCACHE_P_H
@@ -51,22 +51,31 @@ Manager::Manager(QSGDefaultRenderContext *rc, const QSize &surfacePixelSize, QSu
     m_atlas_size_limit = qt_sg_envInt("QSG_ATLAS_SIZE_LIMIT", qMax(w, h) / 2);
     m_atlas_size = QSize(w, h);
 
-    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d", w, h);
+    // Additional pages are only created once the previous ones are full, and
+    // are released again when all their textures are gone.
+    m_atlas_page_limit = qMax(1, qt_sg_envInt("QSG_ATLAS_MAX_PAGES", 2));
+
+    // A full page that is occupied below this percentage is considered
+    // fragmented, and is retired in favor of a fresh page when possible.
+    m_atlas_retire_threshold = qBound(0, qt_sg_envInt("QSG_ATLAS_RETIRE_THRESHOLD", 50), 100) / 100.0;
+
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d, max pages: %d",
+            w, h, m_atlas_page_limit);
 }
 
 Manager::~Manager()
 {
-    Q_ASSERT(m_atlas == nullptr);
+    Q_ASSERT(m_pages.isEmpty());
     Q_ASSERT(m_atlases.isEmpty());
 }
 
 void Manager::invalidate()
 {
-    if (m_atlas) {
-        m_atlas->invalidate();
-        m_atlas->deleteLater();
-        m_atlas = nullptr;
+    for (Atlas *atlas : std::as_const(m_pages)) {
+        atlas->invalidate();
+        atlas->deleteLater();
     }
+    m_pages.clear();
 
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*>::iterator i = m_atlases.begin();
     while (i != m_atlases.end()) {
@@ -81,15 +90,79 @@ QSGTexture *Manager::create(const QImage &image, bool hasAlphaChannel)
 {
     Texture *t = nullptr;
     if (image.width() < m_atlas_size_limit && image.height() < m_atlas_size_limit) {
-        if (!m_atlas)
-            m_atlas = new Atlas(m_rc, m_atlas_size);
-        t = m_atlas->create(image);
+        releaseEmptyPages();
+
+        if (m_pages.isEmpty())
+            createPage();
+
+        for (Atlas *atlas : std::as_const(m_pages)) {
+            if (atlas->isRetired())
+                continue;
+            t = atlas->create(image);
+            if (t)
+                break;
+        }
+
+        if (!t && m_pages.size() < m_atlas_page_limit) {
+            // Pages which are mostly empty but still cannot fit the image are
+            // full of holes. Stop allocating from them so that they drain and
+            // get released, instead of keeping them fragmented forever.
+            for (Atlas *atlas : std::as_const(m_pages)) {
+                if (atlas->occupancy() < m_atlas_retire_threshold) {
+                    qCDebug(QSG_LOG_INFO, "rhi texture atlas %p retired at %.1f%% occupancy",
+                            atlas, atlas->occupancy() * 100);
+                    atlas->setRetired(true);
+                }
+            }
+            t = createPage()->create(image);
+        }
+
         if (t && !hasAlphaChannel && t->hasAlphaChannel())
             t->setHasAlphaChannel(false);
     }
     return t;
 }
 
+Atlas *Manager::createPage()
+{
+    Atlas *atlas = new Atlas(m_rc, m_atlas_size);
+    m_pages.append(atlas);
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas page %d created", int(m_pages.size()));
+    return atlas;
+}
+
+void Manager::releaseEmptyPages()
+{
+    for (auto it = m_pages.begin(); it != m_pages.end(); ) {
+        Atlas *atlas = *it;
+        // The first page is kept around, unless it was retired, since it is
+        // very likely to be needed again.
+        const bool keep = it == m_pages.begin() && !atlas->isRetired();
+        if (!keep && atlas->textureCount() == 0) {
+            qCDebug(QSG_LOG_INFO, "rhi texture atlas %p released", atlas);
+            atlas->releaseTexture();
+            atlas->deleteLater();
+            it = m_pages.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+Manager::Statistics Manager::statistics() const
+{
+    Statistics stats;
+    for (const Atlas *atlas : m_pages) {
+        ++stats.pageCount;
+        if (atlas->isRetired())
+            ++stats.retiredPageCount;
+        stats.textureCount += atlas->textureCount();
+        stats.allocatedArea += atlas->allocatedArea();
+        stats.totalArea += qint64(atlas->size().width()) * atlas->size().height();
+    }
+    return stats;
+}
+
 QSGTexture *Manager::create(const QSGCompressedTextureFactory *factory)
 {
     QSGTexture *t = nullptr;
@@ -134,6 +207,16 @@ void AtlasBase::invalidate()
     m_texture = nullptr;
 }
 
+void AtlasBase::releaseTexture()
+{
+    // Unlike invalidate(), this may happen while a frame is being recorded
+    if (m_texture) {
+        m_texture->deleteLater();
+        m_texture = nullptr;
+    }
+    m_allocated = false;
+}
+
 void AtlasBase::commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates)
 {
     if (!m_allocated) {
@@ -150,10 +233,23 @@ void AtlasBase::commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates
     m_pending_uploads.clear();
 }
 
+QRect AtlasBase::allocate(const QSize &size)
+{
+    QRect rect = m_allocator.allocate(size);
+    if (rect.width() > 0 && rect.height() > 0) {
+        m_allocated_area += qint64(rect.width()) * rect.height();
+        ++m_texture_count;
+    }
+    return rect;
+}
+
 void AtlasBase::remove(TextureBase *t)
 {
     QRect atlasRect = t->atlasSubRect();
-    m_allocator.deallocate(atlasRect);
+    if (m_allocator.deallocate(atlasRect)) {
+        m_allocated_area -= qint64(atlasRect.width()) * atlasRect.height();
+        --m_texture_count;
+    }
     m_pending_uploads.removeOne(t);
 }
 
@@ -189,7 +285,7 @@ Atlas::~Atlas()
 Texture *Atlas::create(const QImage &image)
 {
     // No need to lock, as manager already locked it.
-    QRect rect = m_allocator.allocate(QSize(image.width() + 2, image.height() + 2));
+    QRect rect = allocate(QSize(image.width() + 2, image.height() + 2));
     if (rect.width() > 0 && rect.height() > 0) {
         Texture *t = new Texture(this, rect, image);
         m_pending_uploads << t;
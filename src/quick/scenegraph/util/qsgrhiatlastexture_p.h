@@ -49,15 +49,32 @@ public:
     QSGTexture *create(const QSGCompressedTextureFactory *factory);
     void invalidate();
 
+    struct Statistics {
+        int pageCount = 0;
+        int retiredPageCount = 0;
+        int textureCount = 0;
+        qint64 allocatedArea = 0;
+        qint64 totalArea = 0;
+
+        qreal occupancy() const { return totalArea > 0 ? qreal(allocatedArea) / totalArea : 0; }
+    };
+    Statistics statistics() const;
+
 private:
+    Atlas *createPage();
+    void releaseEmptyPages();
+
     QSGDefaultRenderContext *m_rc;
     QRhi *m_rhi;
-    Atlas *m_atlas = nullptr;
+    // pages of the RGBA atlas, the first one is never released
+    QList<Atlas *> m_pages;
     // set of atlases for different compressed formats
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*> m_atlases;
 
     QSize m_atlas_size;
     int m_atlas_size_limit;
+    int m_atlas_page_limit;
+    qreal m_atlas_retire_threshold;
 };
 
 class AtlasBase : public QObject
@@ -68,6 +85,7 @@ public:
     ~AtlasBase();
 
     void invalidate();
+    void releaseTexture();
     void commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates);
     void remove(TextureBase *t);
 
@@ -76,10 +94,21 @@ public:
     QRhiTexture *texture() const { return m_texture; }
     QSize size() const { return m_size; }
 
+    int textureCount() const { return m_texture_count; }
+    qint64 allocatedArea() const { return m_allocated_area; }
+    qreal occupancy() const { return qreal(m_allocated_area) / (qint64(m_size.width()) * m_size.height()); }
+
+    // A retired atlas takes no new allocations and is released once its
+    // last texture is gone, which is how fragmented pages get reclaimed.
+    bool isRetired() const { return m_retired; }
+    void setRetired(bool retired) { m_retired = retired; }
+
 protected:
     virtual bool generateTexture() = 0;
     virtual void enqueueTextureUpload(TextureBase *t, QRhiResourceUpdateBatch *resourceUpdates) = 0;
 
+    QRect allocate(const QSize &size);
+
 protected:
     QSGDefaultRenderContext *m_rc;
     QRhi *m_rhi;
@@ -91,7 +120,10 @@ protected:
     friend class TextureBasePrivate;
 
 private:
+    qint64 m_allocated_area = 0;
+    int m_texture_count = 0;
     bool m_allocated = false;
+    bool m_retired = false;
 };
 
 class Atlas : public AtlasBase
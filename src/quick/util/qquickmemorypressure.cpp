@@ -0,0 +1,115 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickmemorypressure_p.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsocketnotifier.h>
+
+#if defined(Q_OS_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(lcMemoryPressure, "qt.quick.memorypressure")
+
+#if defined(Q_OS_LINUX)
+/*
+    Returns the memory.pressure file of the cgroup (v2) that this process
+    belongs to, if there is one.
+*/
+static QString cgroupPressureFile()
+{
+    QFile cgroup(QStringLiteral("/proc/self/cgroup"));
+    if (!cgroup.open(QIODevice::ReadOnly | QIODevice::Text))
+        return QString();
+    while (!cgroup.atEnd()) {
+        const QByteArray line = cgroup.readLine().trimmed();
+        if (line.startsWith("0::")) {
+            const QString path = QStringLiteral("/sys/fs/cgroup") + QString::fromLocal8Bit(line.mid(3))
+                    + QStringLiteral("/memory.pressure");
+            return QFile::exists(path) ? path : QString();
+        }
+    }
+    return QString();
+}
+
+// Tasks stalled on memory for 10% of a 2 second window; unprivileged
+// processes may only use windows that are a multiple of 2 seconds
+static const char moderateTrigger[] = "some 200000 2000000";
+static const char criticalTrigger[] = "full 200000 2000000";
+#endif
+
+QQuickMemoryPressureMonitor::QQuickMemoryPressureMonitor(QObject *parent)
+    : QObject(parent)
+{
+#if defined(Q_OS_LINUX)
+    // Prefer the cgroup, as its limit is the one the process runs into first
+    QStringList paths;
+    const QString cgroupFile = cgroupPressureFile();
+    if (!cgroupFile.isEmpty())
+        paths << cgroupFile;
+    paths << QStringLiteral("/proc/pressure/memory");
+
+    for (const QString &path : std::as_const(paths)) {
+        if (addTrigger(path, moderateTrigger, ModeratePressure)
+                && addTrigger(path, criticalTrigger, CriticalPressure)) {
+            qCDebug(lcMemoryPressure) << "watching" << path;
+            return;
+        }
+        // Do not mix the triggers of different files
+        for (const Trigger &trigger : std::as_const(m_triggers)) {
+            delete trigger.notifier;
+            ::close(trigger.fd);
+        }
+        m_triggers.clear();
+    }
+    qCDebug(lcMemoryPressure) << "pressure stall information is not available";
+#endif
+}
+
+QQuickMemoryPressureMonitor::~QQuickMemoryPressureMonitor()
+{
+#if defined(Q_OS_LINUX)
+    for (const Trigger &trigger : std::as_const(m_triggers)) {
+        delete trigger.notifier;
+        ::close(trigger.fd);
+    }
+#endif
+}
+
+bool QQuickMemoryPressureMonitor::addTrigger(const QString &path, const char *trigger, Level level)
+{
+#if defined(Q_OS_LINUX)
+    const int fd = ::open(QFile::encodeName(path).constData(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+    // The kernel expects the trigger with its terminating null
+    if (::write(fd, trigger, qstrlen(trigger) + 1) < 0) {
+        qCDebug(lcMemoryPressure) << "cannot add trigger" << trigger << "to" << path;
+        ::close(fd);
+        return false;
+    }
+
+    // The kernel signals a trigger with POLLPRI
+    auto *notifier = new QSocketNotifier(fd, QSocketNotifier::Exception, this);
+    connect(notifier, &QSocketNotifier::activated, this, [this, level] {
+        qCDebug(lcMemoryPressure) << "memory pressure" << level;
+        emit pressure(level);
+    });
+    m_triggers.append({ fd, notifier });
+    return true;
+#else
+    Q_UNUSED(path);
+    Q_UNUSED(trigger);
+    Q_UNUSED(level);
+    return false;
+#endif
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qquickmemorypressure_p.cpp"
@@ -0,0 +1,69 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKMEMORYPRESSURE_P_H
+#define QQUICKMEMORYPRESSURE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSocketNotifier;
+
+/*! \internal
+    Watches the memory pressure of the system, or of the cgroup that the
+    process runs in, and emits pressure() when tasks stall on memory.
+
+    On Linux, this registers pressure stall information (PSI) triggers on
+    the cgroup's memory.pressure file, or on /proc/pressure/memory: a
+    moderate one when some tasks stall, and a critical one when all of
+    them do. Elsewhere, and if the kernel does not support it, isActive()
+    returns \c false and the signal is never emitted.
+*/
+class Q_QUICK_AUTOTEST_EXPORT QQuickMemoryPressureMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Level {
+        NoPressure,
+        ModeratePressure,
+        CriticalPressure
+    };
+    Q_ENUM(Level)
+
+    explicit QQuickMemoryPressureMonitor(QObject *parent = nullptr);
+    ~QQuickMemoryPressureMonitor() override;
+
+    bool isActive() const { return !m_triggers.isEmpty(); }
+
+Q_SIGNALS:
+    void pressure(QQuickMemoryPressureMonitor::Level level);
+
+private:
+    struct Trigger {
+        int fd;
+        QSocketNotifier *notifier;
+    };
+    bool addTrigger(const QString &path, const char *trigger, Level level);
+
+    QList<Trigger> m_triggers;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKMEMORYPRESSURE_P_H
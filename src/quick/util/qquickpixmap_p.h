@@ -112,6 +112,12 @@ public:
     };
     Q_DECLARE_FLAGS(Options, Option)
 
+    enum Priority {
+        VisiblePriority,
+        PrefetchPriority,
+        BackgroundPriority
+    };
+
     QQuickPixmap();
     QQuickPixmap(QQmlEngine *, const QUrl &);
     QQuickPixmap(QQmlEngine *, const QUrl &, Options options);
@@ -155,6 +161,8 @@ public:
                              const QRect &requestRegion, const QSize &requestSize,
                              const QQuickImageProviderOptions &providerOptions, int frame = 0, int frameCount = 1);
 
+    void setPriority(Priority priority);
+
     void clear();
     void clear(QObject *);
 
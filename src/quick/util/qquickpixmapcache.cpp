@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <QtQuick/private/qquickpixmapcache_p.h>
+#include <QtQuick/private/qquickpixmapdiskcache_p.h>
 #include <QtQuick/private/qquickimageprovider_p.h>
 #include <QtQuick/private/qquickprofiler_p.h>
+#include <QtQuick/private/qsgcompressedtexture_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
 #include <QtQuick/private/qsgrenderer_p.h>
 #include <QtQuick/private/qsgtexturereader_p.h>
@@ -24,11 +26,14 @@
 #include <QtCore/qhash.h>
 #include <QtCore/qfile.h>
 #include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qbuffer.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qmetaobject.h>
 #include <QtCore/qscopeguard.h>
+#include <QtCore/qset.h>
 
 #if QT_CONFIG(qml_network)
 #include <QtQml/qqmlnetworkaccessmanagerfactory.h>
@@ -99,10 +104,14 @@ const QLatin1String QQuickPixmap::itemGrabberScheme = QLatin1String("itemgrabber
 Q_STATIC_LOGGING_CATEGORY(lcImg, "qt.quick.image")
 
 /*! \internal
-    The maximum currently-unused image data that can be stored for potential
-    later reuse, in bytes. See QQuickPixmapCache::shrinkCache()
+    The default for the maximum currently-unused image data that can be stored
+    for potential later reuse, in bytes. See QQuickPixmapCache::shrinkCache()
 */
-static int cache_limit = 2048 * 1024;
+static const qsizetype defaultUnreferencedBudget = 2048 * 1024;
+
+// How long the cache keeps nothing unreferenced after the system reported
+// memory pressure, in milliseconds
+#define MEMORY_PRESSURE_COOLDOWN 10000
 
 static inline QString imageProviderId(const QUrl &url)
 {
@@ -155,6 +164,10 @@ public:
     bool loading;
     QQuickImageProviderOptions providerOptions;
 
+    // always access inside the reader's mutex
+    QQuickPixmap::Priority priority = QQuickPixmap::VisiblePriority;
+    QElapsedTimer queuedTimer;
+
     class Event : public QEvent {
         Q_EVENT_DISABLE_COPY(Event);
     public:
@@ -224,6 +237,7 @@ public:
 
     QQuickPixmapReply *getImage(QQuickPixmapData *);
     void cancel(QQuickPixmapReply *rep);
+    void setPriority(QQuickPixmapReply *rep, QQuickPixmap::Priority priority);
 
     static QQuickPixmapReader *instance(QQmlEngine *engine);
     static QQuickPixmapReader *existingInstance(QQmlEngine *engine);
@@ -237,6 +251,9 @@ private:
     friend class ReaderThreadExecutionEnforcer;
     void processJobs();
     void processJob(QQuickPixmapReply *, const QUrl &, const QString &, QQuickImageProvider::ImageType, const QSharedPointer<QQuickImageProvider> &);
+    void processLocalFileJob(QQuickPixmapReply *, const QUrl &, const QString &);
+    bool isCancelled(QQuickPixmapReply *);
+    void recordJobTimes(const QUrl &url, QQuickPixmap::Priority priority, qint64 queueWait, qint64 decodeTime);
 #if QT_CONFIG(qml_network)
     void networkRequestDone(QNetworkReply *);
 #endif
@@ -246,6 +263,33 @@ private:
     QList<QQuickPixmapReply *> cancelledJobs;
     QQmlEngine *engine;
 
+    /*! \internal
+        Time that the jobs spent waiting in the queue, and decoding local files.
+        Always access inside the mutex.
+    */
+    struct JobTimes {
+        quint64 jobCount = 0;
+        qint64 queueWait = 0;
+        qint64 maxQueueWait = 0;
+        quint64 decodeCount = 0;
+        qint64 decodeTime = 0;
+    } jobTimes;
+
+#if QT_CONFIG(quick_pixmap_cache_threaded_download)
+    /*! \internal
+        Local files are decoded by a pool of threads, so that one large image
+        does not hold up the ones queued after it. Each task started on the
+        pool decodes the most important job in decodeJobs at the time it runs,
+        so that the priority of a job can change until its decoding starts.
+    */
+    void decodeNextJob();
+    static int decodeThreadCount();
+
+    QThreadPool decodePool;
+    QList<QQuickPixmapReply *> decodeJobs;
+    QSet<QQuickPixmapReply *> decodingJobs;
+#endif
+
 #if QT_CONFIG(quick_pixmap_cache_threaded_download)
     /*! \internal
         Returns a pointer to the thread object owned by the run loop in QQuickPixmapReader::run.
@@ -389,6 +433,9 @@ public:
 
     QQuickPixmapReply *reply;
 
+    // The texture bytes that were accounted when this was unreferenced
+    qsizetype unreferencedTextureCost = 0;
+
     // prev/next pointers to form a linked list for dereferencing pixmaps that are currently unused
     // (those get lazily deleted in QQuickPixmapCache::shrinkCache())
     QQuickPixmapData *prevUnreferenced;
@@ -484,6 +531,28 @@ static bool readImage(const QUrl& url, QIODevice *dev, QImage *image, QString *e
                       QQuickImageProviderOptions::AutoTransform *appliedTransform = nullptr, int frame = 0,
                       qreal devicePixelRatio = 1.0)
 {
+    // Local files may have been decoded before, by this or an earlier process
+    QQuickPixmapDiskCache *diskCache = QQuickPixmapDiskCache::instance();
+    QString diskCacheKey;
+    if (diskCache) {
+        if (QFile *file = qobject_cast<QFile *>(dev)) {
+            diskCacheKey = QQuickPixmapDiskCache::key(file->fileName(), requestRegion, requestSize,
+                                                      providerOptions, frame, devicePixelRatio);
+        }
+        QQuickPixmapDiskCache::Entry entry;
+        if (!diskCacheKey.isEmpty() && diskCache->load(diskCacheKey, &entry)) {
+            *image = entry.image;
+            if (impsize)
+                *impsize = entry.implicitSize;
+            if (frameCount)
+                *frameCount = entry.frameCount;
+            if (appliedTransform && providerOptions.autoTransform() == QQuickImageProviderOptions::UsePluginDefaultTransform)
+                *appliedTransform = entry.appliedTransform;
+            qCDebug(lcImg) << url << "frame" << frame << "loaded from the disk cache" << image->size();
+            return true;
+        }
+    }
+
     QImageReader imgio(dev);
     if (providerOptions.autoTransform() != QQuickImageProviderOptions::UsePluginDefaultTransform)
         imgio.setAutoTransform(providerOptions.autoTransform() == QQuickImageProviderOptions::ApplyTransform);
@@ -518,6 +587,15 @@ static bool readImage(const QUrl& url, QIODevice *dev, QImage *image, QString *e
             else
                 image->setColorSpace(providerOptions.targetColorSpace());
         }
+        if (!diskCacheKey.isEmpty()) {
+            QQuickPixmapDiskCache::Entry entry;
+            entry.image = *image;
+            entry.implicitSize = originalSize.width() < 0 ? image->size() : originalSize;
+            entry.frameCount = imgio.imageCount();
+            entry.appliedTransform = imgio.autoTransform() ? QQuickImageProviderOptions::ApplyTransform
+                                                           : QQuickImageProviderOptions::DoNotApplyTransform;
+            diskCache->storeLater(diskCacheKey, entry);
+        }
         return true;
     } else {
         if (errorString)
@@ -573,6 +651,42 @@ static QString existingImageFileForPath(const QString &localFile)
     return localFile;
 }
 
+/*
+    Returns the factory for the compressed texture variants that were
+    generated for \a fileName at build time, if they can be used for this
+    request. Anything that needs the decoded image, like clipping, scaling
+    or converting it, falls back to decoding the original. As long as no
+    window knows which variants it supports, the original is decoded as
+    well, and set as the factory's fallback.
+*/
+static QSGCompressedTextureVariantFactory *compressedVariantFactory(const QString &fileName, const QRect &requestRegion,
+                                                      const QSize &requestSize,
+                                                      const QQuickImageProviderOptions &options, int frame)
+{
+    static const bool disabled = qEnvironmentVariableIntValue("QML_DISABLE_COMPRESSED_TEXTURE_VARIANTS");
+    if (disabled || !backendSupport()->hasOpenGL)
+        return nullptr;
+    // The variants are uploaded as they are, without the clipping, the color
+    // space conversion or the orientation transform that decoding applies
+    if (!requestRegion.isNull() || frame != 0 || options.targetColorSpace().isValid()
+            || options.autoTransform() == QQuickImageProviderOptions::ApplyTransform) {
+        return nullptr;
+    }
+
+    QSGCompressedTextureVariantFactory *factory = QSGCompressedTextureVariantFactory::create(fileName);
+    if (!factory)
+        return nullptr;
+
+    const QSize textureSize = factory->textureSize();
+    if ((requestSize.width() > 0 && requestSize.width() != textureSize.width())
+            || (requestSize.height() > 0 && requestSize.height() != textureSize.height())) {
+        qCDebug(lcImg) << "not using compressed variants of" << fileName << "for sourceSize" << requestSize;
+        delete factory;
+        return nullptr;
+    }
+    return factory;
+}
+
 QQuickPixmapReader::QQuickPixmapReader(QQmlEngine *eng)
 : QThread(eng), engine(eng)
 #if QT_CONFIG(qml_network)
@@ -584,6 +698,9 @@ QQuickPixmapReader::QQuickPixmapReader(QQmlEngine *eng)
     eventLoopQuitHack = new QObject;
     eventLoopQuitHack->moveToThread(this);
     QObject::connect(eventLoopQuitHack, &QObject::destroyed, this, &QThread::quit, Qt::DirectConnection);
+    decodePool.setObjectName(QStringLiteral("QQuickPixmapReader decoder"));
+    decodePool.setMaxThreadCount(decodeThreadCount());
+    decodePool.setThreadPriority(QThread::LowestPriority);
     start(QThread::LowestPriority);
 #else
     run(); // Call nonblocking run for ourselves.
@@ -619,6 +736,18 @@ QQuickPixmapReader::~QQuickPixmapReader()
 #endif
         for (auto *reply : std::as_const(asyncResponses))
             cancelJob(reply);
+#if QT_CONFIG(quick_pixmap_cache_threaded_download)
+        // Jobs that wait for a decoder are cleaned up by processJobs(), and
+        // the ones being decoded once their decoder is done with them.
+        for (auto *reply : std::as_const(decodeJobs)) {
+            if (!cancelledJobs.contains(reply))
+                cancelJob(reply);
+        }
+        for (auto *reply : std::as_const(decodingJobs)) {
+            if (!cancelledJobs.contains(reply))
+                cancelJob(reply);
+        }
+#endif
 #if !QT_CONFIG(quick_pixmap_cache_threaded_download)
     // In this case we won't be waiting, but we are on the correct thread already, so we can
     // perform housekeeping synchronously now.
@@ -631,6 +760,8 @@ QQuickPixmapReader::~QQuickPixmapReader()
     }
 
 #if QT_CONFIG(quick_pixmap_cache_threaded_download)
+    // ... let the decoders finish the images they have started on ...
+    decodePool.waitForDone();
     // ... schedule stopping of this thread via the eventLoopQuitHack (processJobs scheduled above
     // will run first) ...
     eventLoopQuitHack->deleteLater();
@@ -792,8 +923,17 @@ void QQuickPixmapReader::processJobs()
 
         // Clean cancelled jobs
         if (!cancelledJobs.isEmpty()) {
+            QList<QQuickPixmapReply *> stillDecoding;
             for (int i = 0; i < cancelledJobs.size(); ++i) {
                 QQuickPixmapReply *job = cancelledJobs.at(i);
+#if QT_CONFIG(quick_pixmap_cache_threaded_download)
+                // A decoder is still using it; it will ask for another cleanup when done
+                if (decodingJobs.contains(job)) {
+                    stillDecoding.append(job);
+                    continue;
+                }
+                decodeJobs.removeOne(job);
+#endif
 #if QT_CONFIG(qml_network)
                 QNetworkReply *reply = networkJobs.key(job, 0);
                 if (reply) {
@@ -815,14 +955,22 @@ void QQuickPixmapReader::processJobs()
                 // deleteLater, since not owned by this thread
                 job->deleteLater();
             }
-            cancelledJobs.clear();
+            cancelledJobs = std::move(stillDecoding);
         }
 
-        if (!jobs.isEmpty()) {
-            // Find a job we can use
-            bool usableJob = false;
+        if (jobs.isEmpty())
+            return;
+
+        // Find a job we can use: the most recently requested one that has
+        // the highest priority, and does not exceed the network request limit
+        bool usableJob = false;
+        for (int priority = QQuickPixmap::VisiblePriority;
+             !usableJob && priority <= QQuickPixmap::BackgroundPriority; ++priority) {
             for (int i = jobs.size() - 1; !usableJob && i >= 0; i--) {
                 QQuickPixmapReply *job = jobs.at(i);
+                if (job->priority != priority)
+                    continue;
+
                 const QUrl url = job->url;
                 QString localFile;
                 QQuickImageProvider::ImageType imageType = QQuickImageProvider::Invalid;
@@ -851,20 +999,124 @@ void QQuickPixmapReader::processJobs()
 
                     PIXMAP_PROFILE(pixmapStateChanged<QQuickProfiler::PixmapLoadingStarted>(url));
 
+#if QT_CONFIG(quick_pixmap_cache_threaded_download)
+                    // Hand local files over to the decoders, unless they come from
+                    // a device that needs this thread's event loop
+                    if (decodePool.maxThreadCount() > 0 && !localFile.isEmpty()
+                            && url.scheme() != QLatin1String("image")
+                            && !(job->data && job->data->fromSpecialDevice)) {
+                        decodeJobs.append(job);
+                        decodePool.start([this] { decodeNextJob(); });
+                        continue;
+                    }
+#endif
+
+                    const QQuickPixmap::Priority jobPriority = job->priority;
+                    const qint64 queueWait = job->queuedTimer.nsecsElapsed();
 #if QT_CONFIG(quick_pixmap_cache_threaded_download)
                     locker.unlock();
                     auto relockMutexGuard = qScopeGuard(([&locker]() {
                         locker.relock();
                     }));
 #endif
+                    QElapsedTimer decodeTimer;
+                    decodeTimer.start();
                     processJob(job, url, localFile, imageType, provider);
+                    // job may be gone by now
+                    recordJobTimes(url, jobPriority, queueWait,
+                                   localFile.isEmpty() ? -1 : decodeTimer.nsecsElapsed());
                 }
             }
+        }
 
-            if (!usableJob)
-                return;
+        if (!usableJob)
+            return;
+    }
+}
+
+#if QT_CONFIG(quick_pixmap_cache_threaded_download)
+/*! \internal
+    Returns the number of threads that decode local files: the value of
+    QML_PIXMAP_READER_THREADS if set, otherwise half of the cores, up to 4.
+    With 0, the reader thread decodes them itself, one at a time.
+*/
+int QQuickPixmapReader::decodeThreadCount()
+{
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("QML_PIXMAP_READER_THREADS", &ok);
+    if (ok)
+        return qMax(0, count);
+    return qBound(1, QThread::idealThreadCount() / 2, 4);
+}
+
+/*! \internal
+    Runs on a thread of the decode pool.
+*/
+void QQuickPixmapReader::decodeNextJob()
+{
+    QQuickPixmapReply *job = nullptr;
+    QUrl url;
+    QQuickPixmap::Priority priority;
+    qint64 queueWait = 0;
+    {
+        PIXMAP_READER_LOCK();
+        for (int i = decodeJobs.size() - 1; i >= 0; --i) {
+            QQuickPixmapReply *candidate = decodeJobs.at(i);
+            if (!job || candidate->priority < job->priority)
+                job = candidate;
         }
+        if (!job)
+            return; // cancelled and cleaned up before we got to it
+        decodeJobs.removeOne(job);
+        decodingJobs.insert(job);
+        url = job->url;
+        priority = job->priority;
+        queueWait = job->queuedTimer.nsecsElapsed();
+    }
+
+    QElapsedTimer decodeTimer;
+    decodeTimer.start();
+    processLocalFileJob(job, url, QQmlFile::urlToLocalFileOrQrc(url));
+    recordJobTimes(url, priority, queueWait, decodeTimer.nsecsElapsed());
+
+    PIXMAP_READER_LOCK();
+    decodingJobs.remove(job);
+    if (cancelledJobs.contains(job) && readerThreadExecutionEnforcer())
+        readerThreadExecutionEnforcer()->processJobsOnReaderThreadLater();
+}
+#endif
+
+bool QQuickPixmapReader::isCancelled(QQuickPixmapReply *job)
+{
+    PIXMAP_READER_LOCK();
+    return cancelledJobs.contains(job);
+}
+
+/*! \internal
+    Records how long the job for \a url waited before it was processed, and
+    how long it took to decode, in nanoseconds. A negative \a decodeTime means
+    that the job did not decode anything itself, like a network request.
+*/
+void QQuickPixmapReader::recordJobTimes(const QUrl &url, QQuickPixmap::Priority priority,
+                                        qint64 queueWait, qint64 decodeTime)
+{
+    PIXMAP_READER_LOCK();
+    ++jobTimes.jobCount;
+    jobTimes.queueWait += queueWait;
+    jobTimes.maxQueueWait = qMax(jobTimes.maxQueueWait, queueWait);
+    if (decodeTime >= 0) {
+        ++jobTimes.decodeCount;
+        jobTimes.decodeTime += decodeTime;
+        qCDebug(lcImg) << url << "with priority" << priority << "waited" << queueWait / 1000000
+                       << "ms and decoded in" << decodeTime / 1000000 << "ms";
+    } else {
+        qCDebug(lcImg) << url << "with priority" << priority << "waited" << queueWait / 1000000 << "ms";
     }
+    qCDebug(lcImg) << "average wait" << jobTimes.queueWait / jobTimes.jobCount / 1000000
+                   << "ms, longest" << jobTimes.maxQueueWait / 1000000 << "ms over" << jobTimes.jobCount
+                   << "jobs; average decode"
+                   << (jobTimes.decodeCount ? jobTimes.decodeTime / jobTimes.decodeCount / 1000000 : 0)
+                   << "ms over" << jobTimes.decodeCount << "images";
 }
 
 void QQuickPixmapReader::processJob(QQuickPixmapReply *runningJob, const QUrl &url, const QString &localFile,
@@ -1001,74 +1253,7 @@ void QQuickPixmapReader::processJob(QQuickPixmapReply *runningJob, const QUrl &u
     } else {
         if (!localFile.isEmpty()) {
             // Image is local - load/decode immediately
-            QImage image;
-            QQuickPixmapReply::ReadError errorCode = QQuickPixmapReply::NoError;
-            QString errorStr;
-            QSize readSize;
-
-            if (runningJob->data && runningJob->data->fromSpecialDevice) {
-                auto specialDevice = runningJob->data->specialDevice;
-                if (specialDevice.isNull() || QObjectPrivate::get(specialDevice.data())->deleteLaterCalled) {
-                    qCDebug(lcImg) << "readImage job aborted" << url;
-                    return;
-                }
-                int frameCount;
-                // Ensure that specialDevice's thread affinity is _this_ thread, to avoid deleteLater()
-                // deleting prematurely, before readImage() is done. But this is only possible if it has already
-                // relinquished its initial thread affinity.
-                if (!specialDevice->thread()) {
-                    qCDebug(lcQsgLeak) << specialDevice.data() << ": changing thread affinity so that"
-                                       << QThread::currentThread() << "will handle any deleteLater() calls";
-                    specialDevice->moveToThread(QThread::currentThread());
-                }
-                if (!readImage(url, specialDevice.data(), &image, &errorStr, &readSize, &frameCount,
-                               runningJob->requestRegion, runningJob->requestSize,
-                               runningJob->providerOptions, nullptr, runningJob->data->frame)) {
-                    errorCode = QQuickPixmapReply::Loading;
-                } else if (runningJob->data) {
-                    runningJob->data->frameCount = frameCount;
-                }
-            } else {
-                QFile f(existingImageFileForPath(localFile));
-                if (f.open(QIODevice::ReadOnly)) {
-                    QSGTextureReader texReader(&f, localFile);
-                    if (backendSupport()->hasOpenGL && texReader.isTexture()) {
-                        QQuickTextureFactory *factory = texReader.read();
-                        if (factory) {
-                            readSize = factory->textureSize();
-                        } else {
-                            errorStr = QQuickPixmap::tr("Error decoding: %1").arg(url.toString());
-                            if (f.fileName() != localFile)
-                                errorStr += QString::fromLatin1(" (%1)").arg(f.fileName());
-                            errorCode = QQuickPixmapReply::Decoding;
-                        }
-                        PIXMAP_READER_LOCK();
-                        if (!cancelledJobs.contains(runningJob))
-                            runningJob->postReply(errorCode, errorStr, readSize, factory);
-                        return;
-                    } else {
-                        int frameCount;
-                        int const frame = runningJob->data ? runningJob->data->frame : 0;
-                        if (!readImage(url, &f, &image, &errorStr, &readSize, &frameCount,
-                                       runningJob->requestRegion, runningJob->requestSize,
-                                       runningJob->providerOptions, nullptr, frame)) {
-                            errorCode = QQuickPixmapReply::Loading;
-                            if (f.fileName() != localFile)
-                                errorStr += QString::fromLatin1(" (%1)").arg(f.fileName());
-                        } else if (runningJob->data) {
-                            runningJob->data->frameCount = frameCount;
-                        }
-                    }
-                } else {
-                    errorStr = QQuickPixmap::tr("Cannot open: %1").arg(url.toString());
-                    errorCode = QQuickPixmapReply::Loading;
-                }
-            }
-            PIXMAP_READER_LOCK();
-            if (!cancelledJobs.contains(runningJob)) {
-                runningJob->postReply(errorCode, errorStr, readSize,
-                                      QQuickTextureFactory::textureFactoryForImage(image));
-            }
+            processLocalFileJob(runningJob, url, localFile);
         } else {
 #if QT_CONFIG(qml_network)
             // Network resource
@@ -1089,6 +1274,111 @@ void QQuickPixmapReader::processJob(QQuickPixmapReply *runningJob, const QUrl &u
     }
 }
 
+/*! \internal
+    Decodes the local file for \a runningJob. This runs either on the reader
+    thread or on one of the decoders.
+*/
+void QQuickPixmapReader::processLocalFileJob(QQuickPixmapReply *runningJob, const QUrl &url, const QString &localFile)
+{
+    // The job may have been cancelled while it was waiting for a decoder
+    if (isCancelled(runningJob))
+        return;
+
+    QImage image;
+    QQuickPixmapReply::ReadError errorCode = QQuickPixmapReply::NoError;
+    QString errorStr;
+    QSize readSize;
+    std::unique_ptr<QSGCompressedTextureVariantFactory> variantFactory;
+
+    if (runningJob->data && runningJob->data->fromSpecialDevice) {
+        auto specialDevice = runningJob->data->specialDevice;
+        if (specialDevice.isNull() || QObjectPrivate::get(specialDevice.data())->deleteLaterCalled) {
+            qCDebug(lcImg) << "readImage job aborted" << url;
+            return;
+        }
+        int frameCount;
+        // Ensure that specialDevice's thread affinity is _this_ thread, to avoid deleteLater()
+        // deleting prematurely, before readImage() is done. But this is only possible if it has already
+        // relinquished its initial thread affinity.
+        if (!specialDevice->thread()) {
+            qCDebug(lcQsgLeak) << specialDevice.data() << ": changing thread affinity so that"
+                               << QThread::currentThread() << "will handle any deleteLater() calls";
+            specialDevice->moveToThread(QThread::currentThread());
+        }
+        if (!readImage(url, specialDevice.data(), &image, &errorStr, &readSize, &frameCount,
+                       runningJob->requestRegion, runningJob->requestSize,
+                       runningJob->providerOptions, nullptr, runningJob->data->frame)) {
+            errorCode = QQuickPixmapReply::Loading;
+        } else if (runningJob->data) {
+            runningJob->data->frameCount = frameCount;
+        }
+    } else {
+        const QString imageFile = existingImageFileForPath(localFile);
+        int const variantFrame = runningJob->data ? runningJob->data->frame : 0;
+        variantFactory.reset(compressedVariantFactory(imageFile, runningJob->requestRegion,
+                                                      runningJob->requestSize,
+                                                      runningJob->providerOptions, variantFrame));
+        if (variantFactory && !variantFactory->needsFallback()) {
+            QQuickTextureFactory *factory = variantFactory.release();
+            PIXMAP_READER_LOCK();
+            if (!cancelledJobs.contains(runningJob))
+                runningJob->postReply(errorCode, errorStr, factory->textureSize(), factory);
+            else
+                delete factory;
+            return;
+        }
+
+        QFile f(imageFile);
+        if (f.open(QIODevice::ReadOnly)) {
+            QSGTextureReader texReader(&f, localFile);
+            if (backendSupport()->hasOpenGL && texReader.isTexture()) {
+                QQuickTextureFactory *factory = texReader.read();
+                if (factory) {
+                    readSize = factory->textureSize();
+                } else {
+                    errorStr = QQuickPixmap::tr("Error decoding: %1").arg(url.toString());
+                    if (f.fileName() != localFile)
+                        errorStr += QString::fromLatin1(" (%1)").arg(f.fileName());
+                    errorCode = QQuickPixmapReply::Decoding;
+                }
+                PIXMAP_READER_LOCK();
+                if (!cancelledJobs.contains(runningJob))
+                    runningJob->postReply(errorCode, errorStr, readSize, factory);
+                return;
+            } else {
+                int frameCount;
+                int const frame = runningJob->data ? runningJob->data->frame : 0;
+                if (!readImage(url, &f, &image, &errorStr, &readSize, &frameCount,
+                               runningJob->requestRegion, runningJob->requestSize,
+                               runningJob->providerOptions, nullptr, frame)) {
+                    errorCode = QQuickPixmapReply::Loading;
+                    if (f.fileName() != localFile)
+                        errorStr += QString::fromLatin1(" (%1)").arg(f.fileName());
+                } else if (runningJob->data) {
+                    runningJob->data->frameCount = frameCount;
+                }
+            }
+        } else {
+            errorStr = QQuickPixmap::tr("Cannot open: %1").arg(url.toString());
+            errorCode = QQuickPixmapReply::Loading;
+        }
+    }
+    // Converting the image for the texture is not for free either; skip
+    // it if the job was cancelled while decoding
+    if (isCancelled(runningJob))
+        return;
+    QQuickTextureFactory *factory = QQuickTextureFactory::textureFactoryForImage(image);
+    if (factory && variantFactory) {
+        variantFactory->setFallback(factory);
+        factory = variantFactory.release();
+    }
+    PIXMAP_READER_LOCK();
+    if (!cancelledJobs.contains(runningJob))
+        runningJob->postReply(errorCode, errorStr, readSize, factory);
+    else
+        delete factory;
+}
+
 QQuickPixmapReader *QQuickPixmapReader::instance(QQmlEngine *engine)
 {
     // XXX NOTE: must be called within readerMutex locking.
@@ -1117,6 +1407,7 @@ QQuickPixmapReply *QQuickPixmapReader::getImage(QQuickPixmapData *data)
 void QQuickPixmapReader::startJob(QQuickPixmapReply *job)
 {
     PIXMAP_READER_LOCK();
+    job->queuedTimer.start();
     jobs.append(job);
     if (readerThreadExecutionEnforcer())
         readerThreadExecutionEnforcer()->processJobsOnReaderThreadLater();
@@ -1141,6 +1432,16 @@ void QQuickPixmapReader::cancel(QQuickPixmapReply *reply)
     }
 }
 
+/*! \internal
+    Changes the priority of \a reply, which takes effect if it is still
+    waiting to be read or decoded.
+*/
+void QQuickPixmapReader::setPriority(QQuickPixmapReply *reply, QQuickPixmap::Priority priority)
+{
+    PIXMAP_READER_LOCK();
+    reply->priority = priority;
+}
+
 void QQuickPixmapReader::run()
 {
     Q_ASSERT_CALLED_ON_VALID_THREAD(m_readerThreadAffinityMarker);
@@ -1217,6 +1518,11 @@ inline QDebug operator<<(QDebug debug, const QQuickPixmapKey &key)
 }
 #endif
 
+QQuickPixmapCache::QQuickPixmapCache()
+    : m_unreferencedBudget(defaultUnreferencedBudget)
+{
+}
+
 QQuickPixmapCache *QQuickPixmapCache::instance()
 {
     static QQuickPixmapCache self;
@@ -1297,8 +1603,12 @@ void QQuickPixmapCache::unreferencePixmap(QQuickPixmapData *data)
     data->prevUnreferencedPtr = &m_unreferencedPixmaps;
     if (!m_destroying) { // the texture factories may have been cleaned up already.
         m_unreferencedCost += data->cost();
-        qCDebug(lcImg) << data->url << "had cost" << data->cost() << "of total unreferenced" << m_unreferencedCost;
+        data->unreferencedTextureCost = textureCost(data);
+        m_unreferencedTextureCost += data->unreferencedTextureCost;
+        qCDebug(lcImg) << data->url << "had cost" << data->cost() << "of total unreferenced" << m_unreferencedCost
+                       << "and texture cost" << data->unreferencedTextureCost << "of" << m_unreferencedTextureCost;
     }
+    ++m_unreferencedCount;
 
     m_unreferencedPixmaps = data;
     if (m_unreferencedPixmaps->nextUnreferenced) {
@@ -1309,12 +1619,16 @@ void QQuickPixmapCache::unreferencePixmap(QQuickPixmapData *data)
     if (!m_lastUnreferencedPixmap)
         m_lastUnreferencedPixmap = data;
 
-    shrinkCache(-1); // Shrink the cache in case it has become larger than cache_limit
+    shrinkCache(-1); // Shrink the cache in case it has become larger than its budgets
 
     if (m_timerId == -1 && m_unreferencedPixmaps
             && !m_destroying && !QCoreApplication::closingDown()) {
         m_timerId = startTimer(CACHE_EXPIRE_TIME * 1000);
+        if (!m_memoryPressureMonitorStarted)
+            startMemoryPressureMonitor();
     }
+    if (!m_destroying)
+        emit statisticsChanged();
 }
 
 /*! \internal
@@ -1338,17 +1652,42 @@ void QQuickPixmapCache::referencePixmap(QQuickPixmapData *data)
     data->prevUnreferenced = nullptr;
 
     m_unreferencedCost -= data->cost();
+    m_unreferencedTextureCost -= data->unreferencedTextureCost;
+    data->unreferencedTextureCost = 0;
+    --m_unreferencedCount;
     qCDebug(lcImg) << data->url << "subtracts cost" << data->cost() << "of total" << m_unreferencedCost;
+    emit statisticsChanged();
 }
 
 /*! \internal
     Delete the least-recently-released QQuickPixmapData instances
-    until the remaining bytes are less than cache_limit.
+    until the remaining bytes are less than the budgets for image data and
+    for textures. Under memory pressure, the budgets are halved, or ignored
+    altogether when it is critical.
 */
-void QQuickPixmapCache::shrinkCache(int remove)
-{
-    qCDebug(lcImg) << "reduce unreferenced cost" << m_unreferencedCost << "to less than limit" << cache_limit;
-    while ((remove > 0 || m_unreferencedCost > cache_limit) && m_lastUnreferencedPixmap) {
+void QQuickPixmapCache::shrinkCache(qsizetype remove)
+{
+    qsizetype budget = m_unreferencedBudget;
+    qsizetype textureBudget = m_textureBudget;
+    switch (m_memoryPressure) {
+    case QQuickMemoryPressureMonitor::NoPressure:
+        break;
+    case QQuickMemoryPressureMonitor::ModeratePressure:
+        budget /= 2;
+        textureBudget = textureBudget < 0 ? budget : textureBudget / 2;
+        break;
+    case QQuickMemoryPressureMonitor::CriticalPressure:
+        budget = 0;
+        textureBudget = 0;
+        break;
+    }
+
+    qCDebug(lcImg) << "reduce unreferenced cost" << m_unreferencedCost << "to less than limit" << budget
+                   << "and texture cost" << m_unreferencedTextureCost << "to less than" << textureBudget;
+    bool shrunk = false;
+    while ((remove > 0 || m_unreferencedCost > budget
+            || (textureBudget >= 0 && m_unreferencedTextureCost > textureBudget))
+           && m_lastUnreferencedPixmap) {
         QQuickPixmapData *data = m_lastUnreferencedPixmap;
         Q_ASSERT(data->nextUnreferenced == nullptr);
 
@@ -1360,15 +1699,142 @@ void QQuickPixmapCache::shrinkCache(int remove)
         if (!m_destroying) {
             remove -= data->cost();
             m_unreferencedCost -= data->cost();
+            m_unreferencedTextureCost -= data->unreferencedTextureCost;
+            ++m_evictionCount;
         }
+        --m_unreferencedCount;
         data->removeFromCache(this);
         delete data;
+        shrunk = true;
+    }
+    if (shrunk && !m_destroying)
+        emit statisticsChanged();
+}
+
+void QQuickPixmapCache::setUnreferencedBudget(qsizetype budget)
+{
+    m_unreferencedBudget = qMax<qsizetype>(0, budget);
+    shrinkCache(-1);
+    emit statisticsChanged();
+}
+
+/*! \internal
+    Sets the budget for the textures of the unreferenced pixmaps, in bytes.
+    Textures stay alive as long as the pixmap they were created from, even
+    when nothing shows it anymore. A negative \a budget means no limit.
+*/
+void QQuickPixmapCache::setTextureBudget(qsizetype budget)
+{
+    m_textureBudget = budget < 0 ? -1 : budget;
+    shrinkCache(-1);
+    emit statisticsChanged();
+}
+
+/*! \internal
+    Records that a render context created a texture of \a bytes from the
+    texture \a factory. The cost is estimated by the caller; textures in an
+    atlas are not counted, as releasing them does not free the atlas.
+*/
+void QQuickPixmapCache::textureCreated(const QObject *factory, qsizetype bytes)
+{
+    QMutexLocker locker(&m_textureMutex);
+    m_textureCosts[factory] += bytes;
+    m_textureCost += bytes;
+}
+
+void QQuickPixmapCache::textureReleased(const QObject *factory, qsizetype bytes)
+{
+    QMutexLocker locker(&m_textureMutex);
+    auto it = m_textureCosts.find(factory);
+    if (it == m_textureCosts.end())
+        return;
+    bytes = qMin(bytes, it.value());
+    m_textureCost -= bytes;
+    it.value() -= bytes;
+    if (it.value() <= 0)
+        m_textureCosts.erase(it);
+}
+
+qsizetype QQuickPixmapCache::textureCost(const QQuickPixmapData *data) const
+{
+    if (!data->textureFactory)
+        return 0;
+    QMutexLocker locker(&m_textureMutex);
+    return m_textureCosts.value(data->textureFactory);
+}
+
+QQuickPixmapCache::Statistics QQuickPixmapCache::statistics() const
+{
+    Statistics statistics;
+    statistics.referencedCost = referencedCost();
+    statistics.unreferencedCost = m_unreferencedCost;
+    statistics.unreferencedTextureCost = m_unreferencedTextureCost;
+    statistics.unreferencedPixmapCount = m_unreferencedCount;
+    statistics.evictionCount = m_evictionCount;
+    statistics.memoryPressure = m_memoryPressure;
+    {
+        QMutexLocker locker(&m_cacheMutex);
+        statistics.pixmapCount = int(m_cache.size());
+    }
+    {
+        QMutexLocker locker(&m_textureMutex);
+        statistics.textureCost = m_textureCost;
+    }
+    return statistics;
+}
+
+/*! \internal
+    Evicts unreferenced pixmaps according to the memory pressure \a level,
+    and keeps doing so until the system has not reported any pressure for
+    a while.
+*/
+void QQuickPixmapCache::handleMemoryPressure(QQuickMemoryPressureMonitor::Level level)
+{
+    if (level == QQuickMemoryPressureMonitor::NoPressure) {
+        m_memoryPressureTimer.stop();
+    } else {
+        m_memoryPressureTimer.start(MEMORY_PRESSURE_COOLDOWN, this);
+        level = qMax(level, m_memoryPressure);
+    }
+    if (level == m_memoryPressure)
+        return;
+
+    qCDebug(lcImg) << "memory pressure changed from" << m_memoryPressure << "to" << level;
+    m_memoryPressure = level;
+    shrinkCache(-1);
+    emit statisticsChanged();
+}
+
+void QQuickPixmapCache::startMemoryPressureMonitor()
+{
+    // The monitor belongs to the application, so that its socket notifiers
+    // go away before the event dispatcher does
+    QCoreApplication *application = QCoreApplication::instance();
+    if (!application || application->thread() != QThread::currentThread())
+        return;
+
+    m_memoryPressureMonitorStarted = true;
+    if (qEnvironmentVariableIntValue("QML_PIXMAP_CACHE_IGNORE_MEMORY_PRESSURE") > 0)
+        return;
+
+    auto *monitor = new QQuickMemoryPressureMonitor(application);
+    if (!monitor->isActive()) {
+        delete monitor;
+        return;
     }
+    connect(monitor, &QQuickMemoryPressureMonitor::pressure,
+            this, &QQuickPixmapCache::handleMemoryPressure);
+    m_memoryPressureMonitor = monitor;
 }
 
-void QQuickPixmapCache::timerEvent(QTimerEvent *)
+void QQuickPixmapCache::timerEvent(QTimerEvent *event)
 {
-    int removalCost = m_unreferencedCost / CACHE_REMOVAL_FRACTION;
+    if (event->timerId() == m_memoryPressureTimer.timerId()) {
+        handleMemoryPressure(QQuickMemoryPressureMonitor::NoPressure);
+        return;
+    }
+
+    qsizetype removalCost = m_unreferencedCost / CACHE_REMOVAL_FRACTION;
 
     shrinkCache(removalCost);
 
@@ -1605,7 +2071,17 @@ static QQuickPixmapData* createPixmapDataSync(QQmlEngine *engine, const QUrl &ur
     if (localFile.isEmpty())
         return nullptr;
 
-    QFile f(existingImageFileForPath(localFile));
+    const QString imageFile = existingImageFileForPath(localFile);
+    std::unique_ptr<QSGCompressedTextureVariantFactory> variantFactory(
+            compressedVariantFactory(imageFile, requestRegion, requestSize, providerOptions, frame));
+    if (variantFactory && !variantFactory->needsFallback()) {
+        *ok = true;
+        QQuickTextureFactory *factory = variantFactory.release();
+        return new QQuickPixmapData(url, factory, factory->textureSize(), requestRegion, requestSize,
+                                    providerOptions, QQuickImageProviderOptions::UsePluginDefaultTransform, frame);
+    }
+
+    QFile f(imageFile);
     QSize readSize;
     QString errorString;
 
@@ -1629,7 +2105,12 @@ static QQuickPixmapData* createPixmapDataSync(QQmlEngine *engine, const QUrl &ur
             if (readImage(url, &f, &image, &errorString, &readSize, &frameCount, requestRegion, requestSize,
                           providerOptions, &appliedTransform, frame, devicePixelRatio)) {
                 *ok = true;
-                return new QQuickPixmapData(url, QQuickTextureFactory::textureFactoryForImage(image), readSize, requestRegion, requestSize,
+                QQuickTextureFactory *factory = QQuickTextureFactory::textureFactoryForImage(image);
+                if (factory && variantFactory) {
+                    variantFactory->setFallback(factory);
+                    factory = variantFactory.release();
+                }
+                return new QQuickPixmapData(url, factory, readSize, requestRegion, requestSize,
                                             providerOptions, appliedTransform, frame, frameCount);
             } else if (f.fileName() != localFile) {
                 errorString += QString::fromLatin1(" (%1)").arg(f.fileName());
@@ -1995,6 +2476,25 @@ void QQuickPixmap::loadImageFromDevice(QQmlEngine *engine, QIODevice *device, co
     }
 }
 
+/*!
+    Sets the \a priority with which the image is loaded, if it is still
+    waiting to be loaded asynchronously. Images with a higher priority are
+    read and decoded first; an image that is no longer visible can be
+    moved behind the ones that are.
+
+    The priority applies to the load that is shared by all the pixmaps
+    loading the same image.
+*/
+void QQuickPixmap::setPriority(Priority priority)
+{
+    if (!d || !d->reply)
+        return;
+
+    QMutexLocker locker(&QQuickPixmapReader::readerMutex);
+    if (QQuickPixmapReader *reader = QQuickPixmapReader::existingInstance(d->reply->engineForReader))
+        reader->setPriority(d->reply, priority);
+}
+
 void QQuickPixmap::clear()
 {
     if (d) {
@@ -15,10 +15,13 @@
 // We mean it.
 //
 
+#include <QtCore/qbasictimer.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qpointer.h>
 #include <QtCore/qurl.h>
 #include <QtQuick/qquickimageprovider.h>
 #include <private/qquickpixmap_p.h>
+#include <private/qquickmemorypressure_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,16 +57,44 @@ public:
 
     void purgeCache();
 
+    qsizetype unreferencedBudget() const { return m_unreferencedBudget; }
+    void setUnreferencedBudget(qsizetype budget);
+    qsizetype textureBudget() const { return m_textureBudget; }
+    void setTextureBudget(qsizetype budget);
+
+    // Called by the render contexts, on any thread
+    void textureCreated(const QObject *factory, qsizetype bytes);
+    void textureReleased(const QObject *factory, qsizetype bytes);
+
+    struct Statistics {
+        qsizetype referencedCost = 0;
+        qsizetype unreferencedCost = 0;
+        qsizetype textureCost = 0;
+        qsizetype unreferencedTextureCost = 0;
+        int pixmapCount = 0;
+        int unreferencedPixmapCount = 0;
+        int evictionCount = 0;
+        QQuickMemoryPressureMonitor::Level memoryPressure = QQuickMemoryPressureMonitor::NoPressure;
+    };
+    Statistics statistics() const;
+
+    void handleMemoryPressure(QQuickMemoryPressureMonitor::Level level);
+
+Q_SIGNALS:
+    void statisticsChanged();
+
 protected:
     void timerEvent(QTimerEvent *) override;
 
 private:
-    QQuickPixmapCache() = default;
+    QQuickPixmapCache();
     Q_DISABLE_COPY(QQuickPixmapCache)
 
-    void shrinkCache(int remove);
+    void shrinkCache(qsizetype remove);
     int destroyCache();
     qsizetype referencedCost() const;
+    qsizetype textureCost(const QQuickPixmapData *data) const;
+    void startMemoryPressureMonitor();
 
 private:
     QHash<QQuickPixmapKey, QQuickPixmapData *> m_cache;
@@ -72,10 +103,26 @@ private:
     QQuickPixmapData *m_unreferencedPixmaps = nullptr;
     QQuickPixmapData *m_lastUnreferencedPixmap = nullptr;
 
-    int m_unreferencedCost = 0;
+    qsizetype m_unreferencedCost = 0;
+    qsizetype m_unreferencedTextureCost = 0;
+    qsizetype m_unreferencedBudget;
+    qsizetype m_textureBudget = -1; // no limit
+    int m_unreferencedCount = 0;
+    int m_evictionCount = 0;
     int m_timerId = -1;
     bool m_destroying = false;
 
+    // Bytes of the textures that the render contexts created from each texture factory
+    mutable QMutex m_textureMutex;
+    QHash<const QObject *, qsizetype> m_textureCosts;
+    qsizetype m_textureCost = 0;
+
+    // While the system is short of memory, nothing unreferenced is kept
+    QPointer<QQuickMemoryPressureMonitor> m_memoryPressureMonitor;
+    QQuickMemoryPressureMonitor::Level m_memoryPressure = QQuickMemoryPressureMonitor::NoPressure;
+    QBasicTimer m_memoryPressureTimer;
+    bool m_memoryPressureMonitorStarted = false;
+
     friend class QQuickPixmap;
     friend class QQuickPixmapData;
     friend class tst_qquickpixmapcache;
@@ -0,0 +1,178 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickpixmapcacheinfo_p.h"
+
+#include <QtCore/qcoreevent.h>
+
+QT_BEGIN_NAMESPACE
+
+// The cache changes with every image that is shown or hidden, so the
+// statistics are updated at most this often, in milliseconds
+#define STATISTICS_UPDATE_INTERVAL 250
+
+/*!
+    \qmltype PixmapCache
+    \inqmlmodule QtQuick
+    \since 6.10
+
+    \brief Provides the budgets and statistics of the image cache.
+
+    Images loaded by \l Image, \l BorderImage and \l AnimatedImage are
+    shared between all the items and engines of an application through a
+    cache. An image that is no longer shown is kept in the cache for a
+    while, in case it is needed again, as long as all the unreferenced
+    images fit within the cache's budgets. The least recently released
+    images are evicted first.
+
+    The PixmapCache singleton allows changing those budgets, and monitoring
+    how much memory the cache holds:
+
+    \qml
+    Component.onCompleted: {
+        PixmapCache.budget = 32 * 1024 * 1024
+        PixmapCache.textureBudget = 64 * 1024 * 1024
+    }
+    \endqml
+
+    On Linux, the cache also watches the memory pressure that the kernel
+    reports for the system, or for the cgroup of the application. When
+    some tasks stall on memory, the budgets are halved; when all of them
+    do, all unreferenced images are evicted. The cache goes back to its
+    budgets once no pressure has been reported for a while. Set the
+    environment variable \c QML_PIXMAP_CACHE_IGNORE_MEMORY_PRESSURE to \c 1
+    to disable this.
+
+    The statistics are updated at most four times per second.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::budget
+
+    The number of bytes of unreferenced image data that the cache keeps for
+    reuse. The default is 2 MB. Set it to \c 0 to release images as soon as
+    they are no longer used.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::textureBudget
+
+    The number of bytes of graphics memory that the textures of unreferenced
+    images may hold. The textures are estimated at four bytes per pixel, and
+    textures in an atlas are not counted. The default, \c -1, means no limit
+    besides \l budget.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::referencedBytes
+    \readonly
+
+    The number of bytes of image data that are in use.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::unreferencedBytes
+    \readonly
+
+    The number of bytes of image data that are kept for reuse.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::textureBytes
+    \readonly
+
+    The estimated number of bytes of graphics memory held by the textures
+    of cached images.
+*/
+
+/*!
+    \qmlproperty double PixmapCache::unreferencedTextureBytes
+    \readonly
+
+    The estimated number of bytes of graphics memory held by the textures
+    of the images that are kept for reuse.
+*/
+
+/*!
+    \qmlproperty int PixmapCache::pixmapCount
+    \readonly
+
+    The number of images in the cache.
+*/
+
+/*!
+    \qmlproperty int PixmapCache::unreferencedPixmapCount
+    \readonly
+
+    The number of images in the cache that are not in use.
+*/
+
+/*!
+    \qmlproperty int PixmapCache::evictionCount
+    \readonly
+
+    The number of unreferenced images that have been evicted from the
+    cache since the application started.
+*/
+
+/*!
+    \qmlproperty enumeration PixmapCache::memoryPressure
+    \readonly
+
+    The memory pressure that the cache currently reacts to:
+
+    \value PixmapCache.NoPressure
+        The cache keeps images within its budgets.
+    \value PixmapCache.ModeratePressure
+        The cache keeps images within half of its budgets.
+    \value PixmapCache.CriticalPressure
+        The cache keeps no unreferenced images.
+*/
+
+QQuickPixmapCacheInfo::QQuickPixmapCacheInfo(QObject *parent)
+    : QObject(parent), m_statistics(QQuickPixmapCache::instance()->statistics())
+{
+    connect(QQuickPixmapCache::instance(), &QQuickPixmapCache::statisticsChanged,
+            this, &QQuickPixmapCacheInfo::scheduleUpdate);
+}
+
+qint64 QQuickPixmapCacheInfo::budget() const
+{
+    return QQuickPixmapCache::instance()->unreferencedBudget();
+}
+
+void QQuickPixmapCacheInfo::setBudget(qint64 budget)
+{
+    QQuickPixmapCache::instance()->setUnreferencedBudget(budget);
+}
+
+qint64 QQuickPixmapCacheInfo::textureBudget() const
+{
+    return QQuickPixmapCache::instance()->textureBudget();
+}
+
+void QQuickPixmapCacheInfo::setTextureBudget(qint64 budget)
+{
+    QQuickPixmapCache::instance()->setTextureBudget(budget);
+}
+
+void QQuickPixmapCacheInfo::scheduleUpdate()
+{
+    if (!m_updateTimer.isActive())
+        m_updateTimer.start(STATISTICS_UPDATE_INTERVAL, this);
+}
+
+void QQuickPixmapCacheInfo::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_updateTimer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+    m_updateTimer.stop();
+    m_statistics = QQuickPixmapCache::instance()->statistics();
+    emit statisticsChanged();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qquickpixmapcacheinfo_p.cpp"
@@ -0,0 +1,84 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKPIXMAPCACHEINFO_P_H
+#define QQUICKPIXMAPCACHEINFO_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qobject.h>
+#include <QtQml/qqml.h>
+
+#include <private/qtquickglobal_p.h>
+#include <private/qquickpixmapcache_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICK_EXPORT QQuickPixmapCacheInfo : public QObject
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(PixmapCache)
+    QML_ADDED_IN_VERSION(6, 10)
+    QML_SINGLETON
+
+    Q_PROPERTY(qint64 budget READ budget WRITE setBudget NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(qint64 textureBudget READ textureBudget WRITE setTextureBudget NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(qint64 referencedBytes READ referencedBytes NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(qint64 unreferencedBytes READ unreferencedBytes NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(qint64 textureBytes READ textureBytes NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(qint64 unreferencedTextureBytes READ unreferencedTextureBytes NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(int pixmapCount READ pixmapCount NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(int unreferencedPixmapCount READ unreferencedPixmapCount NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(int evictionCount READ evictionCount NOTIFY statisticsChanged FINAL)
+    Q_PROPERTY(MemoryPressure memoryPressure READ memoryPressure NOTIFY statisticsChanged FINAL)
+
+public:
+    enum MemoryPressure {
+        NoPressure = QQuickMemoryPressureMonitor::NoPressure,
+        ModeratePressure = QQuickMemoryPressureMonitor::ModeratePressure,
+        CriticalPressure = QQuickMemoryPressureMonitor::CriticalPressure
+    };
+    Q_ENUM(MemoryPressure)
+
+    explicit QQuickPixmapCacheInfo(QObject *parent = nullptr);
+
+    qint64 budget() const;
+    void setBudget(qint64 budget);
+    qint64 textureBudget() const;
+    void setTextureBudget(qint64 budget);
+
+    qint64 referencedBytes() const { return m_statistics.referencedCost; }
+    qint64 unreferencedBytes() const { return m_statistics.unreferencedCost; }
+    qint64 textureBytes() const { return m_statistics.textureCost; }
+    qint64 unreferencedTextureBytes() const { return m_statistics.unreferencedTextureCost; }
+    int pixmapCount() const { return m_statistics.pixmapCount; }
+    int unreferencedPixmapCount() const { return m_statistics.unreferencedPixmapCount; }
+    int evictionCount() const { return m_statistics.evictionCount; }
+    MemoryPressure memoryPressure() const { return MemoryPressure(m_statistics.memoryPressure); }
+
+Q_SIGNALS:
+    void statisticsChanged();
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    void scheduleUpdate();
+
+    QQuickPixmapCache::Statistics m_statistics;
+    QBasicTimer m_updateTimer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKPIXMAPCACHEINFO_P_H
@@ -0,0 +1,309 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickpixmapdiskcache_p.h"
+
+#include <QtGui/qcolorspace.h>
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qstandardpaths.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::Literals::StringLiterals;
+
+Q_STATIC_LOGGING_CATEGORY(lcDiskCache, "qt.quick.image.diskcache")
+
+namespace {
+
+// Written in native byte order; the cache is not meant to be shared between machines
+struct EntryHeader
+{
+    char magic[4];
+    quint32 version;
+    qint32 width;
+    qint32 height;
+    qint32 bytesPerLine;
+    qint32 format;
+    qint32 implicitWidth;
+    qint32 implicitHeight;
+    qint32 frameCount;
+    qint32 appliedTransform;
+    quint32 iccProfileSize;
+    quint32 colorCount;
+    quint32 dataOffset;
+};
+
+constexpr char entryMagic[4] = { 'Q', 'P', 'X', 'C' };
+constexpr quint32 entryVersion = 2;
+constexpr quint32 dataAlignment = 64;
+// Smaller entries are read rather than mapped, so that a view full of
+// thumbnails does not keep a file open for each of them
+constexpr qint64 mapThreshold = 1024 * 1024;
+constexpr qint64 touchInterval = 24 * 60 * 60; // seconds
+
+}
+
+static QFileInfoList cacheEntries(const QString &directory)
+{
+    // Least recently used first
+    return QDir(directory).entryInfoList({ u"*.qpxc"_s }, QDir::Files, QDir::Time | QDir::Reversed);
+}
+
+QQuickPixmapDiskCache::QQuickPixmapDiskCache(const QString &directory, qint64 budget)
+    : m_directory(directory), m_budget(budget)
+{
+    QDir::root().mkpath(m_directory);
+    // One thread is enough to keep up with the decoding threads
+    m_storePool.setMaxThreadCount(1);
+}
+
+QQuickPixmapDiskCache *QQuickPixmapDiskCache::instance()
+{
+    static const std::unique_ptr<QQuickPixmapDiskCache> cache = []() -> std::unique_ptr<QQuickPixmapDiskCache> {
+        QString directory = qEnvironmentVariable("QML_PIXMAP_DISK_CACHE_PATH");
+        if (directory.isEmpty()) {
+            if (qEnvironmentVariableIntValue("QML_PIXMAP_DISK_CACHE") <= 0)
+                return nullptr;
+            directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+                    + "/qmlpixmapcache"_L1;
+        }
+        bool ok = false;
+        qint64 megabytes = qEnvironmentVariableIntValue("QML_PIXMAP_DISK_CACHE_SIZE", &ok);
+        if (!ok || megabytes <= 0)
+            megabytes = 256;
+        qCDebug(lcDiskCache) << "caching decoded images in" << directory << "up to" << megabytes << "MB";
+        return std::make_unique<QQuickPixmapDiskCache>(directory, megabytes * 1024 * 1024);
+    }();
+    return cache.get();
+}
+
+/*!
+    Returns the key of the image decoded from \a fileName with the given
+    request, or an empty string if the result should not be cached.
+*/
+QString QQuickPixmapDiskCache::key(const QString &fileName, const QRect &requestRegion,
+                                   const QSize &requestSize, const QQuickImageProviderOptions &options,
+                                   int frame, qreal devicePixelRatio)
+{
+    // The result of a color space conversion depends on more than we want to hash
+    if (options.targetColorSpace().isValid())
+        return QString();
+
+    const QFileInfo info(fileName);
+    const QDateTime lastModified = info.lastModified();
+    if (!lastModified.isValid())
+        return QString();
+
+    QByteArray request;
+    QDataStream stream(&request, QIODevice::WriteOnly);
+    stream << info.absoluteFilePath() << lastModified.toMSecsSinceEpoch() << info.size()
+           << requestRegion << requestSize << qint32(options.autoTransform())
+           << options.preserveAspectRatioCrop() << options.preserveAspectRatioFit()
+           << qint32(frame) << devicePixelRatio;
+    return QString::fromLatin1(QCryptographicHash::hash(request, QCryptographicHash::Sha1).toHex());
+}
+
+QString QQuickPixmapDiskCache::entryPath(const QString &key) const
+{
+    return m_directory + u'/' + key + ".qpxc"_L1;
+}
+
+bool QQuickPixmapDiskCache::load(const QString &key, Entry *entry)
+{
+    auto file = std::make_unique<QFile>(entryPath(key));
+    if (!file->open(QIODevice::ReadOnly))
+        return false;
+
+    const qint64 size = file->size();
+    EntryHeader header;
+    if (file->read(reinterpret_cast<char *>(&header), sizeof(header)) != qint64(sizeof(header)))
+        return false;
+
+    if (memcmp(header.magic, entryMagic, sizeof(entryMagic)) != 0 || header.version != entryVersion
+            || header.format <= QImage::Format_Invalid || header.format >= QImage::NImageFormats
+            || header.width <= 0 || header.height <= 0 || header.bytesPerLine <= 0
+            || header.colorCount > 256
+            || header.dataOffset < sizeof(header) + header.iccProfileSize + header.colorCount * sizeof(QRgb)
+            || header.dataOffset + qint64(header.bytesPerLine) * header.height > size) {
+        qCDebug(lcDiskCache) << "removing invalid entry" << file->fileName();
+        file->remove();
+        return false;
+    }
+
+    const QByteArray iccProfile = file->read(header.iccProfileSize);
+    QList<QRgb> colorTable(header.colorCount);
+    const qint64 colorTableSize = header.colorCount * sizeof(QRgb);
+    if (file->read(reinterpret_cast<char *>(colorTable.data()), colorTableSize) != colorTableSize)
+        return false;
+    const qint64 dataSize = qint64(header.bytesPerLine) * header.height;
+    QImage image;
+    if (dataSize >= mapThreshold) {
+        if (uchar *data = file->map(header.dataOffset, dataSize)) {
+            // The image owns the file, and closing it unmaps the data
+            QFile *mappedFile = file.release();
+            image = QImage(static_cast<const uchar *>(data), header.width, header.height,
+                           header.bytesPerLine, QImage::Format(header.format),
+                           [](void *info) { delete static_cast<QFile *>(info); }, mappedFile);
+            if (image.isNull())
+                delete mappedFile;
+        }
+    } else {
+        image = QImage(header.width, header.height, QImage::Format(header.format));
+        if (!image.isNull() && image.bytesPerLine() == header.bytesPerLine) {
+            file->seek(header.dataOffset);
+            if (file->read(reinterpret_cast<char *>(image.bits()), dataSize) != dataSize)
+                image = QImage();
+        } else {
+            image = QImage();
+        }
+    }
+    if (image.isNull())
+        return false;
+
+    if (!colorTable.isEmpty())
+        image.setColorTable(colorTable);
+    if (!iccProfile.isEmpty())
+        image.setColorSpace(QColorSpace::fromIccProfile(iccProfile));
+
+    // Keep the entries that are in use from being trimmed
+    QFileInfo info(entryPath(key));
+    if (info.lastModified().secsTo(QDateTime::currentDateTime()) > touchInterval) {
+        QFile touched(info.filePath());
+        if (touched.open(QIODevice::ReadOnly))
+            touched.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    }
+
+    entry->image = image;
+    entry->implicitSize = QSize(header.implicitWidth, header.implicitHeight);
+    entry->frameCount = header.frameCount;
+    entry->appliedTransform = QQuickImageProviderOptions::AutoTransform(header.appliedTransform);
+    qCDebug(lcDiskCache) << "loaded" << key << image.size() << image.format();
+    return true;
+}
+
+bool QQuickPixmapDiskCache::store(const QString &key, const Entry &entry)
+{
+    if (entry.image.isNull())
+        return false;
+
+    // Stored as decoded, so that a hit gives the same image as decoding
+    const QImage &image = entry.image;
+    const QList<QRgb> colorTable = image.colorTable();
+    const QByteArray iccProfile = image.colorSpace().isValid() ? image.colorSpace().iccProfile()
+                                                              : QByteArray();
+    EntryHeader header;
+    memcpy(header.magic, entryMagic, sizeof(entryMagic));
+    header.version = entryVersion;
+    header.width = image.width();
+    header.height = image.height();
+    header.bytesPerLine = int(image.bytesPerLine());
+    header.format = image.format();
+    header.implicitWidth = entry.implicitSize.width();
+    header.implicitHeight = entry.implicitSize.height();
+    header.frameCount = entry.frameCount;
+    header.appliedTransform = entry.appliedTransform;
+    header.iccProfileSize = quint32(iccProfile.size());
+    header.colorCount = quint32(colorTable.size());
+    const quint32 colorTableSize = header.colorCount * quint32(sizeof(QRgb));
+    header.dataOffset = (quint32(sizeof(header)) + header.iccProfileSize + colorTableSize
+                         + dataAlignment - 1) & ~(dataAlignment - 1);
+
+    // Written to a temporary file and renamed, so that other threads and
+    // processes never see a partial entry
+    QSaveFile file(entryPath(key));
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(iccProfile);
+    file.write(reinterpret_cast<const char *>(colorTable.constData()), colorTableSize);
+    file.write(QByteArray(header.dataOffset - sizeof(header) - iccProfile.size() - colorTableSize, '\0'));
+    file.write(reinterpret_cast<const char *>(image.constBits()), image.sizeInBytes());
+
+    // Replacing the entry and accounting for it happen together, so that
+    // concurrent stores of the same key only count the file that remains
+    QMutexLocker locker(&m_mutex);
+    const QFileInfo previous(file.fileName());
+    const qint64 previousSize = previous.exists() ? previous.size() : 0;
+    if (!file.commit()) {
+        qCDebug(lcDiskCache) << "failed to store" << key << file.errorString();
+        return false;
+    }
+
+    qCDebug(lcDiskCache) << "stored" << key << image.size() << image.format();
+    updateUsedBytes(header.dataOffset + image.sizeInBytes() - previousSize);
+    return true;
+}
+
+/*!
+    Stores \a entry under \a key on a background thread, so that writing the
+    file does not delay the image load that decoded it.
+*/
+void QQuickPixmapDiskCache::storeLater(const QString &key, const Entry &entry)
+{
+    m_storePool.start([this, key, entry]() { store(key, entry); });
+}
+
+/*!
+    Blocks until the entries passed to storeLater() have been written.
+*/
+void QQuickPixmapDiskCache::waitForStores()
+{
+    m_storePool.waitForDone();
+}
+
+qint64 QQuickPixmapDiskCache::usedBytes()
+{
+    QMutexLocker locker(&m_mutex);
+    updateUsedBytes(0);
+    return m_usedBytes;
+}
+
+/*!
+    Adds \a delta to the size of the cache, and trims it if it exceeds the
+    budget. Must be called with the mutex locked.
+*/
+void QQuickPixmapDiskCache::updateUsedBytes(qint64 delta)
+{
+    if (m_usedBytes < 0) {
+        m_usedBytes = 0;
+        for (const QFileInfo &info : cacheEntries(m_directory))
+            m_usedBytes += info.size();
+    } else {
+        m_usedBytes += delta;
+    }
+    if (m_usedBytes > m_budget)
+        trim();
+}
+
+/*!
+    Removes the least recently used entries until the cache is well within
+    its budget again, so that it is not trimmed on every store. Must be
+    called with the mutex locked.
+*/
+void QQuickPixmapDiskCache::trim()
+{
+    const QFileInfoList entries = cacheEntries(m_directory);
+    m_usedBytes = 0;
+    for (const QFileInfo &info : entries)
+        m_usedBytes += info.size();
+
+    const qint64 target = m_budget / 4 * 3;
+    for (const QFileInfo &info : entries) {
+        if (m_usedBytes <= target)
+            break;
+        if (QFile::remove(info.filePath()))
+            m_usedBytes -= info.size();
+    }
+    qCDebug(lcDiskCache) << "trimmed to" << m_usedBytes << "bytes";
+}
+
+QT_END_NAMESPACE
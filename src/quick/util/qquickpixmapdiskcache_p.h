@@ -0,0 +1,87 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKPIXMAPDISKCACHE_P_H
+#define QQUICKPIXMAPDISKCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+#include <QtQuick/private/qquickpixmap_p.h>
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qthreadpool.h>
+#include <QtGui/qimage.h>
+
+QT_BEGIN_NAMESPACE
+
+/*! \internal
+    A persistent cache of decoded images, so that local image files do not
+    need to be decoded again after the process restarts, or after
+    QQuickPixmapCache has dropped them.
+
+    Each entry holds the pixels of one decoded image, in the format that
+    the image reader produced, and is keyed by the file, its
+    modification time and size, and the request (source size, clip rect,
+    frame and options). Thumbnails of the same file at different source
+    sizes are separate entries. Entries are memory mapped when loaded.
+
+    The cache is disabled unless QML_PIXMAP_DISK_CACHE is set to 1 or
+    QML_PIXMAP_DISK_CACHE_PATH names a directory. QML_PIXMAP_DISK_CACHE_SIZE
+    sets its budget in megabytes; the least recently used entries are
+    removed when it is exceeded.
+*/
+class Q_QUICK_AUTOTEST_EXPORT QQuickPixmapDiskCache
+{
+public:
+    struct Entry {
+        QImage image;
+        QSize implicitSize;
+        int frameCount = 1;
+        QQuickImageProviderOptions::AutoTransform appliedTransform
+                = QQuickImageProviderOptions::UsePluginDefaultTransform;
+    };
+
+    QQuickPixmapDiskCache(const QString &directory, qint64 budget);
+
+    static QQuickPixmapDiskCache *instance();
+
+    static QString key(const QString &fileName, const QRect &requestRegion, const QSize &requestSize,
+                       const QQuickImageProviderOptions &options, int frame, qreal devicePixelRatio);
+
+    bool load(const QString &key, Entry *entry);
+    bool store(const QString &key, const Entry &entry);
+    void storeLater(const QString &key, const Entry &entry);
+    void waitForStores();
+
+    QString directory() const { return m_directory; }
+    qint64 usedBytes();
+
+private:
+    QString entryPath(const QString &key) const;
+    void updateUsedBytes(qint64 delta);
+    void trim();
+
+    const QString m_directory;
+    const qint64 m_budget;
+
+    QMutex m_mutex;
+    qint64 m_usedBytes = -1; // unknown until the directory was scanned
+
+    // Destroyed first, waiting for the pending stores
+    QThreadPool m_storePool;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKPIXMAPDISKCACHE_P_H
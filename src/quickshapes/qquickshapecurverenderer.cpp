@@ -5,6 +5,7 @@
 #include "qquickshapecurverenderer_p_p.h"
 
 #if QT_CONFIG(thread)
+#include <QtCore/qsemaphore.h>
 #include <QtCore/qthreadpool.h>
 #endif
 
@@ -20,6 +21,8 @@
 #include <QtQuick/private/qsgcurveprocessor_p.h>
 #include <QtQuick/qsgmaterial.h>
 
+#include <atomic>
+
 QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(lcShapeCurveRenderer, "qt.shape.curverenderer");
@@ -166,6 +169,25 @@ void QQuickShapeCurveRenderer::setPath(int index, const QPainterPath &path, QQui
     pathData.m_dirty |= PathDirty;
 }
 
+/*!
+    \internal
+    Sets the path at \a index from quadratic paths that were processed ahead
+    of time: \a path is stroked and \a fillPath, which must already have its
+    intersections and overlaps solved and its curvature data added, is filled.
+    This skips the conversion of the path, which dominates the cost of a sync.
+    The fill rule is taken from \a path; setFillRule() must not be called for
+    such a path, as it would convert the (empty) painter path again.
+*/
+void QQuickShapeCurveRenderer::setPreprocessedPath(int index, const QQuadPath &path, const QQuadPath &fillPath)
+{
+    auto &pathData = m_paths[index];
+    pathData.originalPath = QPainterPath();
+    pathData.fillRule = path.fillRule();
+    pathData.path = path;
+    pathData.fillPath = fillPath;
+    pathData.m_dirty |= (FillDirty | StrokeDirty);
+}
+
 void QQuickShapeCurveRenderer::setStrokeColor(int index, const QColor &color)
 {
     auto &pathData = m_paths[index];
@@ -240,25 +262,22 @@ void QQuickShapeCurveRenderer::setStrokeStyle(int index,
 
 void QQuickShapeCurveRenderer::setFillGradient(int index, QQuickShapeGradient *gradient)
 {
-    PathData &pd(m_paths[index]);
-    const bool wasVisible = pd.isFillVisible();
-    pd.gradientType = QGradient::NoGradient;
+    QSGGradientCache::GradientDesc desc;
+    QGradient::Type type = QGradient::NoGradient;
     if (QQuickShapeLinearGradient *g  = qobject_cast<QQuickShapeLinearGradient *>(gradient)) {
-        pd.gradientType = QGradient::LinearGradient;
-        pd.gradient.stops = gradient->gradientStops();
-        pd.gradient.spread = QGradient::Spread(gradient->spread());
-        pd.gradient.a = QPointF(g->x1(), g->y1());
-        pd.gradient.b = QPointF(g->x2(), g->y2());
+        type = QGradient::LinearGradient;
+        desc.a = QPointF(g->x1(), g->y1());
+        desc.b = QPointF(g->x2(), g->y2());
     } else if (QQuickShapeRadialGradient *g = qobject_cast<QQuickShapeRadialGradient *>(gradient)) {
-        pd.gradientType = QGradient::RadialGradient;
-        pd.gradient.a = QPointF(g->centerX(), g->centerY());
-        pd.gradient.b = QPointF(g->focalX(), g->focalY());
-        pd.gradient.v0 = g->centerRadius();
-        pd.gradient.v1 = g->focalRadius();
+        type = QGradient::RadialGradient;
+        desc.a = QPointF(g->centerX(), g->centerY());
+        desc.b = QPointF(g->focalX(), g->focalY());
+        desc.v0 = g->centerRadius();
+        desc.v1 = g->focalRadius();
     } else if (QQuickShapeConicalGradient *g = qobject_cast<QQuickShapeConicalGradient *>(gradient)) {
-        pd.gradientType = QGradient::ConicalGradient;
-        pd.gradient.a = QPointF(g->centerX(), g->centerY());
-        pd.gradient.v0 = g->angle();
+        type = QGradient::ConicalGradient;
+        desc.a = QPointF(g->centerX(), g->centerY());
+        desc.v0 = g->angle();
     } else if (gradient != nullptr) {
         static bool warned = false;
         if (!warned) {
@@ -267,11 +286,29 @@ void QQuickShapeCurveRenderer::setFillGradient(int index, QQuickShapeGradient *g
         }
     }
 
-    if (pd.gradientType != QGradient::NoGradient) {
-        pd.gradient.stops = gradient->gradientStops();
-        pd.gradient.spread = QGradient::Spread(gradient->spread());
+    if (type != QGradient::NoGradient) {
+        desc.stops = gradient->gradientStops();
+        desc.spread = QGradient::Spread(gradient->spread());
     }
 
+    setFillGradient(index, type, desc);
+}
+
+/*!
+    \internal
+    Sets the gradient of the path at \a index directly from its description,
+    for callers that do not have a QQuickShapeGradient, such as VectorImage
+    when it displays a precompiled image.
+*/
+void QQuickShapeCurveRenderer::setFillGradient(int index, QGradient::Type type,
+                                               const QSGGradientCache::GradientDesc &gradient)
+{
+    PathData &pd(m_paths[index]);
+    const bool wasVisible = pd.isFillVisible();
+    pd.gradientType = type;
+    if (type != QGradient::NoGradient)
+        pd.gradient = gradient;
+
     pd.m_dirty |= (pd.isFillVisible() != wasVisible) ? FillDirty : UniformsDirty;
 }
 
@@ -315,6 +352,7 @@ void QQuickShapeCurveRenderer::setAsyncCallback(void (*callback)(void *), void *
 void QQuickShapeCurveRenderer::endSync(bool async)
 {
     bool asyncThreadsRunning = false;
+    QVector<QQuickShapeCurveRunnable *> syncRunners;
 
     for (PathData &pathData : m_paths) {
         if (!pathData.m_dirty)
@@ -343,10 +381,12 @@ void QQuickShapeCurveRenderer::endSync(bool async)
         } else
 #endif
         {
-            pathData.currentRunner->run();
+            syncRunners.append(pathData.currentRunner);
         }
     }
 
+    runSynchronously(syncRunners);
+
     if (async && !asyncThreadsRunning && m_asyncCallback)
         m_asyncCallback(m_asyncCallbackData);
 }
@@ -376,6 +416,43 @@ void QQuickShapeCurveRenderer::setUpRunner(PathData *pathData)
     }
 }
 
+/*
+    Processes the paths of \a runners and returns when all of them are done.
+    The paths of a complex shape, such as a vector image, are spread over the
+    threads of the global thread pool that are idle, with the calling thread
+    taking its share, so that the sync is not limited to one core.
+*/
+void QQuickShapeCurveRenderer::runSynchronously(const QVector<QQuickShapeCurveRunnable *> &runners)
+{
+#if QT_CONFIG(thread)
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int helperCount = qMin(pool->maxThreadCount(), int(runners.size())) - 1;
+    if (helperCount > 0) {
+        std::atomic<qsizetype> next = 0;
+        QSemaphore finished;
+        const auto work = [&runners, &next, &finished] {
+            for (qsizetype i = next++; i < runners.size(); i = next++)
+                processPath(&runners.at(i)->pathData);
+            finished.release();
+        };
+
+        // Only take threads that are free right away; the calling thread does
+        // the rest of the work if there are none
+        int startedCount = 0;
+        while (startedCount < helperCount && pool->tryStart(work))
+            ++startedCount;
+        work();
+        finished.acquire(startedCount + 1);
+
+        for (QQuickShapeCurveRunnable *runner : runners)
+            emit runner->done(runner);
+        return;
+    }
+#endif
+    for (QQuickShapeCurveRunnable *runner : runners)
+        runner->run();
+}
+
 void QQuickShapeCurveRenderer::maybeUpdateAsyncItem()
 {
     for (const PathData &pd : std::as_const(m_paths)) {
@@ -55,6 +55,7 @@ public:
     void setStrokeStyle(int index, QQuickShapePath::StrokeStyle strokeStyle,
                         qreal dashOffset, const QVector<qreal> &dashPattern) override;
     void setFillGradient(int index, QQuickShapeGradient *gradient) override;
+    void setFillGradient(int index, QGradient::Type type, const QSGGradientCache::GradientDesc &gradient);
     void setFillTextureProvider(int index, QQuickItem *textureProviderItem) override;
     void setFillTransform(int index, const QSGTransform &transform) override;
     void endSync(bool async) override;
@@ -64,6 +65,8 @@ public:
 
     void updateNode() override;
 
+    void setPreprocessedPath(int index, const QQuadPath &path, const QQuadPath &fillPath);
+
     void setRootNode(QSGNode *node);
     void clearNodeReferences();
 
@@ -123,6 +126,7 @@ private:
     };
 
     void setUpRunner(PathData *pathData);
+    void runSynchronously(const QVector<QQuickShapeCurveRunnable *> &runners);
     void maybeUpdateAsyncItem();
 
     static void processPath(PathData *pathData);
@@ -0,0 +1,281 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickbinarygenerator_p.h"
+
+#include <QtCore/qdir.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qmath.h>
+
+QT_BEGIN_NAMESPACE
+
+static QTransform nodeTransform(const NodeInfo &info)
+{
+    return info.isDefaultTransform ? QTransform() : info.transform;
+}
+
+static QSGGradientCache::GradientDesc gradientDesc(const QGradient &grad)
+{
+    QSGGradientCache::GradientDesc desc;
+    desc.stops = grad.stops();
+    desc.spread = grad.spread();
+    desc.v0 = desc.v1 = 0;
+    switch (grad.type()) {
+    case QGradient::LinearGradient: {
+        const auto &linGrad = static_cast<const QLinearGradient &>(grad);
+        desc.a = linGrad.start();
+        desc.b = linGrad.finalStop();
+        break;
+    }
+    case QGradient::RadialGradient: {
+        const auto &radGrad = static_cast<const QRadialGradient &>(grad);
+        desc.a = radGrad.center();
+        desc.b = radGrad.focalPoint();
+        desc.v0 = radGrad.centerRadius();
+        desc.v1 = radGrad.focalRadius();
+        break;
+    }
+    case QGradient::ConicalGradient: {
+        const auto &conGrad = static_cast<const QConicalGradient &>(grad);
+        desc.a = conGrad.center();
+        desc.v0 = conGrad.angle();
+        break;
+    }
+    default:
+        break;
+    }
+    return desc;
+}
+
+/*!
+    \internal
+    Generates a precompiled vector image, which VectorImage displays with a
+    single item instead of a Shape for each path. The paths are always
+    optimized, as they are stored the way the curve renderer processes them.
+*/
+QQuickBinaryGenerator::QQuickBinaryGenerator(const QString fileName, QQuickVectorImageGenerator::GeneratorFlags flags, const QString &outFileName)
+    : QQuickGenerator(fileName, flags | QQuickVectorImageGenerator::GeneratorFlag::OptimizePaths)
+    , m_outFileName(outFileName)
+{
+    m_states.push(State{});
+}
+
+QQuickBinaryGenerator::~QQuickBinaryGenerator()
+{
+}
+
+bool QQuickBinaryGenerator::save()
+{
+    if (m_outFileName.isEmpty())
+        return true;
+
+    QFileInfo fileInfo(m_outFileName);
+    QDir dir(fileInfo.absolutePath());
+    if (!dir.exists() && !dir.mkpath(QStringLiteral("."))) {
+        qCWarning(lcQuickVectorImage) << "Failed to create path" << dir.absolutePath();
+        return false;
+    }
+
+    QSaveFile outFile(m_outFileName);
+    if (!outFile.open(QIODevice::WriteOnly) || !m_result.write(&outFile) || !outFile.commit()) {
+        qCWarning(lcQuickVectorImage) << "Failed to write to file" << outFile.fileName();
+        return false;
+    }
+
+    qCDebug(lcQuickVectorImage) << "Wrote" << m_result.paths.size() << "paths to" << m_outFileName;
+    return true;
+}
+
+void QQuickBinaryGenerator::pushState(const QTransform &localTransform, const NodeInfo &info)
+{
+    warnIfAnimated(info);
+
+    const State &parent = m_states.top();
+    State state;
+    state.transform = localTransform * parent.transform;
+    state.opacity = parent.opacity * (info.isDefaultOpacity ? 1.0 : info.opacity);
+    m_states.push(state);
+}
+
+void QQuickBinaryGenerator::warnIfAnimated(const NodeInfo &info)
+{
+    if (!info.transformAnimation.animationTypes.isEmpty() || !info.animateColors.isEmpty()) {
+        qCWarning(lcQuickVectorImage) << "Animations are not supported in precompiled images, skipped for node"
+                                      << info.nodeId << "type" << info.typeName;
+    }
+}
+
+void QQuickBinaryGenerator::generateNodeBase(const NodeInfo &info)
+{
+    // Transforms and opacity are applied to the paths when they are output
+    Q_UNUSED(info)
+}
+
+bool QQuickBinaryGenerator::generateDefsNode(const NodeInfo &info)
+{
+    Q_UNUSED(info)
+
+    return false;
+}
+
+void QQuickBinaryGenerator::generateImageNode(const ImageNodeInfo &info)
+{
+    if (!isNodeVisible(info))
+        return;
+
+    qCWarning(lcQuickVectorImage) << "Images are not supported in precompiled images, skipped node"
+                                  << info.nodeId << "type" << info.typeName;
+}
+
+void QQuickBinaryGenerator::generatePath(const PathNodeInfo &info, const QRectF &overrideBoundingRect)
+{
+    if (!isNodeVisible(info))
+        return;
+
+    warnIfAnimated(info);
+
+    const State &parent = m_states.top();
+    const QTransform transform = nodeTransform(info) * parent.transform;
+    const qreal opacity = parent.opacity * (info.isDefaultOpacity ? 1.0 : info.opacity);
+
+    // Apply everything that would be done by the items of the Shape to the path
+    // itself. Opacity of groups is approximated by the opacity of their paths.
+    PathNodeInfo mapped = info;
+    mapped.painterPath = transform.map(info.painterPath);
+    mapped.strokeStyle.width *= qSqrt(qAbs(transform.determinant()));
+    mapped.strokeStyle.color.setAlphaF(info.strokeStyle.color.alphaF() * opacity);
+    mapped.fillColor.setAlphaF(info.fillColor.alphaF() * opacity);
+
+    QTransform fillTransform = info.fillTransform;
+    if (info.grad.type() != QGradient::NoGradient) {
+        if (info.grad.coordinateMode() == QGradient::ObjectMode) {
+            const QRectF boundingRect = overrideBoundingRect.isNull() ? info.painterPath.boundingRect()
+                                                                      : overrideBoundingRect;
+            QTransform objectToUserSpace;
+            objectToUserSpace.translate(boundingRect.x(), boundingRect.y());
+            objectToUserSpace.scale(boundingRect.width(), boundingRect.height());
+            fillTransform *= objectToUserSpace;
+            mapped.grad.setCoordinateMode(QGradient::LogicalMode);
+        }
+
+        QGradientStops stops = info.grad.stops();
+        for (QGradientStop &stop : stops)
+            stop.second.setAlphaF(stop.second.alphaF() * opacity);
+        mapped.grad.setStops(stops);
+    }
+    mapped.fillTransform = fillTransform * transform;
+
+    optimizePaths(mapped, overrideBoundingRect.isNull() ? QRectF{} : transform.mapRect(overrideBoundingRect));
+}
+
+void QQuickBinaryGenerator::outputShapePath(const PathNodeInfo &info, const QPainterPath *path, const QQuadPath *quadPath, QQuickVectorImageGenerator::PathSelector pathSelector, const QRectF &boundingRect)
+{
+    Q_UNUSED(path)
+    Q_UNUSED(boundingRect)
+    Q_ASSERT(quadPath);
+
+    QQuickVectorImageBinary::Path result;
+    if (pathSelector & QQuickVectorImageGenerator::FillPath) {
+        if (info.grad.type() != QGradient::NoGradient) {
+            result.gradientType = info.grad.type();
+            result.gradient = gradientDesc(info.grad);
+        } else {
+            result.fillColor = info.fillColor;
+        }
+        result.fillTransform = info.fillTransform;
+    }
+
+    if (pathSelector & QQuickVectorImageGenerator::StrokePath) {
+        const StrokeStyle &style = info.strokeStyle;
+        QPen pen(style.color, style.width, Qt::SolidLine, style.lineCapStyle, style.lineJoinStyle);
+        pen.setMiterLimit(style.miterLimit);
+        if (!style.dashArray.isEmpty()) {
+            pen.setDashPattern(style.dashArray);
+            pen.setDashOffset(style.dashOffset);
+        }
+        result.pen = pen;
+    }
+
+    if (!result.isFilled() && !result.isStroked())
+        return;
+
+    result.path = *quadPath;
+    m_result.paths.append(result);
+}
+
+void QQuickBinaryGenerator::generateNode(const NodeInfo &info)
+{
+    if (!isNodeVisible(info))
+        return;
+
+    qCWarning(lcQuickVectorImage) << "SVG NODE NOT IMPLEMENTED: "
+                                  << info.nodeId
+                                  << " type: " << info.typeName;
+}
+
+void QQuickBinaryGenerator::generateTextNode(const TextNodeInfo &info)
+{
+    if (!isNodeVisible(info))
+        return;
+
+    qCWarning(lcQuickVectorImage) << "Text is not supported in precompiled images, skipped node"
+                                  << info.nodeId << "type" << info.typeName;
+}
+
+void QQuickBinaryGenerator::generateUseNode(const UseNodeInfo &info)
+{
+    if (!isNodeVisible(info))
+        return;
+
+    if (info.stage == StructureNodeStage::Start)
+        pushState(nodeTransform(info) * QTransform::fromTranslate(info.startPos.x(), info.startPos.y()), info);
+    else
+        m_states.pop();
+}
+
+bool QQuickBinaryGenerator::generateStructureNode(const StructureNodeInfo &info)
+{
+    if (!isNodeVisible(info))
+        return false;
+
+    if (info.stage == StructureNodeStage::Start) {
+        // Like the ViewBoxItem of QQuickItemGenerator, which has no size here
+        QTransform viewBoxTransform;
+        if (!info.viewBox.isEmpty())
+            viewBoxTransform = QTransform::fromTranslate(-info.viewBox.x(), -info.viewBox.y());
+        pushState(viewBoxTransform * nodeTransform(info), info);
+    } else {
+        m_states.pop();
+    }
+
+    return true;
+}
+
+bool QQuickBinaryGenerator::generateRootNode(const StructureNodeInfo &info)
+{
+    if (info.stage == StructureNodeStage::Start || !isNodeVisible(info))
+        m_result.size = QSizeF(qMax(info.size.width(), 0), qMax(info.size.height(), 0));
+
+    if (!isNodeVisible(info))
+        return false;
+
+    if (info.stage == StructureNodeStage::Start) {
+        QTransform viewBoxTransform;
+        if (!info.viewBox.isEmpty()) {
+            viewBoxTransform = QTransform::fromTranslate(-info.viewBox.x(), -info.viewBox.y());
+            if (!m_result.size.isEmpty()) {
+                viewBoxTransform *= QTransform::fromScale(m_result.size.width() / info.viewBox.width(),
+                                                          m_result.size.height() / info.viewBox.height());
+            }
+        }
+        pushState(viewBoxTransform * nodeTransform(info), info);
+    } else {
+        m_states.pop();
+    }
+
+    return true;
+}
+
+QT_END_NAMESPACE
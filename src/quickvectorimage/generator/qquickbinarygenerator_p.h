@@ -0,0 +1,65 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKBINARYGENERATOR_P_H
+#define QQUICKBINARYGENERATOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qquickgenerator_p.h"
+#include "qquicknodeinfo_p.h"
+#include "qquickvectorimagebinary_p.h"
+
+#include <QStack>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICKVECTORIMAGEGENERATOR_EXPORT QQuickBinaryGenerator : public QQuickGenerator
+{
+public:
+    QQuickBinaryGenerator(const QString fileName, QQuickVectorImageGenerator::GeneratorFlags flags, const QString &outFileName);
+    ~QQuickBinaryGenerator();
+
+    bool save();
+
+    const QQuickVectorImageBinary &result() const { return m_result; }
+
+protected:
+    void generateNodeBase(const NodeInfo &info) override;
+    bool generateDefsNode(const NodeInfo &info) override;
+    void generateImageNode(const ImageNodeInfo &info) override;
+    void generatePath(const PathNodeInfo &info, const QRectF &overrideBoundingRect) override;
+    void generateNode(const NodeInfo &info) override;
+    void generateTextNode(const TextNodeInfo &info) override;
+    void generateUseNode(const UseNodeInfo &info) override;
+    bool generateStructureNode(const StructureNodeInfo &info) override;
+    bool generateRootNode(const StructureNodeInfo &info) override;
+    void outputShapePath(const PathNodeInfo &info, const QPainterPath *path, const QQuadPath *quadPath, QQuickVectorImageGenerator::PathSelector pathSelector, const QRectF &boundingRect) override;
+
+private:
+    struct State
+    {
+        QTransform transform; // to the coordinates of the image
+        qreal opacity = 1.0;
+    };
+
+    void pushState(const QTransform &localTransform, const NodeInfo &info);
+    void warnIfAnimated(const NodeInfo &info);
+
+    QStack<State> m_states;
+    QQuickVectorImageBinary m_result;
+    QString m_outFileName;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKBINARYGENERATOR_P_H
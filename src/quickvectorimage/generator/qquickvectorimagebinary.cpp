@@ -0,0 +1,96 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickvectorimagebinary_p.h"
+#include "qquickgenerator_p.h"
+
+#include <QtCore/qdatastream.h>
+#include <QtCore/qiodevice.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr char fileMagic[4] = { 'Q', 'V', 'I', 'M' };
+constexpr quint32 fileVersion = 1;
+constexpr QDataStream::Version streamVersion = QDataStream::Qt_6_8;
+
+}
+
+/*!
+    Reads the image from \a device, and returns \c false if it is not a
+    precompiled vector image of a version this build understands.
+*/
+bool QQuickVectorImageBinary::read(QIODevice *device)
+{
+    char magic[4];
+    if (device->read(magic, sizeof(magic)) != qint64(sizeof(magic))
+            || memcmp(magic, fileMagic, sizeof(fileMagic)) != 0) {
+        qCWarning(lcQuickVectorImage) << "Not a precompiled vector image";
+        return false;
+    }
+
+    QDataStream stream(device);
+    stream.setVersion(streamVersion);
+
+    quint32 version;
+    stream >> version;
+    if (version != fileVersion) {
+        qCWarning(lcQuickVectorImage) << "Unsupported precompiled vector image version" << version;
+        return false;
+    }
+
+    quint32 pathCount;
+    stream >> size >> pathCount;
+    paths.clear();
+    for (quint32 i = 0; i < pathCount && stream.status() == QDataStream::Ok; ++i) {
+        Path path;
+        qint32 gradientType;
+        stream >> path.path >> path.fillColor >> gradientType;
+        if (gradientType < QGradient::LinearGradient || gradientType > QGradient::NoGradient) {
+            stream.setStatus(QDataStream::ReadCorruptData);
+            break;
+        }
+        path.gradientType = QGradient::Type(gradientType);
+        if (path.gradientType != QGradient::NoGradient) {
+            qint32 spread;
+            stream >> path.gradient.stops >> spread >> path.gradient.a >> path.gradient.b
+                   >> path.gradient.v0 >> path.gradient.v1;
+            if (spread < QGradient::PadSpread || spread > QGradient::RepeatSpread) {
+                stream.setStatus(QDataStream::ReadCorruptData);
+                break;
+            }
+            path.gradient.spread = QGradient::Spread(spread);
+        }
+        stream >> path.fillTransform >> path.pen;
+        paths.append(path);
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        qCWarning(lcQuickVectorImage) << "Truncated or corrupt precompiled vector image";
+        paths.clear();
+        return false;
+    }
+    return true;
+}
+
+bool QQuickVectorImageBinary::write(QIODevice *device) const
+{
+    if (device->write(fileMagic, sizeof(fileMagic)) != qint64(sizeof(fileMagic)))
+        return false;
+
+    QDataStream stream(device);
+    stream.setVersion(streamVersion);
+    stream << fileVersion << size << quint32(paths.size());
+    for (const Path &path : paths) {
+        stream << path.path << path.fillColor << qint32(path.gradientType);
+        if (path.gradientType != QGradient::NoGradient) {
+            stream << path.gradient.stops << qint32(path.gradient.spread) << path.gradient.a
+                   << path.gradient.b << path.gradient.v0 << path.gradient.v1;
+        }
+        stream << path.fillTransform << path.pen;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKVECTORIMAGEBINARY_P_H
+#define QQUICKVECTORIMAGEBINARY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qquickvectorimageglobal_p.h>
+#include <private/qquadpath_p.h>
+#include <private/qsggradientcache_p.h>
+
+#include <QtCore/qlist.h>
+#include <QtCore/qsize.h>
+#include <QtGui/qcolor.h>
+#include <QtGui/qpen.h>
+#include <QtGui/qtransform.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+/*! \internal
+    A vector image that was precompiled at build time, so that it can be
+    displayed without parsing the SVG or creating a Shape and ShapePath for
+    each of its paths.
+
+    All transforms of the image are applied to the paths, which are stored
+    in paint order and in the coordinates of an image of the given size,
+    after they were processed for the curve renderer. Each path is filled,
+    stroked, or both.
+*/
+class Q_QUICKVECTORIMAGEGENERATOR_EXPORT QQuickVectorImageBinary
+{
+public:
+    struct Path
+    {
+        bool isFilled() const
+        {
+            return gradientType != QGradient::NoGradient || fillColor.alpha() > 0;
+        }
+
+        bool isStroked() const
+        {
+            return pen.style() != Qt::NoPen && pen.color().alpha() > 0 && pen.widthF() > 0;
+        }
+
+        QQuadPath path;
+        QColor fillColor = QColorConstants::Transparent;
+        QGradient::Type gradientType = QGradient::NoGradient;
+        QSGGradientCache::GradientDesc gradient;
+        QTransform fillTransform;
+        QPen pen = QPen(Qt::NoPen);
+    };
+
+    QSizeF size;
+    QList<Path> paths;
+
+    bool read(QIODevice *device);
+    bool write(QIODevice *device) const;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKVECTORIMAGEBINARY_P_H
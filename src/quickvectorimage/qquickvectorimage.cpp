@@ -6,9 +6,12 @@
 #include "qquickvectorimage_p_p.h"
 #include <QtQuickVectorImageGenerator/private/qquickitemgenerator_p.h>
 #include <QtQuickVectorImageGenerator/private/qquickvectorimageglobal_p.h>
+#include <QtQuickShapes/private/qquickshapecurverenderer_p.h>
+#include <QtCore/qfile.h>
 #include <QtCore/qloggingcategory.h>
 
 #include <private/qquicktranslate_p.h>
+#include <private/qsgtransform_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -59,21 +62,29 @@ void QQuickVectorImagePrivate::loadSvg()
 
     QQuickVectorImagePrivate::Format fileFormat = formatFromFilePath(localFile);
 
-    if (fileFormat != QQuickVectorImagePrivate::Format::Svg) {
+    if (fileFormat == QQuickVectorImagePrivate::Format::Unknown) {
         qCWarning(lcQuickVectorImage) << "Unsupported file format";
         return;
     }
 
-    if (svgItem)
+    if (svgItem) {
         svgItem->deleteLater();
+        svgItem = nullptr;
+    }
 
-    svgItem = new QQuickItem(q);
+    if (fileFormat == QQuickVectorImagePrivate::Format::Binary) {
+        svgItem = loadBinary(localFile);
+        if (!svgItem)
+            return;
+    } else {
+        svgItem = new QQuickItem(q);
 
-    QQuickVectorImageGenerator::GeneratorFlags flags;
-    if (preferredRendererType == QQuickVectorImage::CurveRenderer)
-        flags.setFlag(QQuickVectorImageGenerator::CurveRenderer);
-    QQuickItemGenerator generator(localFile, flags, svgItem);
-    generator.generate();
+        QQuickVectorImageGenerator::GeneratorFlags flags;
+        if (preferredRendererType == QQuickVectorImage::CurveRenderer)
+            flags.setFlag(QQuickVectorImageGenerator::CurveRenderer);
+        QQuickItemGenerator generator(localFile, flags, svgItem);
+        generator.generate();
+    }
 
     svgItem->setParentItem(q);
     q->setImplicitWidth(svgItem->width());
@@ -93,11 +104,108 @@ QQuickVectorImagePrivate::Format QQuickVectorImagePrivate::formatFromFilePath(co
     if (filePath.endsWith(QLatin1String(".svg")) || filePath.endsWith(QLatin1String(".svgz"))
         || filePath.endsWith(QLatin1String(".svg.gz"))) {
         res = QQuickVectorImagePrivate::Format::Svg;
+    } else if (filePath.endsWith(QLatin1String(".qvi"))) {
+        res = QQuickVectorImagePrivate::Format::Binary;
     }
 
     return res;
 }
 
+QQuickItem *QQuickVectorImagePrivate::loadBinary(const QString &filePath)
+{
+    Q_Q(QQuickVectorImage);
+
+    QFile file(filePath);
+    QQuickVectorImageBinary image;
+    if (!file.open(QIODevice::ReadOnly) || !image.read(&file)) {
+        qCWarning(lcQuickVectorImage) << "Failed to load precompiled vector image" << filePath;
+        return nullptr;
+    }
+
+    auto *item = new QQuickVectorImageBinaryItem(image.paths, q);
+    item->setSize(image.size);
+    return item;
+}
+
+QQuickVectorImageBinaryItem::QQuickVectorImageBinaryItem(const QList<QQuickVectorImageBinary::Path> &paths,
+                                                         QQuickItem *parent)
+    : QQuickItem(parent)
+    , m_paths(paths)
+    , m_renderer(std::make_unique<QQuickShapeCurveRenderer>(this))
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    polish();
+}
+
+QQuickVectorImageBinaryItem::~QQuickVectorImageBinaryItem() = default;
+
+void QQuickVectorImageBinaryItem::itemChange(ItemChange change, const ItemChangeData &data)
+{
+    if (change == QQuickItem::ItemSceneChange) {
+        // The nodes are recreated for the new window
+        m_pathsSynced = false;
+        if (data.window)
+            polish();
+    }
+
+    QQuickItem::itemChange(change, data);
+}
+
+void QQuickVectorImageBinaryItem::updatePolish()
+{
+    if (m_pathsSynced)
+        return;
+
+    bool countChanged = false;
+    m_renderer->beginSync(m_paths.size(), &countChanged);
+    for (int i = 0; i < m_paths.size(); ++i) {
+        const QQuickVectorImageBinary::Path &path = m_paths.at(i);
+        m_renderer->setPreprocessedPath(i, path.path, path.isFilled() ? path.path : QQuadPath());
+        m_renderer->setFillColor(i, path.fillColor);
+        m_renderer->setFillGradient(i, path.gradientType, path.gradient);
+        QSGTransform fillTransform;
+        fillTransform.setMatrix(QMatrix4x4(path.fillTransform));
+        m_renderer->setFillTransform(i, fillTransform);
+
+        if (path.isStroked()) {
+            const QPen &pen = path.pen;
+            m_renderer->setStrokeColor(i, pen.color());
+            m_renderer->setStrokeWidth(i, pen.widthF());
+            m_renderer->setJoinStyle(i, QQuickShapePath::JoinStyle(pen.joinStyle()), pen.miterLimit());
+            m_renderer->setCapStyle(i, QQuickShapePath::CapStyle(pen.capStyle()));
+            m_renderer->setStrokeStyle(i, pen.style() == Qt::SolidLine ? QQuickShapePath::SolidLine
+                                                                       : QQuickShapePath::DashLine,
+                                       pen.dashOffset(), pen.dashPattern());
+        } else {
+            m_renderer->setStrokeColor(i, Qt::transparent);
+        }
+    }
+    m_renderer->endSync(false);
+
+    m_pathsSynced = true;
+    update();
+}
+
+QSGNode *QQuickVectorImageBinaryItem::updatePaintNode(QSGNode *node, UpdatePaintNodeData *)
+{
+    if (!node) {
+        QSGRendererInterface *ri = window()->rendererInterface();
+        if (!ri || !QSGRendererInterface::isApiRhiBased(ri->graphicsApi())) {
+            static bool warned = false;
+            if (!warned) {
+                warned = true;
+                qCWarning(lcQuickVectorImage) << "Precompiled vector images need a hardware accelerated backend";
+            }
+            return nullptr;
+        }
+        node = new QSGNode;
+        m_renderer->setRootNode(node);
+    }
+
+    m_renderer->updateNode();
+    return node;
+}
+
 /*!
     \qmltype VectorImage
     \inqmlmodule QtQuick.VectorImage
@@ -129,7 +237,10 @@ QQuickVectorImage::QQuickVectorImage(QQuickItem *parent)
 
     This property holds the URL of the vector image file to load.
 
-    VectorImage currently only supports the \c SVG file format.
+    VectorImage currently only supports the \c SVG file format, and precompiled vector images
+    (with the \c{.qvi} suffix) that were generated from \c SVG files at build time by the
+    \l{svgtoqml} tool. Precompiled images are always displayed with the curve renderer, and
+    do not create a \l Shape for each of their paths.
 */
 QUrl QQuickVectorImage::source() const
 {
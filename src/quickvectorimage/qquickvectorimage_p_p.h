@@ -18,8 +18,11 @@
 #include <QQuickPaintedItem>
 #include <QSvgRenderer>
 #include <private/qquickitem_p.h>
+#include <QtQuickVectorImageGenerator/private/qquickvectorimagebinary_p.h>
 #include "qquickvectorimage_p.h"
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 class QQuickVectorImagePrivate : public QQuickItemPrivate
@@ -31,10 +34,12 @@ public:
 
     void setSource(const QUrl &source);
     void loadSvg();
+    QQuickItem *loadBinary(const QString &filePath);
 
     enum Format {
         Unknown,
-        Svg
+        Svg,
+        Binary
     };
     QQuickVectorImagePrivate::Format formatFromFilePath(const QString &filePath);
 
@@ -44,6 +49,29 @@ public:
     QQuickVectorImage::RendererType preferredRendererType = QQuickVectorImage::GeometryRenderer;
 };
 
+class QQuickShapeCurveRenderer;
+
+/*
+    Displays a precompiled vector image with one curve renderer, so that the
+    image does not need a Shape and ShapePath for each of its paths.
+*/
+class QQuickVectorImageBinaryItem : public QQuickItem
+{
+public:
+    QQuickVectorImageBinaryItem(const QList<QQuickVectorImageBinary::Path> &paths, QQuickItem *parent = nullptr);
+    ~QQuickVectorImageBinaryItem() override;
+
+protected:
+    void itemChange(ItemChange change, const ItemChangeData &data) override;
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *) override;
+
+private:
+    QList<QQuickVectorImageBinary::Path> m_paths;
+    std::unique_ptr<QQuickShapeCurveRenderer> m_renderer;
+    bool m_pathsSynced = false;
+};
+
 QT_END_NAMESPACE
 
 #endif // QQUICKVECTORIMAGE_P_P_H
@@ -0,0 +1,58 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qstringlist.h>
+
+static QByteArray readResource(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+    return file.readAll();
+}
+
+int main()
+{
+    const QString prefix = QStringLiteral(":/qt/qml/CompressedTextures/images/");
+
+    const QStringList expected = {
+        QStringLiteral("image.png"),
+        QStringLiteral("image.png.astc.ktx"),
+        QStringLiteral("image.png.etc2.ktx"),
+        QStringLiteral("skipped.png"),
+    };
+    for (const QString &name : expected) {
+        if (!QFile::exists(prefix + name)) {
+            qWarning() << "Missing resource" << prefix + name;
+            return 1;
+        }
+    }
+
+    // No compressor is set for bc, and skipped.png is excluded from compression
+    const QStringList unexpected = {
+        QStringLiteral("image.png.bc.ktx"),
+        QStringLiteral("skipped.png.astc.ktx"),
+        QStringLiteral("skipped.png.etc2.ktx"),
+    };
+    for (const QString &name : unexpected) {
+        if (QFile::exists(prefix + name)) {
+            qWarning() << "Unexpected resource" << prefix + name;
+            return 1;
+        }
+    }
+
+    // The variants are the output of the compressors for the image
+    const QByteArray image = readResource(prefix + QStringLiteral("image.png"));
+    if (image.isEmpty() || readResource(prefix + QStringLiteral("image.png.astc.ktx")) != image) {
+        qWarning() << "The astc variant was not generated from image.png";
+        return 1;
+    }
+    if (readResource(prefix + QStringLiteral("image.png.etc2.ktx")) != image) {
+        qWarning() << "The etc2 variant was not generated from image.png";
+        return 1;
+    }
+
+    return 0;
+}
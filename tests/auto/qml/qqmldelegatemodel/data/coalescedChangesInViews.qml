@@ -0,0 +1,53 @@
+import QtQuick
+
+Item {
+    width: 300
+    height: 200
+
+    property alias listView: listView
+    property alias repeater: repeater
+    property alias items: items
+
+    function insertFront(name) {
+        items.insert(0, { name: name })
+    }
+
+    ListModel {
+        id: items
+        Component.onCompleted: {
+            for (let i = 0; i < 50; ++i)
+                append({ name: "item" + i })
+        }
+    }
+
+    ListView {
+        id: listView
+        width: 100
+        height: 200
+        model: items
+        delegate: Text {
+            required property int index
+            required property string name
+            height: 20
+            text: name
+        }
+    }
+
+    Item {
+        id: otherParent
+        objectName: "otherParent"
+        x: 100
+    }
+
+    Column {
+        x: 200
+        Repeater {
+            id: repeater
+            model: items
+            delegate: Text {
+                required property string name
+                text: name
+            }
+        }
+    }
+}
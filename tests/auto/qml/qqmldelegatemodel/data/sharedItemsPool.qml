@@ -0,0 +1,58 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+import QtQml.Models
+
+Window {
+    id: root
+    width: 200
+    height: 200
+
+    property int page: 0
+    property int createdCount: 0
+
+    Component {
+        id: sharedDelegate
+        Rectangle {
+            property int delegateIndex: index
+            width: 200
+            height: 20
+            color: modelData
+            Component.onCompleted: ++root.createdCount
+        }
+    }
+
+    Component {
+        id: firstPage
+        ListView {
+            objectName: "first"
+            reuseItems: true
+            currentIndex: -1
+            model: ["red", "green", "blue", "yellow"]
+            delegate: sharedDelegate
+        }
+    }
+
+    Component {
+        id: secondPage
+        ListView {
+            objectName: "second"
+            reuseItems: true
+            currentIndex: -1
+            model: ["black", "white", "gray", "orange", "cyan"]
+            delegate: sharedDelegate
+        }
+    }
+
+    // Never shows anything, only drains the pools
+    DelegateModel {
+        objectName: "drainer"
+        delegate: sharedDelegate
+    }
+
+    Loader {
+        anchors.fill: parent
+        sourceComponent: root.page === 0 ? firstPage : root.page === 1 ? secondPage : null
+    }
+}
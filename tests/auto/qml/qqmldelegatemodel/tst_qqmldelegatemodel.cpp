@@ -3,6 +3,7 @@
 
 #include <QtTest/qtest.h>
 #include <QtCore/qjsonobject.h>
+#include <QtCore/qscopeguard.h>
 #include <QtCore/qsortfilterproxymodel.h>
 #include <QtCore/QConcatenateTablesProxyModel>
 #include <QtCore/qtimer.h>
@@ -57,6 +58,9 @@ private slots:
     void viewUpdatedOnDelegateChoiceAffectingRoleChange();
     void proxyModelWithDelayedSourceModelInListView();
     void delegateChooser();
+    void sharedItemsPool();
+    void coalescedChanges();
+    void coalescedChangesInViews();
 };
 
 class BaseAbstractItemModel : public QAbstractItemModel
@@ -886,6 +890,168 @@ void tst_QQmlDelegateModel::delegateChooser()
     }
 }
 
+void tst_QQmlDelegateModel::sharedItemsPool()
+{
+    qputenv("QML_SHARED_DELEGATE_POOL_SIZE", "16");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QML_SHARED_DELEGATE_POOL_SIZE"); });
+
+    QQuickApplicationHelper helper(this, "sharedItemsPool.qml");
+    QVERIFY2(helper.ready, helper.failureMessage());
+
+    QQuickWindow *window = helper.window;
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QQuickListView *first = window->findChild<QQuickListView *>("first");
+    QVERIFY(first);
+    QTRY_COMPARE(window->property("createdCount").toInt(), 4);
+
+    // Unloading the first view moves its delegates to the shared pool
+    window->setProperty("page", -1);
+    QTRY_VERIFY(!window->findChild<QQuickListView *>("first"));
+    QQmlSharedDelegateItemsPool *sharedPool = QQmlSharedDelegateItemsPool::get(helper.engine.handle());
+    QVERIFY(sharedPool);
+    QCOMPARE(sharedPool->size(), 4);
+
+    // The second view adopts them, and only creates the delegate it is missing
+    window->setProperty("page", 1);
+    QQuickListView *second = nullptr;
+    QTRY_VERIFY((second = window->findChild<QQuickListView *>("second")));
+    QTRY_COMPARE(second->count(), 5);
+    QVERIFY(QQuickTest::qWaitForPolish(second));
+    QCOMPARE(window->property("createdCount").toInt(), 5);
+    QCOMPARE(sharedPool->size(), 0);
+
+    const QStringList colors = { "black", "white", "gray", "orange", "cyan" };
+    for (int i = 0; i < colors.size(); ++i) {
+        QQuickRectangle *rectangle = qobject_cast<QQuickRectangle *>(findViewDelegateItem(second, i));
+        QVERIFY(rectangle);
+        QCOMPARE(rectangle->property("delegateIndex").toInt(), i);
+        QCOMPARE(rectangle->color(), QColor::fromString(colors.at(i)));
+        QCOMPARE(rectangle->parentItem(), second->contentItem());
+        auto *attached = qobject_cast<QQuickListViewAttached *>(
+                qmlAttachedPropertiesObject<QQuickListView>(rectangle, false));
+        QVERIFY(attached);
+        QCOMPARE(attached->view(), second);
+    }
+
+    // Objects nobody adopts age out with the loading cycles of any model
+    window->setProperty("page", -1);
+    QTRY_VERIFY(!window->findChild<QQuickListView *>("second"));
+    QCOMPARE(sharedPool->size(), 5);
+    auto *drainer = window->findChild<QQmlDelegateModel *>("drainer");
+    QVERIFY(drainer);
+    // Only empties the pool of the model itself
+    drainer->drainReusableItemsPool(0);
+    QCOMPARE(sharedPool->size(), 5);
+    drainer->drainReusableItemsPool(1);
+    QCOMPARE(sharedPool->size(), 5);
+    drainer->drainReusableItemsPool(1);
+    QCOMPARE(sharedPool->size(), 0);
+}
+
+void tst_QQmlDelegateModel::coalescedChanges()
+{
+    qputenv("QML_DELEGATEMODEL_COALESCE_CHANGES", "1");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QML_DELEGATEMODEL_COALESCE_CHANGES"); });
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQml.Models\nDelegateModel { delegate: QtObject {} }", QUrl());
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+    auto *delegateModel = qobject_cast<QQmlDelegateModel *>(root.get());
+    QVERIFY(delegateModel);
+
+    QStandardItemModel model;
+    delegateModel->setModel(QVariant::fromValue<QObject *>(&model));
+
+    QList<QQmlChangeSet> changeSets;
+    connect(delegateModel, &QQmlInstanceModel::modelUpdated, this,
+            [&](const QQmlChangeSet &changeSet, bool) { changeSets.append(changeSet); });
+
+    // The model is updated right away, but the changes are delivered later, together
+    for (int i = 0; i < 100; ++i)
+        model.appendRow(new QStandardItem(QString::number(i)));
+    model.item(10)->setText(QStringLiteral("changed"));
+    model.removeRows(50, 10);
+    QCOMPARE(delegateModel->count(), 90);
+    QVERIFY(changeSets.isEmpty());
+
+    QTRY_COMPARE(changeSets.size(), 1);
+    QCOMPARE(changeSets.first().inserts().size(), 1);
+    QCOMPARE(changeSets.first().inserts().first().count, 90);
+    QVERIFY(changeSets.first().removes().isEmpty());
+    QCOMPARE(delegateModel->coalescedSignalCount(), 102);
+    QCOMPARE(delegateModel->coalescedDeliveryCount(), 1);
+
+    // Views can ask for the pending changes before they lay out
+    model.removeRows(0, 5);
+    QCOMPARE(changeSets.size(), 1);
+    delegateModel->deliverCoalescedChanges();
+    QCOMPARE(changeSets.size(), 2);
+    QCOMPARE(changeSets.last().removes().size(), 1);
+    QCOMPARE(changeSets.last().removes().first().count, 5);
+
+    // Nothing is left for the queued delivery
+    QTest::qWait(0);
+    QCOMPARE(changeSets.size(), 2);
+    QCOMPARE(delegateModel->coalescedDeliveryCount(), 2);
+}
+
+void tst_QQmlDelegateModel::coalescedChangesInViews()
+{
+    qputenv("QML_DELEGATEMODEL_COALESCE_CHANGES", "1");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QML_DELEGATEMODEL_COALESCE_CHANGES"); });
+
+    QQuickView view(testFileUrl("coalescedChangesInViews.qml"));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QQuickItem *root = view.rootObject();
+    auto *listView = root->property("listView").value<QQuickListView *>();
+    QVERIFY(listView);
+    auto *repeater = root->property("repeater").value<QQuickItem *>();
+    QVERIFY(repeater);
+    auto *items = root->property("items").value<QQmlListModel *>();
+    QVERIFY(items);
+    QTRY_COMPARE(repeater->property("count").toInt(), 50);
+
+    // Each view requests delegates while the model still holds the insertion back
+    QVERIFY(QMetaObject::invokeMethod(root, "insertFront", Q_ARG(QVariant, QStringLiteral("first"))));
+    listView->setContentY(30);
+    QVERIFY(QMetaObject::invokeMethod(root, "insertFront", Q_ARG(QVariant, QStringLiteral("second"))));
+    listView->setCacheBuffer(100);
+    QVERIFY(QMetaObject::invokeMethod(root, "insertFront", Q_ARG(QVariant, QStringLiteral("third"))));
+    repeater->setParentItem(root->findChild<QQuickItem *>("otherParent"));
+
+    QTRY_COMPARE(repeater->property("count").toInt(), 53);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QCOMPARE(listView->count(), 53);
+
+    const auto nameAt = [items](int index) {
+        return items->data(index, items->roleNames().key("name")).toString();
+    };
+
+    for (int i = 0; i < 53; ++i) {
+        QQuickItem *item = nullptr;
+        QVERIFY(QMetaObject::invokeMethod(repeater, "itemAt", Q_RETURN_ARG(QQuickItem *, item), Q_ARG(int, i)));
+        QVERIFY(item);
+        QCOMPARE(item->property("text").toString(), nameAt(i));
+    }
+
+    QSet<int> indexes;
+    for (QQuickItem *item : listView->contentItem()->childItems()) {
+        if (!item->isVisible() || !item->property("index").isValid())
+            continue;
+        const int index = item->property("index").toInt();
+        QVERIFY2(!indexes.contains(index), qPrintable(QString::number(index)));
+        indexes.insert(index);
+        QCOMPARE(item->property("text").toString(), nameAt(index));
+    }
+    QVERIFY(!indexes.isEmpty());
+}
+
 QTEST_MAIN(tst_QQmlDelegateModel)
 
 #include "tst_qqmldelegatemodel.moc"
@@ -123,6 +123,11 @@ private slots:
     void protectQObjectFromGC();
     void nestedLists();
     void deadModelData();
+    void appendColumns_data();
+    void appendColumns();
+    void reuseColumnSlots();
+    void appendFromJson_data();
+    void appendFromJson();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -2128,6 +2133,191 @@ void tst_qqmllistmodel::deadModelData()
     }
 }
 
+void tst_qqmllistmodel::appendColumns_data()
+{
+    QTest::addColumn<bool>("dynamicRoles");
+
+    QTest::newRow("static roles") << false;
+    QTest::newRow("dynamic roles") << true;
+}
+
+void tst_qqmllistmodel::appendColumns()
+{
+    QFETCH(bool, dynamicRoles);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QStringLiteral(R"(
+            import QtQml.Models
+            ListModel {
+                dynamicRoles: %1
+                Component.onCompleted: append({ x: 10, y: 20, name: "first", selected: false })
+            })").arg(dynamicRoles).toUtf8(), QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(object.data());
+    QVERIFY(model);
+
+    QSignalSpy spy(model, &QQmlListModel::rowsInserted);
+    QQmlExpression expr(engine.rootContext(), model, QStringLiteral(R"(
+            appendColumns({
+                x: new Float32Array([1.5, 2.5, 3.5]),
+                y: new Int16Array([-1, -2, -3]),
+                name: ["a", "b", "c"],
+                selected: [true, false, true]
+            }))"));
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), qPrintable(expr.error().toString()));
+
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).toInt(), 1);
+    QCOMPARE(spy.at(0).at(2).toInt(), 3);
+    QCOMPARE(model->count(), 4);
+
+    const double xs[] = { 10, 1.5, 2.5, 3.5 };
+    const double ys[] = { 20, -1, -2, -3 };
+    const QString names[] = { "first", "a", "b", "c" };
+    const bool selected[] = { false, true, false, true };
+    for (int i = 0; i < 4; ++i) {
+        QObject *item = qjsvalue_cast<QObject *>(model->get(i));
+        QVERIFY(item);
+        QCOMPARE(item->property("x").toDouble(), xs[i]);
+        QCOMPARE(item->property("y").toDouble(), ys[i]);
+        QCOMPARE(item->property("name").toString(), names[i]);
+        QCOMPARE(item->property("selected").toBool(), selected[i]);
+    }
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*appendColumns: arrays have different lengths"));
+    QQmlExpression mismatch(engine.rootContext(), model,
+                            QStringLiteral("appendColumns({ x: [1, 2], y: new Float64Array(3) })"));
+    mismatch.evaluate();
+    QCOMPARE(model->count(), 4);
+    QCOMPARE(spy.size(), 1);
+
+    if (!dynamicRoles) {
+        // A typed array can't be written to a role of another type
+        QTest::ignoreMessage(QtWarningMsg,
+                             QRegularExpression(".*Can't assign to existing role 'name' of different type \\[Number -> String\\]"));
+        QQmlExpression typeMismatch(engine.rootContext(), model,
+                                    QStringLiteral("appendColumns({ name: new Float64Array([1]) })"));
+        typeMismatch.evaluate();
+        QCOMPARE(model->count(), 5);
+        QObject *item = qjsvalue_cast<QObject *>(model->get(4));
+        QVERIFY(item);
+        QVERIFY(item->property("name").toString().isEmpty());
+    }
+}
+
+void tst_qqmllistmodel::reuseColumnSlots()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(R"(
+            import QtQml.Models
+            ListModel {
+                ListElement { value: 1; flag: true; name: "a" }
+                ListElement { value: 2; flag: true; name: "b" }
+                ListElement { value: 3; flag: true; name: "c" }
+            })", QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(object.data());
+    QVERIFY(model);
+
+    QQmlExpression expr(engine.rootContext(), model, QStringLiteral(R"(
+            remove(0, 2);
+            append({ name: "d" });
+            move(0, 1, 1);)"));
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), qPrintable(expr.error().toString()));
+    QCOMPARE(model->count(), 2);
+
+    // The new element must not see the values of the removed ones
+    QObject *added = qjsvalue_cast<QObject *>(model->get(0));
+    QVERIFY(added);
+    QCOMPARE(added->property("name").toString(), QStringLiteral("d"));
+    QCOMPARE(added->property("value").toDouble(), 0.0);
+    QCOMPARE(added->property("flag").toBool(), false);
+
+    QObject *kept = qjsvalue_cast<QObject *>(model->get(1));
+    QVERIFY(kept);
+    QCOMPARE(kept->property("name").toString(), QStringLiteral("c"));
+    QCOMPARE(kept->property("value").toDouble(), 3.0);
+    QCOMPARE(kept->property("flag").toBool(), true);
+}
+
+void tst_qqmllistmodel::appendFromJson_data()
+{
+    appendColumns_data();
+}
+
+void tst_qqmllistmodel::appendFromJson()
+{
+    QFETCH(bool, dynamicRoles);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QStringLiteral("import QtQml.Models\nListModel { dynamicRoles: %1 }")
+                              .arg(dynamicRoles).toUtf8(), QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(object.data());
+    QVERIFY(model);
+
+    QSignalSpy spy(model, &QQmlListModel::rowsInserted);
+    model->appendFromJson(QStringLiteral(R"([
+            { "name": "a", "value": 1.5, "flag": true },
+            { "name": "b", "value": -2, "flag": false }
+        ])"));
+    model->appendFromJson(QStringLiteral(R"({ "name": "c", "value": 3, "flag": true })"));
+
+    QCOMPARE(spy.size(), 2);
+    QCOMPARE(model->count(), 3);
+
+    const QString names[] = { "a", "b", "c" };
+    const double values[] = { 1.5, -2, 3 };
+    const bool flags[] = { true, false, true };
+    for (int i = 0; i < 3; ++i) {
+        QObject *item = qjsvalue_cast<QObject *>(model->get(i));
+        QVERIFY(item);
+        QCOMPARE(item->property("name").toString(), names[i]);
+        QCOMPARE(item->property("value").toDouble(), values[i]);
+        QCOMPARE(item->property("flag").toBool(), flags[i]);
+    }
+
+    if (!dynamicRoles) {
+        model->appendFromJson(QStringLiteral(R"([{ "name": "d", "items": [{ "x": 1 }, { "x": 2 }] }])"));
+        QCOMPARE(model->count(), 4);
+        QQmlListModel *items = qobject_cast<QQmlListModel *>(
+                qjsvalue_cast<QObject *>(model->get(3))->property("items").value<QObject *>());
+        QVERIFY(items);
+        QCOMPARE(items->count(), 2);
+        QCOMPARE(qjsvalue_cast<QObject *>(items->get(1))->property("x").toDouble(), 2.0);
+    }
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*appendFromJson: .* at offset .*"));
+    model->appendFromJson(QStringLiteral("[{ \"name\": }]"));
+    QCOMPARE(model->count(), dynamicRoles ? 3 : 4);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*appendFromJson: value is not an object"));
+    model->appendFromJson(QStringLiteral(R"([{ "name": "e" }, 5])"));
+    QCOMPARE(model->count(), dynamicRoles ? 3 : 4);
+
+    if (!dynamicRoles) {
+        QTest::ignoreMessage(QtWarningMsg,
+                             QRegularExpression(".*Can't assign to existing role 'name' of different type.*"));
+        QTest::ignoreMessage(QtWarningMsg,
+                             QRegularExpression(".*Can't add a value which is not an object to list role 'items'"));
+        model->appendFromJson(QStringLiteral(R"({ "name": 5, "value": 4, "items": [{ "x": 3 }, "y"] })"));
+        QCOMPARE(model->count(), 5);
+        QObject *item = qjsvalue_cast<QObject *>(model->get(4));
+        QVERIFY(item);
+        QVERIFY(item->property("name").toString().isEmpty());
+        QCOMPARE(item->property("value").toDouble(), 4.0);
+        QQmlListModel *items = qobject_cast<QQmlListModel *>(item->property("items").value<QObject *>());
+        QVERIFY(items);
+        QCOMPARE(items->count(), 1);
+    }
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
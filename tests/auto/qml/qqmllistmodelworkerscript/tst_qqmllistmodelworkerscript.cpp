@@ -82,6 +82,7 @@ private slots:
     void dynamic_role_data();
     void dynamic_role();
     void correctMoves();
+    void worker_bulk_insert();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -191,6 +192,11 @@ void tst_qqmllistmodelworkerscript::dynamic_data()
         QTest::newRow("append4a") << "{append(123)}" << 0 << "<Unknown File>: QML ListModel: append: value is not an object" << dr;
         QTest::newRow("append4b") << "{append([{'foo':123},{'foo':456},{'foo':789}]);count}" << 3 << "" << dr;
         QTest::newRow("append4c") << "{append([{'foo':123},{'foo':456},{'foo':789}]);get(1).foo}" << 456 << "" << dr;
+        QTest::newRow("appendColumns1") << "{appendColumns({'foo':new Float64Array([1,2,3])});count}" << 3 << "" << dr;
+        QTest::newRow("appendColumns2") << "{appendColumns({'foo':new Int32Array([123,456]),'bar':['a','b']});get(1).foo}" << 456 << "" << dr;
+        QTest::newRow("appendColumns3") << "{appendColumns({'foo':[1,2],'bar':[3]});count}" << 0 << "<Unknown File>: QML ListModel: appendColumns: arrays have different lengths" << dr;
+        QTest::newRow("appendFromJson1") << "{appendFromJson('[{\"foo\":123},{\"foo\":456}]');count}" << 2 << "" << dr;
+        QTest::newRow("appendFromJson2") << "{appendFromJson('{\"foo\":123}');append({'foo':456});get(1).foo}" << 456 << "" << dr;
 
         QTest::newRow("clear1") << "{append({'foo':456});clear();count}" << 0 << "" << dr;
         QTest::newRow("clear2") << "{append({'foo':123});append({'foo':456});clear();count}" << 0 << "" << dr;
@@ -835,6 +841,34 @@ void tst_qqmllistmodelworkerscript::correctMoves()
     QTRY_VERIFY(check());
 }
 
+void tst_qqmllistmodelworkerscript::worker_bulk_insert()
+{
+    QQmlListModel model;
+    QQmlEngine eng;
+    QQmlComponent component(&eng, testFileUrl("model.qml"));
+    std::unique_ptr<QQuickItem> item = createWorkerTest(&eng, &component, &model);
+    QVERIFY(item);
+
+    QSignalSpy spyModelInserted(&model, SIGNAL(rowsInserted(QModelIndex,int,int)));
+
+    // sync() reports consecutive new rows with a single rowsInserted
+    const QVariantList operations {
+        QStringLiteral("appendFromJson('[{\"foo\":1},{\"foo\":2},{\"foo\":3}]')"),
+        QStringLiteral("count")
+    };
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, operations)));
+    waitForWorker(item.get());
+
+    QCOMPARE(model.count(), 3);
+    QCOMPARE(spyModelInserted.size(), 1);
+    QCOMPARE(spyModelInserted.at(0).at(1).toInt(), 0);
+    QCOMPARE(spyModelInserted.at(0).at(2).toInt(), 2);
+
+    item.reset();
+    qApp->processEvents();
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
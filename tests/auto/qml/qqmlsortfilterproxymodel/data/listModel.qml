@@ -0,0 +1,21 @@
+import QtQml
+import QtQml.Models
+
+QtObject {
+    property ListModel source: ListModel {
+        ListElement { name: "Grace"; age: 85 }
+        ListElement { name: "Linus"; age: 12 }
+        ListElement { name: "Ada"; age: 36 }
+        ListElement { name: "Alan"; age: 41 }
+    }
+
+    property SortFilterProxyModel proxy: SortFilterProxyModel {
+        model: source
+        filters: FunctionFilter {
+            callback: function(row) { return row.age >= 18 }
+        }
+        sorters: FunctionSorter {
+            callback: function(lhs, rhs) { return lhs.name.length - rhs.name.length }
+        }
+    }
+}
@@ -0,0 +1,335 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/qtest.h>
+#include <QtTest/qsignalspy.h>
+#include <QtTest/qabstractitemmodeltester.h>
+#include <QtCore/qrandom.h>
+#include <QtGui/qstandarditemmodel.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQmlModels/private/qqmlsortfilterproxymodel_p.h>
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+
+enum Roles {
+    NameRole = Qt::UserRole,
+    AgeRole
+};
+
+static QList<QStandardItem *> createRow(const QString &name, int age)
+{
+    QStandardItem *item = new QStandardItem;
+    item->setData(name, NameRole);
+    item->setData(age, AgeRole);
+    return { item };
+}
+
+static void setupModel(QStandardItemModel *model, const QList<int> &ages)
+{
+    model->setItemRoleNames({ { NameRole, "name" }, { AgeRole, "age" } });
+    for (int age : ages)
+        model->appendRow(createRow(QString::number(age), age));
+}
+
+static QList<int> ages(const QAbstractItemModel *model)
+{
+    QList<int> result;
+    for (int row = 0; row < model->rowCount(); ++row)
+        result.append(model->index(row, 0).data(AgeRole).toInt());
+    return result;
+}
+
+class tst_qqmlsortfilterproxymodel : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_qqmlsortfilterproxymodel() : QQmlDataTest(QT_QMLTEST_DATADIR) {}
+
+private slots:
+    void sortAndFilter();
+    void insertRows();
+    void removeRows();
+    void dataChangeMovesRow();
+    void dataChangeFiltersRow();
+    void changeSorter();
+    void changeFilter();
+    void parallelSort();
+    void listModel();
+};
+
+void tst_qqmlsortfilterproxymodel::sortAndFilter()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 30, 10, 50, 20, 40 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QCOMPARE(ages(&proxy), QList<int>({ 30, 10, 50, 20, 40 }));
+
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+    QCOMPARE(ages(&proxy), QList<int>({ 10, 20, 30, 40, 50 }));
+
+    QQmlValueFilter filter;
+    filter.setRoleName(QStringLiteral("age"));
+    filter.setValue(30);
+    filter.setInvert(true);
+    QQmlListProperty<QQmlFilterBase> filters = proxy.filters();
+    filters.append(&filters, &filter);
+    QCOMPARE(ages(&proxy), QList<int>({ 10, 20, 40, 50 }));
+    QCOMPARE(proxy.count(), 4);
+
+    QCOMPARE(proxy.mapToSource(proxy.index(0, 0)).row(), 1);
+    QCOMPARE(proxy.mapFromSource(source.index(4, 0)).row(), 2);
+    QVERIFY(!proxy.mapFromSource(source.index(0, 0)).isValid());
+}
+
+void tst_qqmlsortfilterproxymodel::insertRows()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 10, 30, 50 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    sorter.setSortOrder(Qt::DescendingOrder);
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+    QCOMPARE(ages(&proxy), QList<int>({ 50, 30, 10 }));
+
+    QSignalSpy insertSpy(&proxy, &QAbstractItemModel::rowsInserted);
+    QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+    QSignalSpy countSpy(&proxy, &QQmlSortFilterProxyModel::countChanged);
+
+    source.insertRow(0, createRow(QStringLiteral("40"), 40));
+    QCOMPARE(ages(&proxy), QList<int>({ 50, 40, 30, 10 }));
+    QCOMPARE(insertSpy.size(), 1);
+    QCOMPARE(insertSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(insertSpy.at(0).at(2).toInt(), 1);
+
+    source.appendRow(createRow(QStringLiteral("0"), 0));
+    QCOMPARE(ages(&proxy), QList<int>({ 50, 40, 30, 10, 0 }));
+    QCOMPARE(insertSpy.size(), 2);
+    QCOMPARE(insertSpy.at(1).at(1).toInt(), 4);
+
+    QCOMPARE(resetSpy.size(), 0);
+    QCOMPARE(countSpy.size(), 2);
+}
+
+void tst_qqmlsortfilterproxymodel::removeRows()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 10, 40, 20, 50, 30 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+
+    QSignalSpy removeSpy(&proxy, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+
+    // Source rows 1 and 2 are 40 and 20, which are not next to each other in the proxy
+    source.removeRows(1, 2);
+    QCOMPARE(ages(&proxy), QList<int>({ 10, 30, 50 }));
+    QCOMPARE(removeSpy.size(), 2);
+    QCOMPARE(resetSpy.size(), 0);
+
+    QCOMPARE(proxy.mapFromSource(source.index(2, 0)).row(), 1);
+}
+
+void tst_qqmlsortfilterproxymodel::dataChangeMovesRow()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 10, 20, 30, 40 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+
+    QSignalSpy moveSpy(&proxy, &QAbstractItemModel::rowsMoved);
+    QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+    QSignalSpy dataSpy(&proxy, &QAbstractItemModel::dataChanged);
+
+    source.item(0)->setData(35, AgeRole);
+    QCOMPARE(ages(&proxy), QList<int>({ 20, 30, 35, 40 }));
+    QCOMPARE(moveSpy.size(), 1);
+    QCOMPARE(layoutSpy.size(), 0);
+    QCOMPARE(dataSpy.size(), 1);
+    QCOMPARE(dataSpy.at(0).at(0).toModelIndex().row(), 2);
+
+    // A change that keeps the order only emits dataChanged
+    source.item(0)->setData(36, AgeRole);
+    QCOMPARE(moveSpy.size(), 1);
+    QCOMPARE(dataSpy.size(), 2);
+
+    // A role that the sorter does not depend on does not move anything
+    source.item(3)->setData(QStringLiteral("forty"), NameRole);
+    QCOMPARE(moveSpy.size(), 1);
+    QCOMPARE(dataSpy.size(), 3);
+    QCOMPARE(dataSpy.at(2).at(0).toModelIndex().row(), 3);
+}
+
+void tst_qqmlsortfilterproxymodel::dataChangeFiltersRow()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 10, 20, 10, 30 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlValueFilter filter;
+    filter.setRoleName(QStringLiteral("age"));
+    filter.setValue(10);
+    filter.setInvert(true);
+    QQmlListProperty<QQmlFilterBase> filters = proxy.filters();
+    filters.append(&filters, &filter);
+    QCOMPARE(ages(&proxy), QList<int>({ 20, 30 }));
+
+    QSignalSpy insertSpy(&proxy, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removeSpy(&proxy, &QAbstractItemModel::rowsRemoved);
+
+    source.item(2)->setData(25, AgeRole);
+    QCOMPARE(ages(&proxy), QList<int>({ 20, 25, 30 }));
+    QCOMPARE(insertSpy.size(), 1);
+    QCOMPARE(insertSpy.at(0).at(1).toInt(), 1);
+
+    source.item(1)->setData(10, AgeRole);
+    QCOMPARE(ages(&proxy), QList<int>({ 25, 30 }));
+    QCOMPARE(removeSpy.size(), 1);
+    QCOMPARE(removeSpy.at(0).at(1).toInt(), 0);
+}
+
+void tst_qqmlsortfilterproxymodel::changeSorter()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 20, 10, 30 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+
+    const QPersistentModelIndex persistent = proxy.index(0, 0);
+    QCOMPARE(persistent.data(AgeRole).toInt(), 10);
+
+    QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+    QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+
+    sorter.setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(ages(&proxy), QList<int>({ 30, 20, 10 }));
+    QCOMPARE(layoutSpy.size(), 1);
+    QCOMPARE(resetSpy.size(), 0);
+    QCOMPARE(persistent.row(), 2);
+
+    sorter.setEnabled(false);
+    QCOMPARE(ages(&proxy), QList<int>({ 20, 10, 30 }));
+    QCOMPARE(layoutSpy.size(), 2);
+}
+
+void tst_qqmlsortfilterproxymodel::changeFilter()
+{
+    QStandardItemModel source;
+    setupModel(&source, { 10, 20, 10, 30 });
+
+    QQmlSortFilterProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy);
+    proxy.setSourceModel(&source);
+    QQmlValueFilter filter;
+    filter.setRoleName(QStringLiteral("age"));
+    filter.setValue(10);
+    QQmlListProperty<QQmlFilterBase> filters = proxy.filters();
+    filters.append(&filters, &filter);
+    QCOMPARE(ages(&proxy), QList<int>({ 10, 10 }));
+
+    QSignalSpy insertSpy(&proxy, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removeSpy(&proxy, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+
+    filter.setValue(20);
+    QCOMPARE(ages(&proxy), QList<int>({ 20 }));
+    QCOMPARE(removeSpy.size(), 1);
+    QCOMPARE(insertSpy.size(), 1);
+    QCOMPARE(resetSpy.size(), 0);
+
+    filter.setEnabled(false);
+    QCOMPARE(ages(&proxy), QList<int>({ 10, 20, 10, 30 }));
+}
+
+void tst_qqmlsortfilterproxymodel::parallelSort()
+{
+    QList<int> values(200000);
+    QRandomGenerator random(42);
+    for (int &value : values)
+        value = int(random.bounded(1000));
+
+    QStandardItemModel source;
+    setupModel(&source, values);
+
+    QQmlSortFilterProxyModel proxy;
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("age"));
+    QQmlListProperty<QQmlSorterBase> sorters = proxy.sorters();
+    sorters.append(&sorters, &sorter);
+
+    QList<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    QCOMPARE(ages(&proxy), expected);
+
+    // Equal rows keep the order of the source model
+    for (int row = 1; row < proxy.rowCount(); ++row) {
+        const QModelIndex previous = proxy.mapToSource(proxy.index(row - 1, 0));
+        const QModelIndex current = proxy.mapToSource(proxy.index(row, 0));
+        if (previous.data(AgeRole) == current.data(AgeRole))
+            QVERIFY(previous.row() < current.row());
+    }
+}
+
+void tst_qqmlsortfilterproxymodel::listModel()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("listModel.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+
+    auto *proxy = qobject_cast<QQmlSortFilterProxyModel *>(
+            root->property("proxy").value<QObject *>());
+    QVERIFY(proxy);
+    QAbstractItemModelTester tester(proxy);
+
+    const int nameRole = proxy->roleNames().key("name");
+    const auto names = [&]() {
+        QStringList result;
+        for (int row = 0; row < proxy->rowCount(); ++row)
+            result.append(proxy->index(row, 0).data(nameRole).toString());
+        return result;
+    };
+    QCOMPARE(names(), QStringList({ "Ada", "Alan", "Grace" }));
+
+    auto *source = root->property("source").value<QAbstractItemModel *>();
+    QVERIFY(source);
+    const int ageRole = source->roleNames().key("age");
+    QVERIFY(source->setData(source->index(1, 0), 20, ageRole));
+    QCOMPARE(names(), QStringList({ "Ada", "Alan", "Grace", "Linus" }));
+}
+
+QTEST_MAIN(tst_qqmlsortfilterproxymodel)
+
+#include "tst_qqmlsortfilterproxymodel.moc"
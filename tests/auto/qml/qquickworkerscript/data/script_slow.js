@@ -0,0 +1,5 @@
+WorkerScript.onMessage = function(msg) {
+    var end = Date.now() + 50
+    while (Date.now() < end) {}
+    WorkerScript.sendMessage(msg)
+}
@@ -0,0 +1,12 @@
+WorkerScript.onMessage = function(msg) {
+    if (msg.shared) {
+        Atomics.store(msg.shared, 0, 42)
+        WorkerScript.sendMessage({ shared: true })
+        return
+    }
+
+    var byteLength = msg.values.buffer.byteLength
+    for (var i = 0; i < msg.values.length; ++i)
+        msg.values[i] *= 2
+    WorkerScript.sendMessage({ values: msg.values, byteLength: byteLength }, [ msg.values.buffer ])
+}
@@ -0,0 +1,21 @@
+import QtQml
+import QtQml.WorkerScript
+
+WorkerScript {
+    id: worker
+    source: "script_slow.js"
+    dedicatedThread: true
+
+    property variant response
+
+    signal done()
+
+    function testSend(value) {
+        worker.sendMessage(value)
+    }
+
+    onMessage: (messageObject) => {
+        worker.response = messageObject
+        worker.done()
+    }
+}
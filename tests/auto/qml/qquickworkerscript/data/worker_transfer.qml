@@ -0,0 +1,39 @@
+import QtQuick 2.0
+import QtQml.WorkerScript 2.15
+
+WorkerScript {
+    id: worker
+    source: "script_transfer.js"
+
+    property variant response
+    property int receivedByteLength: -1
+    property var sent
+    property var shared: new Int32Array(new SharedArrayBuffer(8))
+
+    signal done()
+
+    function testSendBuffer(transfer, subarray) {
+        if (subarray)
+            sent = new Float64Array([0.5, 1.5, 2.5, 3.5, 4.5]).subarray(1, 4)
+        else
+            sent = new Float64Array([1.5, 2.5, 3.5])
+        if (transfer)
+            worker.sendMessage({ values: sent }, [ sent ])
+        else
+            worker.sendMessage({ values: sent })
+    }
+
+    function testSendShared() {
+        worker.sendMessage({ shared: shared })
+    }
+
+    onMessage: (messageObject) => {
+        if (messageObject.shared)
+            worker.response = Atomics.load(shared, 0)
+        else {
+            worker.response = Array.from(messageObject.values)
+            worker.receivedByteLength = messageObject.byteLength
+        }
+        worker.done()
+    }
+}
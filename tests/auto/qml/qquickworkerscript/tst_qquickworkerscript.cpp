@@ -6,6 +6,7 @@
 #include <QtCore/qdir.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qregularexpression.h>
+#include <QtTest/qsignalspy.h>
 #include <QtQml/qjsengine.h>
 
 #include <QtQml/qqmlcomponent.h>
@@ -28,6 +29,11 @@ private slots:
     void messaging_sendQObjectList();
     void messaging_sendJsObject();
     void messaging_sendExternalObject();
+    void messaging_arrayBuffer_data();
+    void messaging_arrayBuffer();
+    void messaging_sharedArrayBuffer();
+    void dedicatedThread();
+    void pendingMessages();
     void script_with_pragma();
     void script_included();
     void scriptError_onLoad();
@@ -193,6 +199,108 @@ void tst_QQuickWorkerScript::messaging_sendExternalObject()
     QTest::qWait(100); // shouldn't crash.
 }
 
+void tst_QQuickWorkerScript::messaging_arrayBuffer_data()
+{
+    QTest::addColumn<bool>("transfer");
+    QTest::addColumn<bool>("subarray");
+    QTest::addColumn<int>("receivedByteLength");
+
+    QTest::newRow("copy") << false << false << 24;
+    QTest::newRow("transfer") << true << false << 24;
+    // A copied view only takes the bytes it covers, a transferred one its whole buffer
+    QTest::newRow("copy subarray") << false << true << 24;
+    QTest::newRow("transfer subarray") << true << true << 40;
+}
+
+void tst_QQuickWorkerScript::messaging_arrayBuffer()
+{
+    QFETCH(bool, transfer);
+    QFETCH(bool, subarray);
+    QFETCH(int, receivedByteLength);
+
+    QQmlComponent component(&m_engine, testFileUrl("worker_transfer.qml"));
+    std::unique_ptr<QQuickWorkerScript> worker { qobject_cast<QQuickWorkerScript*>(component.create()) };
+    QVERIFY(worker);
+
+    QVERIFY(QMetaObject::invokeMethod(worker.get(), "testSendBuffer", Q_ARG(QVariant, transfer),
+                                      Q_ARG(QVariant, subarray)));
+
+    // A transferred buffer is detached from the sender as soon as it is sent
+    QJSValue sent = worker->property("sent").value<QJSValue>();
+    QCOMPARE(sent.property("length").toInt(), transfer ? 0 : 3);
+    QCOMPARE(sent.property("buffer").property("byteLength").toInt(),
+             transfer ? 0 : (subarray ? 40 : 24));
+
+    waitForEchoMessage(worker.get());
+
+    QVariant response = worker->property("response");
+    if (response.userType() == qMetaTypeId<QJSValue>())
+        response = response.value<QJSValue>().toVariant();
+    QCOMPARE(response, QVariant(QVariantList { 3.0, 5.0, 7.0 }));
+    QCOMPARE(worker->property("receivedByteLength").toInt(), receivedByteLength);
+
+    // Copies sent without a transfer list leave the original untouched
+    if (!transfer)
+        QCOMPARE(sent.property(0).toNumber(), 1.5);
+
+    qApp->processEvents();
+}
+
+void tst_QQuickWorkerScript::messaging_sharedArrayBuffer()
+{
+    QQmlComponent component(&m_engine, testFileUrl("worker_transfer.qml"));
+    std::unique_ptr<QQuickWorkerScript> worker { qobject_cast<QQuickWorkerScript*>(component.create()) };
+    QVERIFY(worker);
+
+    // The worker stores into the shared memory using Atomics
+    QVERIFY(QMetaObject::invokeMethod(worker.get(), "testSendShared"));
+    waitForEchoMessage(worker.get());
+
+    QCOMPARE(worker->property("response").toInt(), 42);
+
+    qApp->processEvents();
+}
+
+void tst_QQuickWorkerScript::dedicatedThread()
+{
+    QQmlComponent component(&m_engine, testFileUrl("worker_dedicated.qml"));
+    std::unique_ptr<QQuickWorkerScript> worker { qobject_cast<QQuickWorkerScript*>(component.create()) };
+    QVERIFY(worker);
+    QVERIFY(worker->dedicatedThread());
+    QVERIFY(worker->ready());
+
+    // The thread cannot be changed once the worker runs
+    QTest::ignoreMessage(QtWarningMsg, "QQuickWorkerScript: Cannot change dedicatedThread after WorkerScript establishment");
+    worker->setDedicatedThread(false);
+    QVERIFY(worker->dedicatedThread());
+
+    QVERIFY(QMetaObject::invokeMethod(worker.get(), "testSend", Q_ARG(QVariant, QVariant(42))));
+    waitForEchoMessage(worker.get());
+    QCOMPARE(worker->property("response").toInt(), 42);
+
+    qApp->processEvents();
+}
+
+void tst_QQuickWorkerScript::pendingMessages()
+{
+    QQmlComponent component(&m_engine, testFileUrl("worker_dedicated.qml"));
+    std::unique_ptr<QQuickWorkerScript> worker { qobject_cast<QQuickWorkerScript*>(component.create()) };
+    QVERIFY(worker);
+    QCOMPARE(worker->pendingMessages(), 0);
+
+    QSignalSpy spy(worker.get(), &QQuickWorkerScript::pendingMessagesChanged);
+    for (int i = 0; i < 3; ++i)
+        QVERIFY(QMetaObject::invokeMethod(worker.get(), "testSend", Q_ARG(QVariant, QVariant(i))));
+    QCOMPARE(spy.size(), 3);
+
+    // Each message keeps the worker busy, so at most one of them has started
+    QVERIFY(worker->pendingMessages() >= 2);
+    QTRY_COMPARE(worker->pendingMessages(), 0);
+    QVERIFY(spy.size() > 3);
+
+    qApp->processEvents();
+}
+
 void tst_QQuickWorkerScript::script_with_pragma()
 {
     QVariant value(100);
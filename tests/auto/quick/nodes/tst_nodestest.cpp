@@ -13,6 +13,7 @@
 #include <QtQuick/qsgsimplerectnode.h>
 #include <QtQuick/qsgsimpletexturenode.h>
 #include <QtQuick/private/qsgplaintexture_p.h>
+#include <QtQuick/private/qsgrhiatlastexture_p.h>
 
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformintegration.h>
@@ -76,6 +77,11 @@ private Q_SLOTS:
     void textureNodeRect_data();
     void textureNodeRect();
 
+    void atlasPages_data();
+    void atlasPages();
+    void atlasPageRetirement_data();
+    void atlasPageRetirement();
+
 private:
     void rhiTestData();
 
@@ -484,6 +490,166 @@ void NodesTest::textureNodeRect()
     renderContext->invalidate();
 }
 
+void NodesTest::atlasPages_data()
+{
+    rhiTestData();
+}
+
+void NodesTest::atlasPages()
+{
+    INIT_RHI();
+
+    QSGRhiAtlasTexture::Manager *manager = renderContext->atlasManager();
+    QVERIFY(manager);
+    QCOMPARE(manager->statistics().pageCount, 0);
+
+    QImage image(200, 200, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+
+    std::vector<std::unique_ptr<QSGTexture>> textures;
+    const auto createTexture = [&]() {
+        textures.emplace_back(renderContext->createTexture(image, QSGRenderContext::CreateTexture_Atlas));
+        return textures.back().get();
+    };
+
+    // Fill the first page until a second one is needed
+    QSGTexture *texture = createTexture();
+    QVERIFY(texture->isAtlasTexture());
+    const qint64 firstPage = texture->comparisonKey();
+    while (manager->statistics().pageCount == 1 && textures.size() < 64) {
+        texture = createTexture();
+        QVERIFY(texture->isAtlasTexture());
+    }
+    QCOMPARE(manager->statistics().pageCount, 2);
+    const qint64 secondPage = texture->comparisonKey();
+    QVERIFY(secondPage != firstPage);
+
+    // Once all pages are full, textures fall back to standalone ones
+    while (texture->isAtlasTexture() && textures.size() < 128)
+        texture = createTexture();
+    QVERIFY(!texture->isAtlasTexture());
+    textures.pop_back();
+
+    QSGRhiAtlasTexture::Manager::Statistics stats = manager->statistics();
+    QCOMPARE(stats.pageCount, 2);
+    QCOMPARE(stats.retiredPageCount, 0);
+    QCOMPARE(stats.textureCount, int(textures.size()));
+    QCOMPARE(stats.allocatedArea, qint64(textures.size()) * 202 * 202);
+    QVERIFY(stats.occupancy() > 0.5);
+
+    textures.erase(std::remove_if(textures.begin(), textures.end(),
+                                  [secondPage](const std::unique_ptr<QSGTexture> &t) {
+                                      return t->comparisonKey() == secondPage;
+                                  }),
+                   textures.end());
+    QCOMPARE(manager->statistics().pageCount, 2);
+    QCOMPARE(manager->statistics().textureCount, int(textures.size()));
+
+    // Empty pages are released on the next allocation, except for the first one
+    textures.clear();
+    image = QImage(16, 16, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::blue);
+    texture = createTexture();
+    QVERIFY(texture->isAtlasTexture());
+    QCOMPARE(texture->comparisonKey(), firstPage);
+    stats = manager->statistics();
+    QCOMPARE(stats.pageCount, 1);
+    QCOMPARE(stats.textureCount, 1);
+    QCOMPARE(stats.allocatedArea, qint64(18 * 18));
+
+    textures.clear();
+    renderContext->invalidate();
+}
+
+void NodesTest::atlasPageRetirement_data()
+{
+    rhiTestData();
+}
+
+void NodesTest::atlasPageRetirement()
+{
+    INIT_RHI();
+
+    QSGRhiAtlasTexture::Manager *manager = renderContext->atlasManager();
+    QVERIFY(manager);
+
+    QImage image(200, 200, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+
+    std::vector<std::unique_ptr<QSGTexture>> textures;
+    const auto createTexture = [&](const QImage &image) {
+        textures.emplace_back(renderContext->createTexture(image, QSGRenderContext::CreateTexture_Atlas));
+        return textures.back().get();
+    };
+
+    // Fill the first page, which is 512x512 for this surface size, with a 2x2 grid
+    for (int i = 0; i < 4; ++i)
+        QVERIFY(createTexture(image)->isAtlasTexture());
+    QCOMPARE(manager->statistics().pageCount, 1);
+    const qint64 firstPage = textures.front()->comparisonKey();
+
+    // Fragment it by only keeping the textures on one diagonal, so that it is
+    // mostly empty, but still has no room for an image larger than a quarter
+    std::vector<std::unique_ptr<QSGTexture>> kept;
+    for (auto &texture : textures) {
+        const QRectF rect = texture->normalizedTextureSubRect();
+        if ((rect.x() < 0.25) == (rect.y() < 0.25))
+            kept.push_back(std::move(texture));
+    }
+    textures.clear();
+    QCOMPARE(kept.size(), size_t(2));
+    QList<QRectF> keptRects;
+    for (const auto &texture : kept)
+        keptRects.append(texture->normalizedTextureSubRect());
+
+    QSGRhiAtlasTexture::Manager::Statistics stats = manager->statistics();
+    QCOMPARE(stats.textureCount, 2);
+    QVERIFY(stats.occupancy() < 0.5);
+
+    // The large image retires the fragmented page and goes to a new one
+    QImage largeImage(250, 250, QImage::Format_ARGB32_Premultiplied);
+    largeImage.fill(Qt::green);
+    QSGTexture *texture = createTexture(largeImage);
+    QVERIFY(texture->isAtlasTexture());
+    const qint64 secondPage = texture->comparisonKey();
+    QVERIFY(secondPage != firstPage);
+    stats = manager->statistics();
+    QCOMPARE(stats.pageCount, 2);
+    QCOMPARE(stats.retiredPageCount, 1);
+    QCOMPARE(stats.textureCount, 3);
+
+    // Textures on the retired page stay where they are
+    for (qsizetype i = 0; i < qsizetype(kept.size()); ++i) {
+        QVERIFY(kept[i]->isAtlasTexture());
+        QCOMPARE(kept[i]->comparisonKey(), firstPage);
+        QCOMPARE(kept[i]->normalizedTextureSubRect(), keptRects.at(i));
+    }
+
+    // New textures only go to the remaining page, even if they would fit the retired one
+    QImage smallImage(16, 16, QImage::Format_ARGB32_Premultiplied);
+    smallImage.fill(Qt::blue);
+    texture = createTexture(smallImage);
+    QVERIFY(texture->isAtlasTexture());
+    QCOMPARE(texture->comparisonKey(), secondPage);
+
+    // Once drained, the retired page is released on the next allocation
+    kept.clear();
+    QCOMPARE(manager->statistics().pageCount, 2);
+    texture = createTexture(smallImage);
+    QCOMPARE(texture->comparisonKey(), secondPage);
+    stats = manager->statistics();
+    QCOMPARE(stats.pageCount, 1);
+    QCOMPARE(stats.retiredPageCount, 0);
+    QCOMPARE(stats.textureCount, 3);
+    for (const auto &texture : textures) {
+        QVERIFY(texture->isAtlasTexture());
+        QCOMPARE(texture->comparisonKey(), secondPage);
+    }
+
+    textures.clear();
+    renderContext->invalidate();
+}
+
 QTEST_MAIN(NodesTest);
 
 #include "tst_nodestest.moc"
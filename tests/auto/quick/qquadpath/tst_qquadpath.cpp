@@ -0,0 +1,171 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+#include <QtCore/qdatastream.h>
+#include <QtGui/qpainterpath.h>
+
+#include <QtQuick/private/qquadpath_p.h>
+
+class tst_QQuadPath : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void dataStreamRoundTrip();
+    void dataStreamCorrupt_data();
+    void dataStreamCorrupt();
+    void dataStreamTruncated();
+
+private:
+    static QQuadPath testPath();
+    static QByteArray serialized(const QQuadPath &path);
+};
+
+QQuadPath tst_QQuadPath::testPath()
+{
+    QPainterPath painterPath;
+    painterPath.addEllipse(0, 0, 100, 50);
+    painterPath.addRect(20, 10, 30, 30);
+    painterPath.setFillRule(Qt::WindingFill);
+
+    QQuadPath path = QQuadPath::fromPainterPath(painterPath, QQuadPath::PathQuadratic);
+    path.addCurvatureData();
+    // Gives the path children, and the first child children of its own
+    path.splitElementAt(0);
+    path.splitElementAt(path.indexOfChildAt(0, 0));
+    return path;
+}
+
+QByteArray tst_QQuadPath::serialized(const QQuadPath &path)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << path;
+    return data;
+}
+
+void tst_QQuadPath::dataStreamRoundTrip()
+{
+    const QQuadPath path = testPath();
+    const QByteArray data = serialized(path);
+
+    QQuadPath result;
+    QDataStream stream(data);
+    stream >> result;
+    QCOMPARE(stream.status(), QDataStream::Ok);
+    QVERIFY(stream.atEnd());
+
+    QCOMPARE(result.elementCount(), path.elementCount());
+    QCOMPARE(result.elementCountRecursive(), path.elementCountRecursive());
+    QCOMPARE(result.fillRule(), Qt::WindingFill);
+    QCOMPARE(result.pathHints(), path.pathHints());
+    QCOMPARE(result.toPainterPath(), path.toPainterPath());
+
+    QCOMPARE(result.elementAt(0).childCount(), 2);
+    const int firstChild = result.indexOfChildAt(0, 0);
+    QCOMPARE(result.elementAt(firstChild).childCount(), 2);
+
+    QList<QQuadPath::Element> expected;
+    path.iterateElements([&expected](const QQuadPath::Element &e, int) { expected.append(e); });
+    int i = 0;
+    result.iterateElements([&](const QQuadPath::Element &e, int) {
+        QVERIFY(i < expected.size());
+        const QQuadPath::Element &other = expected.at(i++);
+        QCOMPARE(e.startPoint(), other.startPoint());
+        QCOMPARE(e.controlPoint(), other.controlPoint());
+        QCOMPARE(e.endPoint(), other.endPoint());
+        QCOMPARE(e.isSubpathStart(), other.isSubpathStart());
+        QCOMPARE(e.isSubpathEnd(), other.isSubpathEnd());
+        QCOMPARE(e.isLine(), other.isLine());
+        QCOMPARE(e.isConvex(), other.isConvex());
+        QCOMPARE(e.referencePoint(), other.referencePoint());
+    });
+    QCOMPARE(i, expected.size());
+
+    // Writing the result again gives the same data
+    QCOMPARE(serialized(result), data);
+}
+
+struct TestElement
+{
+    qint32 firstChildIndex = 0;
+    quint8 childCount = 0;
+    quint8 curvatureFlags = 0;
+    quint8 bits = 0;
+};
+
+// Writes the fields in the order of the QDataStream operators of QQuadPath
+static QByteArray serializedPath(const QList<TestElement> &elements,
+                                 const QList<TestElement> &children, quint8 hints = 0)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    const auto writeElements = [&stream](const QList<TestElement> &list) {
+        stream << quint32(list.size());
+        for (const TestElement &e : list) {
+            stream << QVector2D(0, 0) << QVector2D(5, 10) << QVector2D(10, 0) << e.firstChildIndex
+                   << e.childCount << e.curvatureFlags << e.bits;
+        }
+    };
+    writeElements(elements);
+    writeElements(children);
+    stream << false << hints;
+    return data;
+}
+
+void tst_QQuadPath::dataStreamCorrupt_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<bool>("valid");
+
+    QTest::newRow("valid") << serializedPath({ {}, { 0, 2 } }, { {}, { 2, 1 }, {} },
+                                             QQuadPath::PathQuadratic | QQuadPath::PathConvex)
+                           << true;
+    QTest::newRow("child past end") << serializedPath({ { 1, 2 } }, { {}, {} }) << false;
+    QTest::newRow("children without child list") << serializedPath({ { 0, 1 } }, {}) << false;
+    QTest::newRow("negative child index") << serializedPath({ { -1, 1 } }, { {} }) << false;
+    QTest::newRow("child of itself") << serializedPath({ { 0, 1 } }, { { 0, 1 } }) << false;
+    QTest::newRow("child of a later child") << serializedPath({ { 0, 2 } }, { {}, { 0, 1 } })
+                                            << false;
+    QTest::newRow("curvature flags") << serializedPath({ { 0, 0, 4 } }, {}) << false;
+    QTest::newRow("element bits") << serializedPath({ { 0, 0, 0, 8 } }, {}) << false;
+    QTest::newRow("hints") << serializedPath({ {} }, {}, 0x80) << false;
+}
+
+void tst_QQuadPath::dataStreamCorrupt()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, valid);
+
+    QQuadPath path;
+    path.moveTo(QVector2D(1, 1));
+    path.lineTo(QVector2D(2, 2));
+
+    QDataStream stream(data);
+    stream >> path;
+    QCOMPARE(stream.status(), valid ? QDataStream::Ok : QDataStream::ReadCorruptData);
+    if (valid) {
+        QCOMPARE(path.elementCount(), 2);
+        QCOMPARE(path.elementCountRecursive(), 3);
+    } else {
+        // Nothing of a rejected path is kept
+        QVERIFY(path.isEmpty());
+    }
+}
+
+void tst_QQuadPath::dataStreamTruncated()
+{
+    const QByteArray data = serialized(testPath());
+    for (qsizetype size : { qsizetype(0), qsizetype(3), data.size() / 2, data.size() - 1 }) {
+        QQuadPath path;
+        QDataStream stream(data.left(size));
+        stream >> path;
+        QCOMPARE(stream.status(), QDataStream::ReadPastEnd);
+        QVERIFY(path.isEmpty());
+    }
+}
+
+QTEST_MAIN(tst_QQuadPath)
+
+#include "tst_qquadpath.moc"
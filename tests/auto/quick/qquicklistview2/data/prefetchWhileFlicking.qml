@@ -0,0 +1,15 @@
+import QtQuick
+
+ListView {
+    width: 200
+    height: 200
+    cacheBuffer: 100
+    model: 10000
+    delegate: Rectangle {
+        required property int index
+        width: ListView.view.width
+        height: 20
+        color: index % 2 ? "lightsteelblue" : "white"
+        Text { text: parent.index }
+    }
+}
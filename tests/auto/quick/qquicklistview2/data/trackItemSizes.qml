@@ -0,0 +1,15 @@
+import QtQuick
+
+ListView {
+    width: 200
+    height: 200
+    trackItemSizes: true
+    model: 1000
+    delegate: Rectangle {
+        required property int index
+        width: ListView.view.width
+        height: index % 10 ? 20 : 100
+        color: index % 2 ? "lightsteelblue" : "white"
+        Text { text: parent.index }
+    }
+}
@@ -5,10 +5,12 @@
 #include <QtQuick/qquickview.h>
 #include <QtQuick/private/qquickitemview_p_p.h>
 #include <QtQuick/private/qquicklistview_p.h>
+#include <QtQuick/private/qquicklistviewsizeindex_p_p.h>
 #include <QtQuickTest/QtQuickTest>
 #include <QStringListModel>
 #include <QQmlApplicationEngine>
 #include <QtQml/QQmlComponent>
+#include <QtQml/qqmlincubator.h>
 
 #include <QtQuickTestUtils/private/viewtestutils_p.h>
 #include <QtQuickTestUtils/private/visualtestutils_p.h>
@@ -73,6 +75,9 @@ private slots:
     void clearObjectListModel();
     void gadgetModelSections();
     void visibleBoundToCountGreaterThanZero();
+    void prefetchWhileFlicking();
+    void sizeIndex();
+    void trackItemSizes();
 
 private:
     void flickWithTouch(QQuickWindow *window, const QPoint &from, const QPoint &to);
@@ -1359,6 +1364,115 @@ void tst_QQuickListView2::visibleBoundToCountGreaterThanZero()
     QVERIFY(listView->isVisible());
 }
 
+void tst_QQuickListView2::prefetchWhileFlicking()
+{
+    QQuickView window;
+    QQmlIncubationController controller;
+    window.engine()->setIncubationController(&controller);
+    QVERIFY(QQuickTest::showView(window, testFileUrl("prefetchWhileFlicking.qml")));
+
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    auto *listViewPriv = QQuickItemViewPrivate::get(listView);
+    QVERIFY(listViewPriv->prefetchedItems.isEmpty());
+
+    // Delegates are only prefetched in the direction of travel
+    listView->flick(0, -5000);
+    QTRY_VERIFY(!listViewPriv->prefetchRequests.isEmpty());
+    const int lastVisibleIndex = listViewPriv->findLastVisibleIndex();
+    for (int index : std::as_const(listViewPriv->prefetchRequests))
+        QCOMPARE_GT(index, lastVisibleIndex);
+
+    // The view eventually reaches the delegates incubated for it
+    QTRY_VERIFY((controller.incubateFor(10), listViewPriv->prefetchStats.hits > 0));
+
+    // Incubations that left the prefetch window are cancelled
+    listView->cancelFlick();
+    QTRY_VERIFY(!listView->isMoving());
+    listView->setContentY(listView->contentY() + 1);
+    QVERIFY(listViewPriv->prefetchedItems.isEmpty());
+    QVERIFY(listViewPriv->prefetchRequests.isEmpty());
+
+    // And so are the ones in flight when the model goes away
+    listView->flick(0, -5000);
+    QTRY_VERIFY(!listViewPriv->prefetchRequests.isEmpty());
+    listView->setModel(QVariant());
+    QVERIFY(listViewPriv->prefetchRequests.isEmpty());
+    QVERIFY(listViewPriv->prefetchedItems.isEmpty());
+}
+
+void tst_QQuickListView2::sizeIndex()
+{
+    QQuickListViewSizeIndex index;
+    index.resize(100);
+    QCOMPARE(index.count(), 100);
+    QCOMPARE(index.extent(0, 100, 10, 0), 1000.0);
+
+    // Known sizes replace the estimate, spacing is added after every item
+    index.setSize(0, 50);
+    index.setSizes(10, { 30, 30, 30 });
+    QCOMPARE(index.extent(0, 100, 10, 0), 1100.0);
+    QCOMPARE(index.extent(0, 1, 10, 2), 52.0);
+    QCOMPARE(index.extent(10, 13, 10, 2), 96.0);
+    QCOMPARE(index.extent(1, 11, 10, 0), 120.0);
+
+    QCOMPARE(index.indexAt(0, 10, 0), 0);
+    QCOMPARE(index.indexAt(49, 10, 0), 0);
+    QCOMPARE(index.indexAt(50, 10, 0), 1);
+    QCOMPARE(index.indexAt(150, 10, 0), 10);
+    QCOMPARE(index.indexAt(179, 10, 0), 10);
+    QCOMPARE(index.indexAt(180, 10, 0), 11);
+
+    // Positions outside of the index are extrapolated
+    QCOMPARE(index.indexAt(-25, 10, 0), -3);
+    QCOMPARE(index.indexAt(1100 + 25, 10, 0), 102);
+    QCOMPARE(index.extent(0, 110, 10, 0), 1200.0);
+
+    // Sizes move along with their items
+    index.insert(0, 5);
+    QCOMPARE(index.count(), 105);
+    QVERIFY(!index.isKnown(0));
+    QCOMPARE(index.size(5), 50.0);
+    QCOMPARE(index.indexAt(100, 10, 0), 6);
+    index.remove(0, 10);
+    QCOMPARE(index.count(), 95);
+    QCOMPARE(index.sizes(5, 3), QList<qreal>({ 30, 30, 30 }));
+    index.setSize(5, -1);
+    QCOMPARE(index.extent(0, 95, 10, 0), 990.0);
+}
+
+void tst_QQuickListView2::trackItemSizes()
+{
+    QQuickView window;
+    QVERIFY(QQuickTest::showView(window, testFileUrl("trackItemSizes.qml")));
+
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    QVERIFY(listView->trackItemSizes());
+
+    // Every tenth item is five times as tall as the others
+    QList<qreal> sizes;
+    for (int i = 0; i < listView->count(); ++i)
+        sizes.append(i % 10 ? 20 : 100);
+    listView->setItemSizeHints(0, sizes);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QCOMPARE(listView->contentHeight(), qreal(100 * 100 + 900 * 20));
+
+    // Positioning far away from the created items is exact
+    listView->positionViewAtIndex(500, QQuickListView::Beginning);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QQuickItem *item = listView->itemAtIndex(500);
+    QVERIFY(item);
+    QCOMPARE(item->y(), qreal(50 * 100 + 450 * 20));
+    QCOMPARE(listView->contentY(), item->y());
+    QCOMPARE(listView->originY(), qreal(0));
+
+    // Hints require size tracking
+    listView->setTrackItemSizes(false);
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*setItemSizeHints\\(\\) requires trackItemSizes to be enabled"));
+    listView->setItemSizeHints(0, sizes);
+}
+
 QTEST_MAIN(tst_QQuickListView2)
 
 #include "tst_qquicklistview2.moc"
@@ -4,6 +4,8 @@
 #include <QtTest/QtTest>
 #include <QtQuick/private/qquickimage_p_p.h>
 #include <QtQuick/private/qquickpixmapcache_p.h>
+#include <QtQuick/private/qquickpixmapdiskcache_p.h>
+#include <QtQuick/private/qsgcompressedtexture_p.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQuick/qquickimageprovider.h>
 #include <QtQuick/qquickview.h>
@@ -77,6 +79,11 @@ private slots:
 #endif
     void slowDevice();
     void slowDeviceInterrupted();
+    void decodePool();
+    void decodePriority();
+    void diskCache();
+    void cacheBudget();
+    void compressedTextureVariants();
 private:
     QQmlEngine engine;
     TestHTTPServer server;
@@ -105,6 +112,20 @@ public slots:
     }
 };
 
+class FinishRecorder : public QObject
+{
+    Q_OBJECT
+public:
+    FinishRecorder(int id, QList<int> *order) : id(id), order(order) {}
+
+public slots:
+    void finished() { order->append(id); }
+
+private:
+    int id;
+    QList<int> *order;
+};
+
 #ifndef QT_NO_LOCALFILE_OPTIMIZED_QML
 static const bool localfile_optimized = true;
 #else
@@ -623,6 +644,334 @@ void tst_qquickpixmapcache::slowDeviceInterrupted()
 #endif
 }
 
+void tst_qquickpixmapcache::decodePool()
+{
+    qputenv("QML_PIXMAP_READER_THREADS", "4");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QML_PIXMAP_READER_THREADS"); });
+
+    QQmlEngine engine;
+    const QUrl url = testFileUrl("exists.png");
+    const int count = 40;
+
+    // Each request size makes for a separate load
+    std::vector<std::unique_ptr<QQuickPixmap>> pixmaps;
+    for (int i = 0; i < count; ++i) {
+        auto pixmap = std::make_unique<QQuickPixmap>();
+        pixmap->load(&engine, url, QRect(), QSize(10 + i, 10 + i), QQuickPixmap::Asynchronous);
+        QVERIFY(pixmap->isLoading());
+        pixmap->setPriority(i % 2 ? QQuickPixmap::BackgroundPriority : QQuickPixmap::VisiblePriority);
+        pixmaps.push_back(std::move(pixmap));
+    }
+
+    // Cancel some, whether they are waiting for a decoder or being decoded
+    for (int i = 0; i < count; i += 3)
+        pixmaps[i]->clear();
+
+    for (int i = 0; i < count; ++i) {
+        if (i % 3 == 0) {
+            QVERIFY(pixmaps[i]->isNull());
+            continue;
+        }
+        QTRY_VERIFY(pixmaps[i]->isReady());
+        QCOMPARE(pixmaps[i]->width(), 10 + i);
+    }
+}
+
+void tst_qquickpixmapcache::decodePriority()
+{
+    // With a single decoder, the jobs finish in the order they are picked in
+    qputenv("QML_PIXMAP_READER_THREADS", "1");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QML_PIXMAP_READER_THREADS"); });
+
+    QQmlEngine engine;
+    auto *provider = new SlowProvider;
+    engine.addImageProvider("slow", provider); // takes ownership
+
+    // Image providers run on the reader thread, so this keeps it busy while
+    // the jobs below queue up and get their priorities
+    QQuickPixmap blocker;
+    blocker.load(&engine, QUrl("image://slow/500"), QRect(), QSize(10, 10), QQuickPixmap::Asynchronous);
+    QTRY_COMPARE(provider->requestCount, 1);
+
+    const QUrl url = testFileUrl("exists.png");
+    const int count = 10;
+    QList<int> finishOrder;
+    std::vector<std::unique_ptr<FinishRecorder>> recorders;
+    std::vector<std::unique_ptr<QQuickPixmap>> pixmaps;
+    for (int i = 0; i < count; ++i) {
+        auto pixmap = std::make_unique<QQuickPixmap>();
+        pixmap->load(&engine, url, QRect(), QSize(10 + i, 10 + i), QQuickPixmap::Asynchronous);
+        QVERIFY(pixmap->isLoading());
+        pixmap->setPriority(i % 2 ? QQuickPixmap::BackgroundPriority : QQuickPixmap::VisiblePriority);
+        recorders.push_back(std::make_unique<FinishRecorder>(i, &finishOrder));
+        QVERIFY(pixmap->connectFinished(recorders.back().get(), SLOT(finished())));
+        pixmaps.push_back(std::move(pixmap));
+    }
+
+    // All the visible jobs finish before any of the background ones
+    QTRY_COMPARE(finishOrder.size(), count);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(finishOrder.at(i) % 2, i < count / 2 ? 0 : 1);
+}
+
+void tst_qquickpixmapcache::diskCache()
+{
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+    QTemporaryDir sourceDir;
+    QVERIFY(sourceDir.isValid());
+    const QString source = sourceDir.filePath("source.png");
+    QVERIFY(QFile::copy(testFile("exists.png"), source));
+
+    QQuickPixmapDiskCache cache(cacheDir.path(), 1024 * 1024);
+    const QQuickImageProviderOptions options;
+    const QString key = QQuickPixmapDiskCache::key(source, QRect(), QSize(50, 50), options, 0, 1);
+    QVERIFY(!key.isEmpty());
+    QCOMPARE(QQuickPixmapDiskCache::key(source, QRect(), QSize(50, 50), options, 0, 1), key);
+    // Each source size is cached separately
+    QVERIFY(QQuickPixmapDiskCache::key(source, QRect(), QSize(25, 25), options, 0, 1) != key);
+
+    QQuickPixmapDiskCache::Entry entry;
+    QVERIFY(!cache.load(key, &entry));
+
+    QImage image(50, 50, QImage::Format_ARGB32_Premultiplied);
+    image.fill(qRgba(10, 20, 30, 255));
+    entry.image = image;
+    entry.implicitSize = QSize(100, 100);
+    entry.frameCount = 1;
+    entry.appliedTransform = QQuickImageProviderOptions::ApplyTransform;
+    QVERIFY(cache.store(key, entry));
+
+    QQuickPixmapDiskCache::Entry loaded;
+    QVERIFY(cache.load(key, &loaded));
+    QCOMPARE(loaded.image, image);
+    QCOMPARE(loaded.implicitSize, QSize(100, 100));
+    QCOMPARE(loaded.frameCount, 1);
+    QCOMPARE(loaded.appliedTransform, QQuickImageProviderOptions::ApplyTransform);
+
+    // Images are stored in the format they were decoded to, so that a hit
+    // gives the same image as decoding the file again
+    QImage rgb(20, 20, QImage::Format_RGB888);
+    rgb.fill(Qt::red);
+    entry.image = rgb;
+    const QString rgbKey = QQuickPixmapDiskCache::key(source, QRect(), QSize(20, 20), options, 0, 1);
+    QVERIFY(cache.store(rgbKey, entry));
+    QVERIFY(cache.load(rgbKey, &loaded));
+    QCOMPARE(loaded.image.format(), QImage::Format_RGB888);
+    QCOMPARE(loaded.image, rgb);
+
+    QImage indexed(20, 20, QImage::Format_Indexed8);
+    indexed.setColorTable({ qRgb(255, 0, 0), qRgb(0, 0, 255) });
+    indexed.fill(1);
+    entry.image = indexed;
+    const QString indexedKey = QQuickPixmapDiskCache::key(source, QRect(), QSize(20, 21), options, 0, 1);
+    QVERIFY(cache.store(indexedKey, entry));
+    QVERIFY(cache.load(indexedKey, &loaded));
+    QCOMPARE(loaded.image.format(), QImage::Format_Indexed8);
+    QCOMPARE(loaded.image.colorTable(), indexed.colorTable());
+    QCOMPARE(loaded.image, indexed);
+
+    // Image loads store their entries in the background
+    const QString laterKey = QQuickPixmapDiskCache::key(source, QRect(), QSize(20, 22), options, 0, 1);
+    entry.image = rgb;
+    cache.storeLater(laterKey, entry);
+    cache.waitForStores();
+    QVERIFY(cache.load(laterKey, &loaded));
+    QCOMPARE(loaded.image, rgb);
+
+    // Storing an entry again replaces it, and is not counted twice
+    const qint64 usedBytes = cache.usedBytes();
+    cache.storeLater(laterKey, entry);
+    QVERIFY(cache.store(laterKey, entry));
+    cache.waitForStores();
+    QCOMPARE(cache.usedBytes(), usedBytes);
+
+    // Modifying the source invalidates its entries
+    QFile file(source);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    file.close();
+    QVERIFY(QQuickPixmapDiskCache::key(source, QRect(), QSize(50, 50), options, 0, 1) != key);
+
+    // Storing beyond the budget removes the least recently used entries
+    QImage large(400, 400, QImage::Format_ARGB32_Premultiplied);
+    large.fill(Qt::blue);
+    entry.image = large;
+    for (int i = 0; i < 4; ++i) {
+        const QString largeKey = QQuickPixmapDiskCache::key(source, QRect(), QSize(400, 400 + i), options, 0, 1);
+        QVERIFY(cache.store(largeKey, entry));
+    }
+    QVERIFY(cache.usedBytes() <= 1024 * 1024);
+    QVERIFY(cache.load(QQuickPixmapDiskCache::key(source, QRect(), QSize(400, 403), options, 0, 1), &loaded));
+}
+
+void tst_qquickpixmapcache::cacheBudget()
+{
+#ifdef QT_BUILD_INTERNAL
+    QQuickPixmapCache *cache = QQuickPixmapCache::instance();
+    const qsizetype defaultBudget = cache->unreferencedBudget();
+    const auto cleanup = qScopeGuard([&] {
+        cache->handleMemoryPressure(QQuickMemoryPressureMonitor::NoPressure);
+        cache->setTextureBudget(-1);
+        cache->setUnreferencedBudget(defaultBudget);
+    });
+
+    QQmlEngine engine;
+    const QUrl url = testFileUrl("exists.png");
+
+    // Nothing is kept without a budget
+    cache->setUnreferencedBudget(0);
+    QCOMPARE(cache->statistics().unreferencedCost, 0);
+    QCOMPARE(cache->statistics().unreferencedPixmapCount, 0);
+    {
+        QQuickPixmap pixmap(&engine, url, QRect(), QSize(40, 40));
+        QVERIFY(pixmap.isReady());
+        QCOMPARE_GT(cache->statistics().referencedCost, 0);
+    }
+    QCOMPARE(cache->statistics().unreferencedPixmapCount, 0);
+
+    // The least recently released pixmaps are evicted to stay within the budget
+    const qsizetype budget = 3 * 40 * 40 * 4;
+    cache->setUnreferencedBudget(budget);
+    int evictionCount = cache->statistics().evictionCount;
+    for (int i = 0; i < 6; ++i) {
+        QQuickPixmap pixmap(&engine, url, QRect(), QSize(40, 40 + i));
+        QVERIFY(pixmap.isReady());
+    }
+    QQuickPixmapCache::Statistics statistics = cache->statistics();
+    QCOMPARE_LE(statistics.unreferencedCost, budget);
+    QCOMPARE_GT(statistics.unreferencedPixmapCount, 0);
+    QCOMPARE_GT(statistics.evictionCount, evictionCount);
+
+    // Textures count towards their own budget
+    const qsizetype textureCost = cache->statistics().textureCost;
+    const QObject *factory = nullptr;
+    {
+        QQuickPixmap pixmap(&engine, url, QRect(), QSize(20, 20));
+        QVERIFY(pixmap.isReady());
+        factory = pixmap.textureFactory();
+        cache->textureCreated(factory, 1600);
+        QCOMPARE(cache->statistics().textureCost, textureCost + 1600);
+        QCOMPARE(cache->statistics().unreferencedTextureCost, 0);
+    }
+    QCOMPARE(cache->statistics().unreferencedTextureCost, 1600);
+    evictionCount = cache->statistics().evictionCount;
+    cache->setTextureBudget(1000);
+    QCOMPARE(cache->statistics().unreferencedTextureCost, 0);
+    QCOMPARE(cache->statistics().evictionCount, evictionCount + 1);
+    cache->textureReleased(factory, 1600);
+    QCOMPARE(cache->statistics().textureCost, textureCost);
+
+    // Critical memory pressure evicts everything that is unreferenced, until it is over
+    QCOMPARE_GT(cache->statistics().unreferencedPixmapCount, 0);
+    cache->handleMemoryPressure(QQuickMemoryPressureMonitor::CriticalPressure);
+    statistics = cache->statistics();
+    QCOMPARE(statistics.memoryPressure, QQuickMemoryPressureMonitor::CriticalPressure);
+    QCOMPARE(statistics.unreferencedPixmapCount, 0);
+    QCOMPARE(statistics.unreferencedCost, 0);
+    {
+        QQuickPixmap pixmap(&engine, url, QRect(), QSize(40, 40));
+        QVERIFY(pixmap.isReady());
+    }
+    QCOMPARE(cache->statistics().unreferencedPixmapCount, 0);
+
+    // Lower levels do not override a higher one before it cools down
+    cache->handleMemoryPressure(QQuickMemoryPressureMonitor::ModeratePressure);
+    QCOMPARE(cache->statistics().memoryPressure, QQuickMemoryPressureMonitor::CriticalPressure);
+    cache->handleMemoryPressure(QQuickMemoryPressureMonitor::NoPressure);
+    QCOMPARE(cache->statistics().memoryPressure, QQuickMemoryPressureMonitor::NoPressure);
+    {
+        QQuickPixmap pixmap(&engine, url, QRect(), QSize(40, 40));
+        QVERIFY(pixmap.isReady());
+    }
+    QCOMPARE(cache->statistics().unreferencedPixmapCount, 1);
+#else
+    QSKIP("This test relies on private APIs that are only exported in developer-builds");
+#endif
+}
+
+void tst_qquickpixmapcache::compressedTextureVariants()
+{
+    // data/compressed.png is 16x16, and has an astc, a bc and an etc2 variant
+    // of 256 bytes each
+    const int variantSize = 256;
+    const int decodedSize = 16 * 16 * 4;
+    const QUrl url = testFileUrl("compressed.png");
+    const int supportedBeforeWindow = QSGCompressedTextureVariantFactory::supportedVariants();
+
+    QQuickPixmap pixmap(&engine, url);
+    QVERIFY(pixmap.isReady());
+    QCOMPARE(pixmap.implicitSize(), QSize(16, 16));
+    auto *factory = dynamic_cast<QSGCompressedTextureVariantFactory *>(pixmap.textureFactory());
+    if (supportedBeforeWindow == 0) {
+        QVERIFY(!factory);
+        QSKIP("The graphics API supports none of the compressed texture variants");
+    }
+    QVERIFY(factory);
+    QCOMPARE(factory->textureSize(), QSize(16, 16));
+    if (supportedBeforeWindow < 0) {
+        // Without a window, all variants are loaded, and the image is decoded too
+        QVERIFY(factory->needsFallback());
+        QCOMPARE(factory->textureByteCount(), 3 * variantSize + decodedSize);
+    } else {
+        QVERIFY(!factory->needsFallback());
+        QCOMPARE(factory->textureByteCount(), variantSize);
+    }
+    const int byteCount = factory->textureByteCount();
+
+    // Scaling, clipping and applying the orientation need the decoded image
+    {
+        QQuickPixmap scaled(&engine, url, QRect(), QSize(8, 8));
+        QVERIFY(scaled.isReady());
+        QVERIFY(!dynamic_cast<QSGCompressedTextureVariantFactory *>(scaled.textureFactory()));
+        QQuickPixmap clipped(&engine, url, QRect(0, 0, 8, 8), QSize());
+        QVERIFY(clipped.isReady());
+        QVERIFY(!dynamic_cast<QSGCompressedTextureVariantFactory *>(clipped.textureFactory()));
+        QQuickImageProviderOptions transformOptions;
+        transformOptions.setAutoTransform(QQuickImageProviderOptions::ApplyTransform);
+        QQuickPixmap transformed;
+        transformed.load(&engine, url, QRect(), QSize(), QQuickPixmap::Cache, transformOptions);
+        QVERIFY(transformed.isReady());
+        QVERIFY(!dynamic_cast<QSGCompressedTextureVariantFactory *>(transformed.textureFactory()));
+    }
+
+    QScopedPointer<QQuickView> window(QQuickViewTestUtils::createView());
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    if (!QSGRendererInterface::isApiRhiBased(window->rendererInterface()->graphicsApi()))
+        QSKIP("Compressed texture variants need an RHI-based backend");
+    const int supported = QSGCompressedTextureVariantFactory::supportedVariants();
+    QCOMPARE_GE(supported, 0);
+
+    // Creating a texture keeps all the variants and the decoded image, for
+    // windows that use another graphics API
+    std::unique_ptr<QSGTexture> texture(factory->createTexture(window.data()));
+    QVERIFY(texture);
+    QCOMPARE(texture->textureSize(), QSize(16, 16));
+    if (supported) {
+        QVERIFY(qobject_cast<QSGCompressedTexture *>(texture.get()));
+    } else {
+        // None of the variants are supported, so the decoded image is used
+        QVERIFY(!qobject_cast<QSGCompressedTexture *>(texture.get()));
+    }
+    QCOMPARE(factory->textureByteCount(), byteCount);
+    QCOMPARE(factory->textureSize(), QSize(16, 16));
+    std::unique_ptr<QSGTexture> secondTexture(factory->createTexture(window.data()));
+    QVERIFY(secondTexture);
+    QCOMPARE(factory->textureByteCount(), byteCount);
+
+    // Once the variants a window supports are known, only the one it uses
+    // is loaded, and the image is not decoded
+    if (supported) {
+        QQuickPixmap other(&engine, url, QRect(), QSize(16, 16));
+        QVERIFY(other.isReady());
+        auto *otherFactory = dynamic_cast<QSGCompressedTextureVariantFactory *>(other.textureFactory());
+        QVERIFY(otherFactory);
+        QVERIFY(!otherFactory->needsFallback());
+        QCOMPARE(otherFactory->textureByteCount(), variantSize);
+    }
+}
+
 QT_END_NAMESPACE
 
 QTEST_MAIN(tst_qquickpixmapcache)
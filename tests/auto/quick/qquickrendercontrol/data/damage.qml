@@ -0,0 +1,18 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "steelblue"
+    Rectangle {
+        objectName: "moving"
+        x: 10
+        y: 10
+        width: 20
+        height: 20
+        color: "palegreen"
+    }
+}
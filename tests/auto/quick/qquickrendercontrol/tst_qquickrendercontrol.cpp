@@ -16,6 +16,9 @@
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuick/private/qsgrenderer_p.h>
+
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformintegration.h>
 
@@ -61,6 +64,8 @@ private slots:
     void cleanupTestCase();
     void renderAndReadBackWithRhi_data();
     void renderAndReadBackWithRhi();
+    void damageRect_data();
+    void damageRect();
     void renderAndReadBackWithVulkanNative();
     void renderAndReadBackWithVulkanAndCustomDepthTexture();
 
@@ -350,6 +355,99 @@ void tst_RenderControl::renderAndReadBackWithRhi()
     }
 }
 
+void tst_RenderControl::damageRect_data()
+{
+    renderAndReadBackWithRhi_data();
+}
+
+void tst_RenderControl::damageRect()
+{
+    QFETCH(QSGRendererInterface::GraphicsApi, api);
+
+#if QT_CONFIG(vulkan)
+    if (api == QSGRendererInterface::Vulkan && !vulkanInstance.isValid())
+        QSKIP("Skipping Vulkan-based QRhi test due to failing to create a VkInstance");
+#endif
+
+    QQuickWindow::setGraphicsApi(api);
+
+    QScopedPointer<QQuickRenderControl> renderControl(new QQuickRenderControl);
+    QScopedPointer<QQuickWindow> quickWindow(new QQuickWindow(renderControl.data()));
+#if QT_CONFIG(vulkan)
+    if (api == QSGRendererInterface::Vulkan)
+        quickWindow->setVulkanInstance(&vulkanInstance);
+#endif
+
+    QQmlEngine qmlEngine;
+    QQmlComponent qmlComponent(&qmlEngine, testFileUrl(QLatin1String("damage.qml")));
+    QScopedPointer<QQuickItem> rootItem(qobject_cast<QQuickItem *>(qmlComponent.create()));
+    QVERIFY2(rootItem, qPrintable(qmlComponent.errorString()));
+    QQuickItem *moving = rootItem->findChild<QQuickItem *>(QLatin1String("moving"));
+    QVERIFY(moving);
+
+    QSize size = rootItem->size().toSize();
+    quickWindow->contentItem()->setSize(size);
+    quickWindow->setGeometry(0, 0, size.width(), size.height());
+    rootItem->setParentItem(quickWindow->contentItem());
+
+    if (!renderControl->initialize())
+        QSKIP("Could not initialize graphics, perhaps unsupported graphics API, skipping");
+
+    QRhi *rhi = renderControl->rhi();
+    QScopedPointer<QRhiTexture> tex(rhi->newTexture(QRhiTexture::RGBA8, size, 1, QRhiTexture::RenderTarget));
+    QVERIFY(tex->create());
+    QScopedPointer<QRhiRenderBuffer> ds(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+    QVERIFY(ds->create());
+    QRhiTextureRenderTargetDescription rtDesc(QRhiColorAttachment(tex.data()));
+    rtDesc.setDepthStencilBuffer(ds.data());
+    QScopedPointer<QRhiTextureRenderTarget> texRt(rhi->newTextureRenderTarget(rtDesc));
+    QScopedPointer<QRhiRenderPassDescriptor> rp(texRt->newCompatibleRenderPassDescriptor());
+    texRt->setRenderPassDescriptor(rp.data());
+    QVERIFY(texRt->create());
+    quickWindow->setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(texRt.data()));
+
+    const auto renderFrame = [&]() {
+        QCoreApplication::processEvents();
+        renderControl->polishItems();
+        renderControl->beginFrame();
+        renderControl->sync();
+        renderControl->render();
+        renderControl->endFrame();
+        return QQuickWindowPrivate::get(quickWindow.data())->renderer->damageRect();
+    };
+
+    // The first frame damages everything, a frame without changes nothing
+    QCOMPARE(renderFrame(), QRect(QPoint(0, 0), size));
+    QVERIFY(renderFrame().isEmpty());
+
+    // Moving an item damages its old and new area, rounded out by a pixel on each side
+    moving->setX(100);
+    const QRect damage = renderFrame();
+    QVERIFY2(damage.contains(QRect(10, 10, 20, 20)) && damage.contains(QRect(100, 10, 20, 20)),
+             qPrintable(QDebug::toString(damage)));
+    QVERIFY2(QRect(8, 8, 114, 24).contains(damage), qPrintable(QDebug::toString(damage)));
+
+    // Resizing the render target changes the projection and damages everything
+    size = QSize(150, 150);
+    tex->setPixelSize(size);
+    QVERIFY(tex->create());
+    ds->setPixelSize(size);
+    QVERIFY(ds->create());
+    quickWindow->contentItem()->setSize(size);
+    quickWindow->setGeometry(0, 0, size.width(), size.height());
+    QCOMPARE(renderFrame(), QRect(QPoint(0, 0), size));
+    QVERIFY(renderFrame().isEmpty());
+
+    // A move after the resize is mapped with the new projection
+    moving->setY(50);
+    const QRect movedDamage = renderFrame();
+    QVERIFY2(movedDamage.contains(QRect(100, 10, 20, 20)) && movedDamage.contains(QRect(100, 50, 20, 20)),
+             qPrintable(QDebug::toString(movedDamage)));
+    QVERIFY2(QRect(98, 8, 24, 64).contains(movedDamage), qPrintable(QDebug::toString(movedDamage)));
+
+    rootItem.reset();
+}
+
 void tst_RenderControl::renderAndReadBackWithVulkanNative()
 {
 #if QT_CONFIG(vulkan)
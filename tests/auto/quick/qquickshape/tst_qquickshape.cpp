@@ -9,6 +9,7 @@
 #include <QtQml/qqmlexpression.h>
 #include <QtQml/qqmlincubator.h>
 #include <QtQuickShapes/private/qquickshape_p.h>
+#include <QtQuickShapes/private/qquickshapecurverenderer_p.h>
 #include <QStandardPaths>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
@@ -63,6 +64,7 @@ private slots:
     void multilineDataTypes();
     void multilineStronglyTyped();
     void fillTransform();
+    void curveRendererManyPaths();
 
 private:
     QVector<QPolygonF> m_lowPolyLogo;
@@ -702,6 +704,38 @@ void tst_QQuickShape::fillTransform()
     QVERIFY(p1->fillTransform().isIdentity());
 }
 
+void tst_QQuickShape::curveRendererManyPaths()
+{
+    // The paths that a synchronous sync processes are spread over the thread pool;
+    // each of them must still end up with its own nodes, in order
+    QQuickItem item;
+    QSGNode rootNode;
+    QQuickShapeCurveRenderer renderer(&item);
+    renderer.setRootNode(&rootNode);
+
+    const int pathCount = 32;
+    renderer.beginSync(pathCount, nullptr);
+    for (int i = 0; i < pathCount; ++i) {
+        QPainterPath path;
+        path.addEllipse(QRectF(i * 10, 0, 8, 8));
+        renderer.setPath(i, path);
+        renderer.setFillColor(i, Qt::red);
+        renderer.setStrokeColor(i, Qt::transparent);
+    }
+    renderer.endSync(false);
+    renderer.updateNode();
+    QCOMPARE(rootNode.childCount(), pathCount);
+
+    for (int i = 0; i < pathCount; ++i) {
+        auto *node = static_cast<QSGGeometryNode *>(rootNode.childAtIndex(i));
+        QVERIFY(node->geometry());
+        QVERIFY(node->geometry()->vertexCount() > 0);
+        const auto *vertices = static_cast<const float *>(node->geometry()->vertexData());
+        QCOMPARE_GE(vertices[0], i * 10 - 1);
+        QCOMPARE_LE(vertices[0], i * 10 + 9);
+    }
+}
+
 QTEST_MAIN(tst_QQuickShape)
 
 #include "tst_qquickshape.moc"
@@ -71,6 +71,18 @@ Q_DECLARE_METATYPE(QMarginsF);
     QVERIFY(QQuickTest::qWaitForPolish(item))
 #define WAIT_UNTIL_POLISHED WAIT_UNTIL_POLISHED_ARG(tableView)
 
+class RowHeightProvider : public QObject, public QQuickTableViewSizeProvider
+{
+    Q_OBJECT
+    Q_INTERFACES(QQuickTableViewSizeProvider)
+
+public:
+    using QObject::QObject;
+
+    // Hide every third row, and vary the height of the others
+    qreal sizeAt(int row) const override { return row % 3 == 1 ? 0 : 20 + row % 5; }
+};
+
 class tst_QQuickTableView : public QQmlDataTest
 {
     Q_OBJECT
@@ -110,6 +122,7 @@ private slots:
     void checkRowHeightProviderInvalidReturnValues();
     void checkRowHeightProviderNegativeReturnValue();
     void checkRowHeightProviderNotCallable();
+    void checkNativeRowHeightProvider();
     void isColumnLoadedAndIsRowLoaded();
     void checkForceLayoutFunction();
     void checkForceLayoutEndUpDoingALayout();
@@ -776,6 +789,48 @@ void tst_QQuickTableView::checkRowHeightProviderNotCallable()
         QCOMPARE(fxItem->item->height(), kDefaultRowHeight);
 }
 
+void tst_QQuickTableView::checkNativeRowHeightProvider()
+{
+    // Check that a C++ object implementing QQuickTableViewSizeProvider can be
+    // assigned to rowHeightProvider, and that it's used to look up both the
+    // row heights and the row at a given position, also far from the loaded rows.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    const int rowCount = 10000;
+    auto provider = new RowHeightProvider(tableView);
+    tableView->setModel(TestModelAsVariant(rowCount, 5));
+    tableView->setRowHeightProvider(view->engine()->newQObject(provider));
+
+    WAIT_UNTIL_POLISHED;
+
+    QVERIFY(tableViewPrivate->rowSizeIndex.isValid());
+    for (auto fxItem : tableViewPrivate->loadedItems)
+        QCOMPARE(fxItem->item->height(), provider->sizeAt(fxItem->cell.y()));
+
+    const qreal spacing = tableView->rowSpacing();
+    qreal expectedRowY = 0;
+    qreal expectedContentHeight = 0;
+    const int row = 7001;
+    for (int r = 0; r < rowCount; ++r) {
+        if (r == row)
+            expectedRowY = expectedContentHeight;
+        const qreal height = provider->sizeAt(r);
+        if (height > 0)
+            expectedContentHeight += height + spacing;
+    }
+    expectedContentHeight -= spacing;
+    QCOMPARE(tableView->contentHeight(), expectedContentHeight);
+
+    tableView->positionViewAtRow(row, QQuickTableView::AlignTop);
+
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), row);
+    QCOMPARE(tableViewPrivate->loadedTableItem(QPoint(0, row))->geometry().y(), expectedRowY);
+    QCOMPARE(tableView->contentY(), expectedRowY);
+    QCOMPARE(tableView->contentHeight(), expectedContentHeight);
+}
+
 void tst_QQuickTableView::isColumnLoadedAndIsRowLoaded()
 {
     // Check that all the delegate items are loaded and available from
@@ -0,0 +1,30 @@
+import QtQuick
+
+Item {
+    width: 400
+    height: 400
+
+    property string longText: "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat."
+
+    Text {
+        objectName: "synchronous"
+        width: 200
+        wrapMode: Text.Wrap
+        text: parent.longText
+    }
+
+    Text {
+        objectName: "asynchronous"
+        asynchronous: true
+        width: 200
+        wrapMode: Text.Wrap
+        text: parent.longText
+    }
+
+    Text {
+        objectName: "implicitSize"
+        asynchronous: true
+        horizontalAlignment: Text.AlignHCenter
+        text: "Hello\nWorld, again"
+    }
+}
@@ -21,6 +21,7 @@
 #include <private/qguiapplication_p.h>
 #include <limits.h>
 #include <QtGui/QMouseEvent>
+#include <QtCore/qscopeguard.h>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtQuickTestUtils/private/testhttpserver_p.h>
 #include <QtQuickTestUtils/private/viewtestutils_p.h>
@@ -165,6 +166,9 @@ private slots:
 
     void displaySuperscriptedTag();
 
+    void asynchronousLayout();
+    void layoutCache();
+
 private:
     QStringList standard;
     QStringList richText;
@@ -4877,6 +4881,126 @@ void tst_qquicktext::displaySuperscriptedTag()
     QCOMPARE(color.green(), 255);
 }
 
+void tst_qquicktext::asynchronousLayout()
+{
+    QScopedPointer<QQuickView> window(createView(testFile("asynchronousLayout.qml")));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    auto *synchronous = window->rootObject()->findChild<QQuickText *>("synchronous");
+    QVERIFY(synchronous);
+    auto *asynchronous = window->rootObject()->findChild<QQuickText *>("asynchronous");
+    QVERIFY(asynchronous);
+    QVERIFY(asynchronous->asynchronous());
+
+    // The results match the ones of a synchronous layout
+    QTRY_COMPARE(asynchronous->lineCount(), synchronous->lineCount());
+    QVERIFY(synchronous->lineCount() > 1);
+    QCOMPARE(asynchronous->contentWidth(), synchronous->contentWidth());
+    QCOMPARE(asynchronous->contentHeight(), synchronous->contentHeight());
+    QCOMPARE(asynchronous->implicitHeight(), synchronous->implicitHeight());
+    QCOMPARE(asynchronous->baselineOffset(), synchronous->baselineOffset());
+    QCOMPARE(asynchronous->advance(), synchronous->advance());
+
+    // The item keeps its geometry until the new layout is ready
+    const qreal contentHeight = asynchronous->contentHeight();
+    QSignalSpy lineCountSpy(asynchronous, &QQuickText::lineCountChanged);
+    asynchronous->setText(QStringLiteral("Short"));
+    QCOMPARE(asynchronous->contentHeight(), contentHeight);
+    QTRY_COMPARE(asynchronous->lineCount(), 1);
+    QCOMPARE(lineCountSpy.size(), 1);
+    QVERIFY(asynchronous->contentHeight() < contentHeight);
+
+    // forceLayout() lays out immediately
+    asynchronous->setText(synchronous->text());
+    asynchronous->forceLayout();
+    QCOMPARE(asynchronous->lineCount(), synchronous->lineCount());
+    QCOMPARE(asynchronous->contentHeight(), synchronous->contentHeight());
+
+    // Eliding is not supported asynchronously, so it lays out immediately
+    asynchronous->setMaximumLineCount(2);
+    asynchronous->setElideMode(QQuickText::ElideRight);
+    QCOMPARE(asynchronous->lineCount(), 2);
+    QVERIFY(asynchronous->truncated());
+
+    // Without a width, the item takes the implicit width of the text
+    auto *implicitSize = window->rootObject()->findChild<QQuickText *>("implicitSize");
+    QVERIFY(implicitSize);
+    QTRY_COMPARE(implicitSize->lineCount(), 2);
+    QVERIFY(implicitSize->implicitWidth() > 0);
+    QCOMPARE(implicitSize->width(), implicitSize->implicitWidth());
+}
+
+void tst_qquicktext::layoutCache()
+{
+    const int layoutCacheSize = QQuickTextPrivate::layoutCacheSize;
+    QQuickTextPrivate::layoutCacheSize = 16;
+    const auto cleanup = qScopeGuard([&] { QQuickTextPrivate::layoutCacheSize = layoutCacheSize; });
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(R"(
+        import QtQuick
+        Column {
+            Text { width: 100; wrapMode: Text.Wrap; text: "The same label, laid out once" }
+            Text { width: 100; wrapMode: Text.Wrap; text: "The same label, laid out once" }
+            Text { width: 80; wrapMode: Text.Wrap; text: "The same label, laid out once" }
+            Text { width: 100; wrapMode: Text.Wrap; elide: Text.ElideRight; text: "The same label, laid out once" }
+        }
+    )", QUrl());
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+    const auto texts = root->findChildren<QQuickText *>();
+    QCOMPARE(texts.size(), 4);
+
+    // Items with the same text, font and constraints share their layout
+    auto *first = QQuickTextPrivate::get(texts.at(0));
+    auto *second = QQuickTextPrivate::get(texts.at(1));
+    QVERIFY(first->sharedLayout);
+    QCOMPARE(first->sharedLayout, second->sharedLayout);
+    QVERIFY(texts.at(0)->lineCount() > 1);
+    QCOMPARE(texts.at(1)->lineCount(), texts.at(0)->lineCount());
+    QCOMPARE(texts.at(1)->contentHeight(), texts.at(0)->contentHeight());
+    QCOMPARE(texts.at(1)->implicitWidth(), texts.at(0)->implicitWidth());
+
+    // Different constraints make for a different layout
+    auto *narrower = QQuickTextPrivate::get(texts.at(2));
+    QVERIFY(narrower->sharedLayout);
+    QVERIFY(narrower->sharedLayout != first->sharedLayout);
+
+    // Elided text is laid out by the item itself
+    QVERIFY(!QQuickTextPrivate::get(texts.at(3))->sharedLayout);
+
+    // Changing the text of one item does not affect the others
+    texts.at(1)->setText(QStringLiteral("Other"));
+    QCOMPARE(texts.at(1)->lineCount(), 1);
+    QVERIFY(texts.at(0)->lineCount() > 1);
+    QCOMPARE(first->sharedLayout->text(), texts.at(0)->text());
+
+    // The cache is bounded by the memory its layouts use, so a layout that
+    // is larger than the whole cache is not kept
+    QQuickTextPrivate::layoutCacheSize = 1;
+    QQmlComponent largeComponent(&engine);
+    largeComponent.setData(R"(
+        import QtQuick
+        Column {
+            property string longText: "A label that is far too long to be kept in a cache of one kilobyte, "
+                                      + "since each of its characters needs memory for its glyph as well"
+            Text { width: 100; wrapMode: Text.Wrap; text: parent.longText }
+            Text { width: 100; wrapMode: Text.Wrap; text: parent.longText }
+        }
+    )", QUrl());
+    QScopedPointer<QObject> largeRoot(largeComponent.create());
+    QVERIFY2(largeRoot, qPrintable(largeComponent.errorString()));
+    const auto largeTexts = largeRoot->findChildren<QQuickText *>();
+    QCOMPARE(largeTexts.size(), 2);
+    auto *firstLarge = QQuickTextPrivate::get(largeTexts.at(0));
+    auto *secondLarge = QQuickTextPrivate::get(largeTexts.at(1));
+    QVERIFY(firstLarge->sharedLayout);
+    QVERIFY(secondLarge->sharedLayout);
+    QVERIFY(firstLarge->sharedLayout != secondLarge->sharedLayout);
+}
+
 QT_END_NAMESPACE
 
 QTEST_MAIN(tst_qquicktext)
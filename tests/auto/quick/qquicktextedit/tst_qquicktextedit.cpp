@@ -163,6 +163,8 @@ private slots:
     void largeTextObservesViewport_data();
     void largeTextObservesViewport();
     void largeTextSelection();
+    void appendedTextObservesViewport();
+    void largeTextEditWhileScrolling();
     void renderingAroundSelection();
     void largeTextTables_data();
     void largeTextTables();
@@ -3927,6 +3929,87 @@ void tst_qquicktextedit::largeTextSelection()
     QVERIFY(eachTextNodeRenderedOnlyOnce);
 }
 
+void tst_qquicktextedit::appendedTextObservesViewport()
+{
+    SKIP_IF_NO_WINDOW_GRAB;
+
+    QQuickView window;
+    QByteArray errorMessage;
+    QVERIFY2(QQuickTest::initView(window, testFileUrl("viewport.qml"), true, &errorMessage), errorMessage.constData());
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QQuickTextEdit *textItem = window.rootObject()->findChild<QQuickTextEdit*>();
+    QVERIFY(textItem);
+    QQuickTextEditPrivate *textPriv = QQuickTextEditPrivate::get(textItem);
+    QVERIFY(!textItem->flags().testFlag(QQuickItem::ItemObservesViewport));
+
+    // grow the text line by line, as a log view does
+    const int lineCount = QQuickTextEditPrivate::largeTextSizeThreshold / 8;
+    for (int i = 0; i < lineCount; ++i)
+        textItem->append(QLatin1String("line ") + QString::number(i));
+    QVERIFY(textItem->flags().testFlag(QQuickItem::ItemObservesViewport));
+
+    // scroll near the end: only the blocks around the viewport get nodes
+    const QTextDocument *doc = textItem->textDocument()->textDocument();
+    const int blockCount = doc->blockCount();
+    textItem->setY(-textItem->positionToRectangle(doc->findBlockByNumber(blockCount - 100).position()).top());
+    QTRY_COMPARE_GT(textPriv->firstBlockInViewport, blockCount - 110);
+    QCOMPARE_LT(textPriv->firstBlockInViewport, blockCount - 90);
+    QCOMPARE_GT(textPriv->firstBlockPastViewport, textPriv->firstBlockInViewport);
+    QCOMPARE_LT(textPriv->firstBlockPastViewport, blockCount);
+
+    // appending more lines does not render the blocks above the viewport again
+    QSignalSpy renderSpy(&window, &QQuickWindow::afterRendering);
+    textItem->append(QLatin1String("end"));
+    QTRY_VERIFY(!renderSpy.isEmpty());
+    QVERIFY(!textPriv->textNodeMap.isEmpty());
+    QCOMPARE_GT(textPriv->firstBlockInViewport, blockCount - 110);
+    QCOMPARE_GT(textPriv->textNodeMap.first().startPos(),
+                doc->findBlockByNumber(blockCount - 110).position());
+}
+
+void tst_qquicktextedit::largeTextEditWhileScrolling()
+{
+    SKIP_IF_NO_WINDOW_GRAB;
+
+    QQuickView window;
+    QByteArray errorMessage;
+    QVERIFY2(QQuickTest::initView(window, testFileUrl("viewport.qml"), true, &errorMessage), errorMessage.constData());
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QQuickTextEdit *textItem = window.rootObject()->findChild<QQuickTextEdit*>();
+    QVERIFY(textItem);
+    QQuickTextEditPrivate *textPriv = QQuickTextEditPrivate::get(textItem);
+
+    const int lineCount = QQuickTextEditPrivate::largeTextSizeThreshold / 8;
+    for (int i = 0; i < lineCount; ++i)
+        textItem->append(QLatin1String("line ") + QString::number(i));
+    QVERIFY(textItem->flags().testFlag(QQuickItem::ItemObservesViewport));
+
+    const QTextDocument *doc = textItem->textDocument()->textDocument();
+    const auto blockTop = [&](int blockNumber) {
+        return textItem->positionToRectangle(doc->findBlockByNumber(blockNumber).position()).top();
+    };
+    textItem->setY(-blockTop(lineCount / 2));
+    QTRY_COMPARE_GT(textPriv->firstBlockInViewport, lineCount / 2 - 10);
+
+    // Edit a block at the top of the viewport, and scroll past it and the
+    // clean nodes after it in the same frame
+    QSignalSpy renderSpy(&window, &QQuickWindow::afterRendering);
+    const int editedBlock = textPriv->firstBlockInViewport + 1;
+    textItem->insert(doc->findBlockByNumber(editedBlock).position(), QLatin1String("edited "));
+    textItem->setY(-blockTop(editedBlock + 30));
+    QTRY_VERIFY(!renderSpy.isEmpty());
+    QTRY_COMPARE_GT(textPriv->firstBlockInViewport, editedBlock + 20);
+
+    // The nodes are neither duplicated nor out of order
+    QVERIFY(!textPriv->textNodeMap.isEmpty());
+    for (qsizetype i = 1; i < textPriv->textNodeMap.size(); ++i) {
+        QVERIFY2(textPriv->textNodeMap.at(i - 1).startPos() < textPriv->textNodeMap.at(i).startPos(),
+                 qPrintable(QString::number(i)));
+    }
+}
+
 void tst_qquicktextedit::renderingAroundSelection()
 {
     QQuickView window;
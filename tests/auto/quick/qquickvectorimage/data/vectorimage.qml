@@ -0,0 +1,5 @@
+import QtQuick
+import QtQuick.VectorImage
+
+VectorImage {
+}
@@ -0,0 +1,269 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+#include <QtCore/qbuffer.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtGui/qpainterpath.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuickVectorImageGenerator/private/qquickbinarygenerator_p.h>
+#include <QtQuickVectorImageGenerator/private/qquickvectorimagebinary_p.h>
+
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+#include <QtQuickTestUtils/private/viewtestutils_p.h>
+
+using namespace QQuickViewTestUtils;
+
+class tst_QQuickVectorImage : public QQmlDataTest
+{
+    Q_OBJECT
+public:
+    tst_QQuickVectorImage();
+
+private slots:
+    void initTestCase() override;
+
+    void binaryRoundTrip();
+    void binaryCorrupt_data();
+    void binaryCorrupt();
+    void binaryGenerator();
+    void loadBinary();
+
+private:
+    static QQuickVectorImageBinary testImage();
+    static QByteArray serialized(const QQuickVectorImageBinary &image);
+    QString generateBinary(const QString &svgFileName);
+
+    QTemporaryDir m_outputDir;
+};
+
+tst_QQuickVectorImage::tst_QQuickVectorImage()
+    : QQmlDataTest(QT_QMLTEST_DATADIR)
+{
+}
+
+void tst_QQuickVectorImage::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    QVERIFY(m_outputDir.isValid());
+}
+
+QQuickVectorImageBinary tst_QQuickVectorImage::testImage()
+{
+    QQuickVectorImageBinary image;
+    image.size = QSizeF(200, 100);
+
+    QPainterPath rect;
+    rect.addRect(0, 0, 100, 100);
+    QQuickVectorImageBinary::Path filled;
+    filled.path = QQuadPath::fromPainterPath(rect);
+    filled.path.addCurvatureData();
+    filled.fillColor = Qt::red;
+    image.paths.append(filled);
+
+    QPainterPath ellipse;
+    ellipse.addEllipse(110, 10, 80, 80);
+    QQuickVectorImageBinary::Path gradientAndStroke;
+    gradientAndStroke.path = QQuadPath::fromPainterPath(ellipse);
+    gradientAndStroke.path.addCurvatureData();
+    gradientAndStroke.gradientType = QGradient::LinearGradient;
+    gradientAndStroke.gradient.stops = { { 0, Qt::blue }, { 1, Qt::green } };
+    gradientAndStroke.gradient.spread = QGradient::ReflectSpread;
+    gradientAndStroke.gradient.a = QPointF(110, 0);
+    gradientAndStroke.gradient.b = QPointF(190, 0);
+    gradientAndStroke.gradient.v0 = 0;
+    gradientAndStroke.gradient.v1 = 0;
+    gradientAndStroke.fillTransform = QTransform::fromTranslate(5, 10);
+    gradientAndStroke.pen = QPen(Qt::black, 4, Qt::DashLine, Qt::RoundCap, Qt::BevelJoin);
+    image.paths.append(gradientAndStroke);
+
+    return image;
+}
+
+QByteArray tst_QQuickVectorImage::serialized(const QQuickVectorImageBinary &image)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    if (!buffer.open(QIODevice::WriteOnly) || !image.write(&buffer))
+        return QByteArray();
+    return data;
+}
+
+QString tst_QQuickVectorImage::generateBinary(const QString &svgFileName)
+{
+    const QString fileName = m_outputDir.filePath(QFileInfo(svgFileName).baseName() + ".qvi");
+    QQuickBinaryGenerator generator(testFile(svgFileName), {}, fileName);
+    if (!generator.generate() || !generator.save())
+        return QString();
+    return fileName;
+}
+
+void tst_QQuickVectorImage::binaryRoundTrip()
+{
+    const QQuickVectorImageBinary image = testImage();
+    QByteArray data = serialized(image);
+    QVERIFY(!data.isEmpty());
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QQuickVectorImageBinary result;
+    QVERIFY(result.read(&buffer));
+    QVERIFY(buffer.atEnd());
+
+    QCOMPARE(result.size, image.size);
+    QCOMPARE(result.paths.size(), image.paths.size());
+    for (int i = 0; i < image.paths.size(); ++i) {
+        const QQuickVectorImageBinary::Path &expected = image.paths.at(i);
+        const QQuickVectorImageBinary::Path &path = result.paths.at(i);
+        QCOMPARE(path.path.elementCountRecursive(), expected.path.elementCountRecursive());
+        QCOMPARE(path.path.toPainterPath(), expected.path.toPainterPath());
+        QCOMPARE(path.path.pathHints(), expected.path.pathHints());
+        QCOMPARE(path.fillColor, expected.fillColor);
+        QCOMPARE(path.gradientType, expected.gradientType);
+        QCOMPARE(path.fillTransform, expected.fillTransform);
+        QCOMPARE(path.pen, expected.pen);
+        QCOMPARE(path.isFilled(), expected.isFilled());
+        QCOMPARE(path.isStroked(), expected.isStroked());
+        if (expected.gradientType != QGradient::NoGradient) {
+            QCOMPARE(path.gradient.stops, expected.gradient.stops);
+            QCOMPARE(path.gradient.spread, expected.gradient.spread);
+            QCOMPARE(path.gradient.a, expected.gradient.a);
+            QCOMPARE(path.gradient.b, expected.gradient.b);
+            QCOMPARE(path.gradient.v0, expected.gradient.v0);
+            QCOMPARE(path.gradient.v1, expected.gradient.v1);
+        }
+    }
+}
+
+void tst_QQuickVectorImage::binaryCorrupt_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QString>("warning");
+
+    const QQuickVectorImageBinary image = testImage();
+    const QByteArray data = serialized(image);
+    const QString corrupt = QStringLiteral("Truncated or corrupt precompiled vector image");
+
+    // The file starts with its magic and version, followed by the size of
+    // the image and the number of paths
+    const qsizetype pathsOffset = 4 + 4 + 2 * sizeof(double) + 4;
+
+    // Measure the first path, which has no gradient, with the same stream settings
+    QByteArray firstPath;
+    {
+        QDataStream stream(&firstPath, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_6_8);
+        stream << image.paths.first().path;
+    }
+    const qsizetype hintsOffset = pathsOffset + firstPath.size() - 1;
+    QByteArray colorData;
+    {
+        QDataStream stream(&colorData, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_6_8);
+        stream << image.paths.first().fillColor;
+    }
+    const qsizetype gradientTypeOffset = pathsOffset + firstPath.size() + colorData.size();
+
+    QByteArray wrongMagic = data;
+    wrongMagic[0] = 'X';
+    QTest::newRow("wrong magic") << wrongMagic << QStringLiteral("Not a precompiled vector image");
+
+    QByteArray newerVersion = data;
+    qToBigEndian(quint32(2), newerVersion.data() + 4);
+    QTest::newRow("newer version") << newerVersion
+                                   << QStringLiteral("Unsupported precompiled vector image version 2");
+
+    QTest::newRow("empty") << QByteArray() << QStringLiteral("Not a precompiled vector image");
+    QTest::newRow("truncated header") << data.left(pathsOffset - 2) << corrupt;
+    QTest::newRow("truncated path") << data.left(pathsOffset + firstPath.size() / 2) << corrupt;
+    QTest::newRow("truncated end") << data.chopped(1) << corrupt;
+
+    QByteArray invalidHints = data;
+    invalidHints[hintsOffset] = char(0x80);
+    QTest::newRow("invalid path hints") << invalidHints << corrupt;
+
+    QByteArray invalidGradient = data;
+    qToBigEndian(qint32(QGradient::NoGradient + 1), invalidGradient.data() + gradientTypeOffset);
+    QTest::newRow("invalid gradient type") << invalidGradient << corrupt;
+}
+
+void tst_QQuickVectorImage::binaryCorrupt()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QString, warning);
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QQuickVectorImageBinary result = testImage();
+    QTest::ignoreMessage(QtWarningMsg, qPrintable(warning));
+    QVERIFY(!result.read(&buffer));
+}
+
+void tst_QQuickVectorImage::binaryGenerator()
+{
+    const QString fileName = generateBinary("shapes.svg");
+    QVERIFY(!fileName.isEmpty());
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QQuickVectorImageBinary image;
+    QVERIFY(image.read(&file));
+
+    QCOMPARE(image.size, QSizeF(200, 100));
+    // The rectangle, and the circle with its fill and stroke
+    QVERIFY(image.paths.size() >= 2);
+    QCOMPARE(image.paths.first().fillColor, QColor(Qt::red));
+    QVERIFY(!image.paths.first().isStroked());
+    QCOMPARE(image.paths.last().pen.color(), QColor(Qt::black));
+    QVERIFY(image.paths.last().isStroked());
+}
+
+void tst_QQuickVectorImage::loadBinary()
+{
+    const QString fileName = generateBinary("shapes.svg");
+    QVERIFY(!fileName.isEmpty());
+
+    // A file that can't be read leaves the image empty
+    const QString corruptFileName = m_outputDir.filePath("corrupt.qvi");
+    {
+        QFile valid(fileName);
+        QVERIFY(valid.open(QIODevice::ReadOnly));
+        QFile corrupt(corruptFileName);
+        QVERIFY(corrupt.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        corrupt.write(valid.readAll().chopped(1));
+    }
+
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("vectorimage.qml"));
+    QQuickItem *vectorImage = window->rootObject();
+    QVERIFY(vectorImage);
+
+    QTest::ignoreMessage(QtWarningMsg, "Truncated or corrupt precompiled vector image");
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression("^Failed to load precompiled vector image .*corrupt\\.qvi"));
+    vectorImage->setProperty("source", QUrl::fromLocalFile(corruptFileName));
+    QVERIFY(vectorImage->childItems().isEmpty());
+    QCOMPARE(vectorImage->implicitWidth(), 0.0);
+
+    vectorImage->setProperty("source", QUrl::fromLocalFile(fileName));
+    QCOMPARE(vectorImage->childItems().size(), 1);
+    QCOMPARE(vectorImage->implicitWidth(), 200.0);
+    QCOMPARE(vectorImage->implicitHeight(), 100.0);
+
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    if (!QSGRendererInterface::isApiRhiBased(window->rendererInterface()->graphicsApi()))
+        QSKIP("Precompiled vector images need an RHI-based backend");
+
+    const QImage grab = window->grabWindow();
+    const qreal dpr = grab.devicePixelRatio();
+    QCOMPARE(grab.pixelColor((QPointF(50, 50) * dpr).toPoint()), QColor(Qt::red));
+}
+
+QTEST_MAIN(tst_QQuickVectorImage)
+
+#include "tst_qquickvectorimage.moc"
@@ -0,0 +1,281 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+#include <QtCore/qtemporarydir.h>
+#include <QtGui/qrawfont.h>
+
+#include <QtQuick/private/qsgglyphdiskcache_p.h>
+#include <QtQuick/private/qsgcurveglyphatlas_p.h>
+#include <QtQuick/private/qsgcurvefillnode_p.h>
+
+// The file starts with its magic and format version, and each record with its
+// magic, glyph index and size
+static constexpr qsizetype fileHeaderSize = 8;
+static constexpr qsizetype recordHeaderSize = 12;
+
+class tst_QSGGlyphDiskCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanup();
+
+    void roundTrip();
+    void differentFont();
+    void versionMismatch();
+    void truncatedRecord();
+    void corruptRecord();
+    void replacedWhileMapped();
+    void curveGlyphRoundTrip();
+
+private:
+    static QByteArray readFile(const QString &fileName);
+    static void writeFile(const QString &fileName, const QByteArray &contents);
+
+    QTemporaryDir m_cacheDir;
+    QRawFont m_font;
+};
+
+void tst_QSGGlyphDiskCache::initTestCase()
+{
+    QVERIFY(m_cacheDir.isValid());
+    // Read once by the cache, so it has to be set before the first one is created
+    qputenv("QSG_GLYPH_DISK_CACHE_PATH", QFile::encodeName(m_cacheDir.path()));
+    QVERIFY(QSGGlyphDiskCache::isEnabled());
+
+    m_font = QRawFont(QFINDTESTDATA("data/tarzeau_ocr_a.ttf"), 32);
+    QVERIFY(m_font.isValid());
+}
+
+void tst_QSGGlyphDiskCache::cleanup()
+{
+    QDir dir(m_cacheDir.path());
+    for (const QString &file : dir.entryList(QDir::Files))
+        QVERIFY(dir.remove(file));
+}
+
+QByteArray tst_QSGGlyphDiskCache::readFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+    return file.readAll();
+}
+
+void tst_QSGGlyphDiskCache::writeFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QCOMPARE(file.write(contents), contents.size());
+}
+
+void tst_QSGGlyphDiskCache::roundTrip()
+{
+    const QByteArray first("first glyph");
+    const QByteArray second(1000, 'x');
+
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        QVERIFY(cache.find(1).isEmpty());
+        cache.insert(1, first);
+        cache.insert(2, second);
+        // Glyphs are only written once
+        cache.insert(1, "other data");
+    }
+
+    QSGGlyphDiskCache cache(m_font, "test", 32);
+    QCOMPARE(cache.find(1), first);
+    QCOMPARE(cache.find(2), second);
+    QVERIFY(cache.find(3).isEmpty());
+}
+
+void tst_QSGGlyphDiskCache::differentFont()
+{
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        cache.insert(1, "data");
+    }
+
+    const QRawFont otherFont(QFINDTESTDATA("data/daniel.ttf"), 32);
+    QVERIFY(otherFont.isValid());
+
+    QSGGlyphDiskCache sameFont(m_font, "test", 32);
+    QSGGlyphDiskCache differentFont(otherFont, "test", 32);
+    QSGGlyphDiskCache differentKind(m_font, "other", 32);
+    QSGGlyphDiskCache differentSize(m_font, "test", 64);
+    QSGGlyphDiskCache differentVariant(m_font, "test", 32, 1);
+
+    QCOMPARE(sameFont.find(1), QByteArrayView("data"));
+    QVERIFY(differentFont.fileName() != sameFont.fileName());
+    QVERIFY(differentFont.find(1).isEmpty());
+    QVERIFY(differentKind.find(1).isEmpty());
+    QVERIFY(differentSize.find(1).isEmpty());
+    QVERIFY(differentVariant.find(1).isEmpty());
+}
+
+void tst_QSGGlyphDiskCache::versionMismatch()
+{
+    QString fileName;
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        fileName = cache.fileName();
+        cache.insert(1, "data");
+    }
+
+    QByteArray contents = readFile(fileName);
+    QVERIFY(contents.size() > fileHeaderSize);
+    contents[4] = char(contents.at(4) + 1);
+    writeFile(fileName, contents);
+
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        QVERIFY(cache.find(1).isEmpty());
+        cache.insert(2, "new data");
+    }
+
+    // The file was started over in the current format
+    QSGGlyphDiskCache cache(m_font, "test", 32);
+    QVERIFY(cache.find(1).isEmpty());
+    QCOMPARE(cache.find(2), QByteArrayView("new data"));
+}
+
+void tst_QSGGlyphDiskCache::truncatedRecord()
+{
+    QString fileName;
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        fileName = cache.fileName();
+        cache.insert(1, "first");
+        cache.insert(2, "second glyph");
+    }
+
+    QByteArray contents = readFile(fileName);
+    contents.chop(4);
+    writeFile(fileName, contents);
+
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        QCOMPARE(cache.find(1), QByteArrayView("first"));
+        QVERIFY(cache.find(2).isEmpty());
+        cache.insert(3, "third");
+    }
+
+    // The truncated record was dropped, so the ones appended after it are found
+    QSGGlyphDiskCache cache(m_font, "test", 32);
+    QCOMPARE(cache.find(1), QByteArrayView("first"));
+    QVERIFY(cache.find(2).isEmpty());
+    QCOMPARE(cache.find(3), QByteArrayView("third"));
+
+    // A file cut in the middle of a record header
+    writeFile(fileName, readFile(fileName).left(fileHeaderSize + recordHeaderSize / 2));
+    QSGGlyphDiskCache headerOnly(m_font, "test", 32);
+    QVERIFY(headerOnly.find(1).isEmpty());
+}
+
+void tst_QSGGlyphDiskCache::corruptRecord()
+{
+    QString fileName;
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        fileName = cache.fileName();
+        cache.insert(1, "abcd");
+        cache.insert(2, "efgh");
+        cache.insert(3, "ijkl");
+    }
+
+    // Break the magic of the second record
+    QByteArray contents = readFile(fileName);
+    const qsizetype secondRecord = fileHeaderSize + recordHeaderSize + 4;
+    QVERIFY(contents.size() > secondRecord);
+    contents[secondRecord] = char(~contents.at(secondRecord));
+    writeFile(fileName, contents);
+
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        QCOMPARE(cache.find(1), QByteArrayView("abcd"));
+        QVERIFY(cache.find(2).isEmpty());
+        QVERIFY(cache.find(3).isEmpty());
+    }
+
+    // A record claiming to be larger than the file
+    contents = readFile(fileName);
+    const qsizetype sizeOffset = fileHeaderSize + 8;
+    const quint32 hugeSize = 0x7fffffff;
+    memcpy(contents.data() + sizeOffset, &hugeSize, sizeof(hugeSize));
+    writeFile(fileName, contents);
+
+    QSGGlyphDiskCache cache(m_font, "test", 32);
+    QVERIFY(cache.find(1).isEmpty());
+}
+
+void tst_QSGGlyphDiskCache::replacedWhileMapped()
+{
+    QString fileName;
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        fileName = cache.fileName();
+        cache.insert(1, "first");
+        cache.insert(2, "second");
+    }
+
+    // Another user of the file has it mapped while it gets replaced
+    QSGGlyphDiskCache mapped(m_font, "test", 32);
+    QCOMPARE(mapped.find(2), QByteArrayView("second"));
+
+    // Break the magic of the second record in place, without changing the size
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        const qsizetype secondRecord = fileHeaderSize + recordHeaderSize + 8;
+        QVERIFY(file.seek(secondRecord));
+        QCOMPARE(file.write("X", 1), 1);
+    }
+    {
+        QSGGlyphDiskCache cache(m_font, "test", 32);
+        QCOMPARE(cache.find(1), QByteArrayView("first"));
+        QVERIFY(cache.find(2).isEmpty());
+        cache.insert(3, "third");
+    }
+
+    // The tail was dropped in a new file, so the one that is still mapped
+    // was neither shrunk nor overwritten by the new record
+    QCOMPARE(mapped.find(1), QByteArrayView("first"));
+    QCOMPARE(mapped.find(2), QByteArrayView("second"));
+
+    QSGGlyphDiskCache cache(m_font, "test", 32);
+    QCOMPARE(cache.find(1), QByteArrayView("first"));
+    QVERIFY(cache.find(2).isEmpty());
+    QCOMPARE(cache.find(3), QByteArrayView("third"));
+}
+
+void tst_QSGGlyphDiskCache::curveGlyphRoundTrip()
+{
+    const QList<quint32> glyphs = m_font.glyphIndexesForString(QStringLiteral("Qt"));
+    QCOMPARE(glyphs.size(), 2);
+
+    const auto glyphGeometry = [&glyphs](QSGCurveGlyphAtlas *atlas) {
+        atlas->populate(glyphs);
+        QSGCurveFillNode node;
+        for (quint32 glyph : glyphs)
+            atlas->addGlyph(&node, glyph, QPointF(10, 20), 32);
+        node.cookGeometry();
+        const QSGGeometry *geometry = node.geometry();
+        return QByteArray(static_cast<const char *>(geometry->vertexData()),
+                          geometry->vertexCount() * geometry->sizeOfVertex());
+    };
+
+    QSGCurveGlyphAtlas generated(m_font);
+    const QByteArray generatedGeometry = glyphGeometry(&generated);
+    QVERIFY(!generatedGeometry.isEmpty());
+
+    // The second atlas finds the glyphs in the file written by the first one
+    QCOMPARE(QDir(m_cacheDir.path()).entryList(QDir::Files).size(), 1);
+    QSGCurveGlyphAtlas cached(m_font);
+    QCOMPARE(glyphGeometry(&cached), generatedGeometry);
+}
+
+QTEST_MAIN(tst_QSGGlyphDiskCache)
+
+#include "tst_qsgglyphdiskcache.moc"
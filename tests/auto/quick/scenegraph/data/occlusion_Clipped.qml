@@ -0,0 +1,18 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+import SceneGraphTest
+
+Item {
+    width: 300
+    height: 200
+
+    ColorRect { x: 20; y: 20; width: 50; height: 50; color: "red" }
+    Item {
+        width: 100
+        height: 100
+        clip: true
+        ColorRect { width: 100; height: 100; color: "blue" }
+    }
+}
@@ -16,6 +16,8 @@
 #include <private/qopenglcontext_p.h>
 #endif
 
+#include <private/qquickwindow_p.h>
+#include <private/qsgbatchrenderer_p.h>
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
 #include <private/qsgrhisupport_p.h>
@@ -75,6 +77,37 @@ private:
     QColor m_color;
 };
 
+class ColorRect : public QQuickItem
+{
+    Q_PROPERTY(QColor color READ color WRITE setColor)
+    Q_OBJECT
+public:
+    ColorRect() {
+        setFlag(ItemHasContents);
+    }
+
+    void setColor(const QColor &c) {
+        m_color = c;
+        update();
+    }
+
+    QColor color() const { return m_color; }
+
+    // Flat color material, which is opaque unless the color is translucent
+    QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *) override
+    {
+        QSGSimpleRectNode *rn = static_cast<QSGSimpleRectNode *>(node);
+        if (!rn)
+            rn = new QSGSimpleRectNode;
+        rn->setRect(boundingRect());
+        rn->setColor(m_color);
+        return rn;
+    }
+
+private:
+    QColor m_color;
+};
+
 class tst_SceneGraph : public QQmlDataTest
 {
     Q_OBJECT
@@ -90,6 +123,8 @@ private slots:
 
     void render_data();
     void render();
+    void occlusionCulling_data();
+    void occlusionCulling();
 #if QT_CONFIG(opengl)
     void hideWithOtherContext();
 #endif
@@ -117,6 +152,7 @@ tst_SceneGraph::tst_SceneGraph()
 void tst_SceneGraph::initTestCase()
 {
     qmlRegisterType<PerPixelRect>("SceneGraphTest", 1, 0, "PerPixelRect");
+    qmlRegisterType<ColorRect>("SceneGraphTest", 1, 0, "ColorRect");
 
     QQmlDataTest::initTestCase();
 
@@ -463,6 +499,63 @@ void tst_SceneGraph::render()
     }
 }
 
+void tst_SceneGraph::occlusionCulling_data()
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<bool>("enabled");
+    QTest::addColumn<int>("occludedBatches");
+    QTest::addColumn<QPoint>("samplePos");
+    QTest::addColumn<QColor>("sampleColor");
+
+    QTest::newRow("disabled") << QStringLiteral("occlusion_Opaque.qml") << false << 0
+                              << QPoint(40, 40) << QColor(Qt::blue);
+    QTest::newRow("opaque") << QStringLiteral("occlusion_Opaque.qml") << true << 1
+                            << QPoint(40, 40) << QColor(Qt::blue);
+    QTest::newRow("translucent") << QStringLiteral("occlusion_Translucent.qml") << true << 0
+                                 << QPoint(40, 40) << QColor::fromRgbF(0.5, 0, 0.5);
+    QTest::newRow("clipped") << QStringLiteral("occlusion_Clipped.qml") << true << 0
+                             << QPoint(40, 40) << QColor(Qt::blue);
+    QTest::newRow("differentRoot") << QStringLiteral("occlusion_DifferentRoot.qml") << true << 0
+                                   << QPoint(190, 40) << QColor(Qt::red);
+}
+
+void tst_SceneGraph::occlusionCulling()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping occlusion culling test due to not running with QRhi");
+
+    QFETCH(QString, file);
+    QFETCH(bool, enabled);
+    QFETCH(int, occludedBatches);
+    QFETCH(QPoint, samplePos);
+    QFETCH(QColor, sampleColor);
+
+    // Occlusion culling is opt-in, and read when the renderer is created
+    if (enabled)
+        qputenv("QSG_RENDERER_OCCLUSION_CULLING", "1");
+    auto cleanup = qScopeGuard([]() { qunsetenv("QSG_RENDERER_OCCLUSION_CULLING"); });
+
+    QQuickView view;
+    view.setSource(testFileUrl(file));
+    view.setResizeMode(QQuickView::SizeViewToRootObject);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    const QImage content = view.grabWindow();
+    auto *renderer = static_cast<QSGBatchRenderer::Renderer *>(QQuickWindowPrivate::get(&view)->renderer);
+    QVERIFY(renderer);
+    const QSGBatchRenderer::Renderer::OcclusionStatistics stats = renderer->occlusionStatistics();
+    QCOMPARE(stats.occludedOpaqueBatches + stats.occludedAlphaBatches, occludedBatches);
+
+    // Culling must not change what ends up on screen
+    const qreal scale = view.devicePixelRatio();
+    const QColor pixel = content.pixelColor(qFloor(samplePos.x() * scale), qFloor(samplePos.y() * scale));
+    QVERIFY2(qAbs(pixel.red() - sampleColor.red()) <= 2
+                 && qAbs(pixel.green() - sampleColor.green()) <= 2
+                 && qAbs(pixel.blue() - sampleColor.blue()) <= 2,
+             qPrintable(QStringLiteral("got %1, expected %2").arg(pixel.name(), sampleColor.name())));
+}
+
 #if QT_CONFIG(opengl)
 // Testcase for QTBUG-34898. We make another context current on another surface
 // in the GUI thread and hide the QQuickWindow while the other context is
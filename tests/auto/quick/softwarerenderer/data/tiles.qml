@@ -0,0 +1,56 @@
+import QtQuick
+
+Item {
+    width: 300
+    height: 200
+
+    Rectangle {
+        anchors.fill: parent
+        gradient: Gradient {
+            GradientStop { position: 0; color: "lightsteelblue" }
+            GradientStop { position: 1; color: "navy" }
+        }
+    }
+
+    Rectangle {
+        x: 17; y: 11
+        width: 121; height: 83
+        radius: 20
+        color: "#80ff8000"
+        border.color: "darkred"
+        border.width: 3
+    }
+
+    Rectangle {
+        x: 150; y: 30
+        width: 101; height: 67
+        rotation: 33
+        color: "green"
+        border.color: "yellow"
+        border.width: 2
+    }
+
+    Rectangle {
+        x: 40; y: 110
+        width: 97; height: 71
+        topLeftRadius: 30
+        bottomRightRadius: 12
+        color: "purple"
+        opacity: 0.7
+    }
+
+    Rectangle {
+        x: 161; y: 121
+        width: 129; height: 61
+        rotation: -11
+        radius: 9
+        color: "white"
+    }
+
+    Text {
+        x: 5; y: 95
+        text: "Tiles on several threads"
+        font.pixelSize: 19
+        color: "black"
+    }
+}
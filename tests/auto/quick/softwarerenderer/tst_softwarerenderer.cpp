@@ -22,6 +22,11 @@ private slots:
     void initTestCase() override;
 
     void renderTarget();
+    void tiledRendering_data();
+    void tiledRendering();
+
+private:
+    QImage renderScene(const QString &fileName, qreal devicePixelRatio, int threadCount);
 };
 
 tst_SoftwareRenderer::tst_SoftwareRenderer()
@@ -89,6 +94,71 @@ void tst_SoftwareRenderer::renderTarget()
              qPrintable(errorMessage));
 }
 
+QImage tst_SoftwareRenderer::renderScene(const QString &fileName, qreal devicePixelRatio, int threadCount)
+{
+    // Read when the renderer is created
+    qputenv("QSG_SOFTWARE_RENDER_THREADS", QByteArray::number(threadCount));
+    qputenv("QSG_SOFTWARE_TILE_SIZE", "32");
+
+    QQuickRenderControl rc;
+    QScopedPointer<QQuickWindow> window(new QQuickWindow(&rc));
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl(fileName));
+    QScopedPointer<QQuickItem> item(qobject_cast<QQuickItem *>(component.create()));
+    if (!item)
+        return QImage();
+    item->setParentItem(window->contentItem());
+    window->resize(item->size().toSize());
+
+    QImage renderTarget((QSizeF(window->size()) * devicePixelRatio).toSize(),
+                        QImage::Format_ARGB32_Premultiplied);
+    renderTarget.setDevicePixelRatio(devicePixelRatio);
+    renderTarget.fill(Qt::red);
+    auto rt = QQuickRenderTarget::fromPaintDevice(&renderTarget);
+    rt.setDevicePixelRatio(devicePixelRatio);
+    window->setRenderTarget(rt);
+
+    rc.polishItems();
+    rc.sync();
+    rc.render();
+
+    qunsetenv("QSG_SOFTWARE_RENDER_THREADS");
+    qunsetenv("QSG_SOFTWARE_TILE_SIZE");
+    return renderTarget;
+}
+
+void tst_SoftwareRenderer::tiledRendering_data()
+{
+    QTest::addColumn<qreal>("devicePixelRatio");
+
+    QTest::newRow("1") << qreal(1);
+    QTest::newRow("1.25") << qreal(1.25);
+    QTest::newRow("1.5") << qreal(1.5);
+    QTest::newRow("2") << qreal(2);
+}
+
+void tst_SoftwareRenderer::tiledRendering()
+{
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("Skipping complex rendering tests due to not running with software");
+
+    QFETCH(qreal, devicePixelRatio);
+
+    const QImage serial = renderScene("tiles.qml", devicePixelRatio, 1);
+    QVERIFY(!serial.isNull());
+
+    // Make sure the scene is painted in tiles
+    QLoggingCategory::setFilterRules("qt.scenegraph.softwarecontext.abstractrenderer.debug=true");
+    QTest::ignoreMessage(QtDebugMsg, QRegularExpression("^renderNodesInTiles "));
+    const QImage tiled = renderScene("tiles.qml", devicePixelRatio, 4);
+    QLoggingCategory::setFilterRules(QString());
+    QVERIFY(!tiled.isNull());
+
+    // Every device pixel is painted by exactly one thread, the same way it
+    // is without tiles
+    QCOMPARE(tiled, serial);
+}
+
 #include "tst_softwarerenderer.moc"
 
 QTEST_MAIN(tst_SoftwareRenderer)
@@ -0,0 +1,151 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlexpression.h>
+
+#include <private/qqmllistmodel_p.h>
+
+static constexpr int RowCount = 100000;
+
+class tst_qqmllistmodel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void scanNumbers_data();
+    void scanNumbers();
+    void fill_data();
+    void fill();
+
+private:
+    void addStorageColumn();
+    QQmlListModel *createModel(QQmlEngine *engine, bool rowStorage);
+    static void populate(QQmlEngine *engine, QQmlListModel *model, const QString &code);
+};
+
+static const QString perRowAppend = QStringLiteral(R"(
+        for (var i = 0; i < %1; ++i)
+            append({ x: i, y: -i, visible: i % 2 === 0 }))");
+
+static const QString typedArrayAppend = QStringLiteral(R"(
+        var x = new Float64Array(%1)
+        var y = new Int32Array(%1)
+        var visible = new Array(%1)
+        for (var i = 0; i < %1; ++i) {
+            x[i] = i
+            y[i] = -i
+            visible[i] = i % 2 === 0
+        }
+        appendColumns({ x: x, y: y, visible: visible }))");
+
+static const QString parsedJsonAppend = QStringLiteral("append(JSON.parse(json))");
+static const QString jsonAppend = QStringLiteral("appendFromJson(json)");
+
+static QString jsonRows()
+{
+    QString json = QStringLiteral("[");
+    for (int i = 0; i < RowCount; ++i) {
+        if (i > 0)
+            json += QLatin1Char(',');
+        json += QStringLiteral(R"({"x":%1,"y":%2,"visible":%3})")
+                        .arg(i).arg(-i).arg(i % 2 == 0 ? QLatin1String("true") : QLatin1String("false"));
+    }
+    json += QLatin1Char(']');
+    return json;
+}
+
+void tst_qqmllistmodel::addStorageColumn()
+{
+    QTest::addColumn<bool>("rowStorage");
+}
+
+QQmlListModel *tst_qqmllistmodel::createModel(QQmlEngine *engine, bool rowStorage)
+{
+    // The storage is chosen when the layout of the model is created
+    if (rowStorage)
+        qputenv("QML_LISTMODEL_ROW_STORAGE", "1");
+    else
+        qunsetenv("QML_LISTMODEL_ROW_STORAGE");
+
+    QQmlComponent component(engine);
+    component.setData("import QtQml.Models\nListModel {}", QUrl());
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(component.create());
+    qunsetenv("QML_LISTMODEL_ROW_STORAGE");
+    return model;
+}
+
+void tst_qqmllistmodel::populate(QQmlEngine *engine, QQmlListModel *model, const QString &code)
+{
+    QQmlExpression expr(engine->rootContext(), model,
+                        QString(code).replace(QLatin1String("%1"), QString::number(RowCount)));
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), qPrintable(expr.error().toString()));
+    QCOMPARE(model->count(), RowCount);
+}
+
+void tst_qqmllistmodel::scanNumbers_data()
+{
+    addStorageColumn();
+    QTest::newRow("rows") << true;
+    QTest::newRow("columns") << false;
+}
+
+void tst_qqmllistmodel::scanNumbers()
+{
+    QFETCH(bool, rowStorage);
+
+    QQmlEngine engine;
+    QScopedPointer<QQmlListModel> model(createModel(&engine, rowStorage));
+    QVERIFY(model);
+    populate(&engine, model.data(), typedArrayAppend);
+
+    const int xRole = model->roleNames().key("x");
+    const int visibleRole = model->roleNames().key("visible");
+
+    double sum = 0;
+    QBENCHMARK {
+        for (int i = 0; i < RowCount; ++i) {
+            const QModelIndex index = model->index(i, 0);
+            if (model->data(index, visibleRole).toBool())
+                sum += model->data(index, xRole).toDouble();
+        }
+    }
+    QVERIFY(sum > 0);
+}
+
+void tst_qqmllistmodel::fill_data()
+{
+    addStorageColumn();
+    QTest::addColumn<QString>("code");
+
+    QTest::newRow("rows, append") << true << perRowAppend;
+    QTest::newRow("rows, appendColumns") << true << typedArrayAppend;
+    QTest::newRow("columns, append") << false << perRowAppend;
+    QTest::newRow("columns, appendColumns") << false << typedArrayAppend;
+    QTest::newRow("rows, append parsed JSON") << true << parsedJsonAppend;
+    QTest::newRow("rows, appendFromJson") << true << jsonAppend;
+    QTest::newRow("columns, append parsed JSON") << false << parsedJsonAppend;
+    QTest::newRow("columns, appendFromJson") << false << jsonAppend;
+}
+
+void tst_qqmllistmodel::fill()
+{
+    QFETCH(bool, rowStorage);
+    QFETCH(QString, code);
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty(QStringLiteral("json"), jsonRows());
+    QBENCHMARK {
+        QScopedPointer<QQmlListModel> model(createModel(&engine, rowStorage));
+        QVERIFY(model);
+        populate(&engine, model.data(), code);
+    }
+}
+
+QTEST_MAIN(tst_qqmllistmodel)
+#include "tst_qqmllistmodel.moc"
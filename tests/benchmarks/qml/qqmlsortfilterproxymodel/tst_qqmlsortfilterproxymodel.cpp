@@ -0,0 +1,190 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qrandom.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
+
+#include <private/qqmlsortfilterproxymodel_p.h>
+
+static constexpr int RowCount = 1000000;
+
+class IntListModel : public QAbstractListModel
+{
+public:
+    enum { ValueRole = Qt::UserRole };
+
+    explicit IntListModel(QList<int> values) : m_values(std::move(values)) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : int(m_values.size());
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        return role == ValueRole ? QVariant(m_values.at(index.row())) : QVariant();
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return { { ValueRole, "value" } };
+    }
+
+    void setValue(int row, int value)
+    {
+        m_values[row] = value;
+        const QModelIndex changed = index(row);
+        emit dataChanged(changed, changed, { ValueRole });
+    }
+
+    void insertValue(int row, int value)
+    {
+        beginInsertRows(QModelIndex(), row, row);
+        m_values.insert(row, value);
+        endInsertRows();
+    }
+
+    void removeValue(int row)
+    {
+        beginRemoveRows(QModelIndex(), row, row);
+        m_values.remove(row);
+        endRemoveRows();
+    }
+
+private:
+    QList<int> m_values;
+};
+
+class tst_qqmlsortfilterproxymodel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void sort_data();
+    void sort();
+    void insertRow();
+    void removeRow();
+    void changeRow();
+    void changeFilter();
+
+private:
+    void addSorter(QQmlSortFilterProxyModel *proxy, QQmlSorterBase *sorter);
+
+    QList<int> m_values;
+};
+
+void tst_qqmlsortfilterproxymodel::initTestCase()
+{
+    QRandomGenerator random(1);
+    m_values.resize(RowCount);
+    for (int &value : m_values)
+        value = int(random.bounded(RowCount));
+}
+
+void tst_qqmlsortfilterproxymodel::addSorter(QQmlSortFilterProxyModel *proxy, QQmlSorterBase *sorter)
+{
+    QQmlListProperty<QQmlSorterBase> sorters = proxy->sorters();
+    sorters.append(&sorters, sorter);
+}
+
+void tst_qqmlsortfilterproxymodel::sort_data()
+{
+    QTest::addColumn<int>("threads");
+    QTest::newRow("single thread") << 1;
+    QTest::newRow("all threads") << QThread::idealThreadCount();
+}
+
+void tst_qqmlsortfilterproxymodel::sort()
+{
+    QFETCH(int, threads);
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int oldThreads = pool->maxThreadCount();
+    pool->setMaxThreadCount(threads);
+
+    IntListModel source(m_values);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("value"));
+
+    QBENCHMARK {
+        QQmlSortFilterProxyModel proxy;
+        proxy.setSourceModel(&source);
+        addSorter(&proxy, &sorter);
+    }
+
+    pool->setMaxThreadCount(oldThreads);
+}
+
+void tst_qqmlsortfilterproxymodel::insertRow()
+{
+    IntListModel source(m_values);
+    QQmlSortFilterProxyModel proxy;
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("value"));
+    addSorter(&proxy, &sorter);
+
+    QBENCHMARK {
+        source.insertValue(RowCount / 2, RowCount / 2);
+    }
+}
+
+void tst_qqmlsortfilterproxymodel::removeRow()
+{
+    IntListModel source(m_values);
+    QQmlSortFilterProxyModel proxy;
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("value"));
+    addSorter(&proxy, &sorter);
+
+    QBENCHMARK {
+        source.removeValue(RowCount / 4);
+    }
+}
+
+void tst_qqmlsortfilterproxymodel::changeRow()
+{
+    IntListModel source(m_values);
+    QQmlSortFilterProxyModel proxy;
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("value"));
+    addSorter(&proxy, &sorter);
+
+    int value = 0;
+    QBENCHMARK {
+        source.setValue(RowCount / 2, value);
+        value = (value + RowCount / 3) % RowCount;
+    }
+}
+
+void tst_qqmlsortfilterproxymodel::changeFilter()
+{
+    IntListModel source(m_values);
+    QQmlSortFilterProxyModel proxy;
+    proxy.setSourceModel(&source);
+    QQmlRoleSorter sorter;
+    sorter.setRoleName(QStringLiteral("value"));
+    addSorter(&proxy, &sorter);
+
+    QQmlValueFilter filter;
+    filter.setRoleName(QStringLiteral("value"));
+    filter.setValue(0);
+    filter.setInvert(true);
+    QQmlListProperty<QQmlFilterBase> filters = proxy.filters();
+    filters.append(&filters, &filter);
+
+    int value = 0;
+    QBENCHMARK {
+        filter.setValue(++value);
+    }
+}
+
+QTEST_MAIN(tst_qqmlsortfilterproxymodel)
+#include "tst_qqmlsortfilterproxymodel.moc"
@@ -3,8 +3,10 @@
 
 #include <qtest.h>
 #include <QPainterPath>
+#include <QRandomGenerator>
 #include <QSGNode>
 #include <private/qquickshapecurverenderer_p.h>
+#include <private/qsgcurveprocessor_p.h>
 
 class tst_CurveRenderer : public QObject
 {
@@ -18,6 +20,9 @@ private slots:
 
     void render_data();
     void render();
+
+    void overlapCandidates_data();
+    void overlapCandidates();
 };
 
 tst_CurveRenderer::tst_CurveRenderer()
@@ -50,6 +55,34 @@ void tst_CurveRenderer::render_data()
         path.cubicTo(800, 200, 300, 800, 300, 400);
         QTest::newRow("figure1") << path;
     }
+
+    {
+        // A route on a map overlay: one long, self-crossing polyline with some curves
+        QRandomGenerator rng(42);
+        QPainterPath path;
+        path.moveTo(400, 400);
+        for (int i = 0; i < 4000; ++i) {
+            const QPointF to(rng.bounded(800.0), rng.bounded(800.0));
+            if (i % 8 == 0)
+                path.quadTo(QPointF(rng.bounded(800.0), rng.bounded(800.0)), to);
+            else
+                path.lineTo(to);
+        }
+        QTest::newRow("maproute") << path;
+    }
+
+    {
+        // Many small, separate subpaths, like the glyphs of a text converted to paths
+        QPainterPath path;
+        for (int row = 0; row < 40; ++row) {
+            for (int column = 0; column < 40; ++column) {
+                const QRectF rect(column * 20, row * 20, 16, 16);
+                path.addEllipse(rect);
+                path.addEllipse(rect.adjusted(4, 4, -4, -4));
+            }
+        }
+        QTest::newRow("glyphs") << path;
+    }
 }
 
 void tst_CurveRenderer::render()
@@ -74,5 +107,21 @@ void tst_CurveRenderer::render()
     }
 }
 
+void tst_CurveRenderer::overlapCandidates_data()
+{
+    render_data();
+}
+
+void tst_CurveRenderer::overlapCandidates()
+{
+    QFETCH(QPainterPath, path);
+
+    const QQuadPath quadPath = QQuadPath::fromPainterPath(path).subPathsClosed();
+    QBENCHMARK {
+        const auto candidates = QSGCurveProcessor::findOverlappingCandidates(quadPath);
+        Q_UNUSED(candidates);
+    }
+}
+
 QTEST_MAIN(tst_CurveRenderer)
 #include "tst_bench_curverenderer.moc"
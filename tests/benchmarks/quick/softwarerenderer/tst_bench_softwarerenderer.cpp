@@ -0,0 +1,102 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QQuickRenderControl>
+#include <QtQuick/QQuickRenderTarget>
+#include <QtQuick/QQuickWindow>
+
+class tst_SoftwareRenderer : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_SoftwareRenderer();
+
+private slots:
+    void initTestCase();
+
+    void fullRepaint_data();
+    void fullRepaint();
+};
+
+tst_SoftwareRenderer::tst_SoftwareRenderer()
+{
+}
+
+void tst_SoftwareRenderer::initTestCase()
+{
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
+}
+
+void tst_SoftwareRenderer::fullRepaint_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<qreal>("devicePixelRatio");
+
+    for (int threadCount : { 1, 2, 4, 8 }) {
+        for (qreal devicePixelRatio : { 1.0, 1.5, 2.0 }) {
+            QTest::addRow("threads=%d, dpr=%.1f", threadCount, devicePixelRatio)
+                    << threadCount << devicePixelRatio;
+        }
+    }
+}
+
+void tst_SoftwareRenderer::fullRepaint()
+{
+    QFETCH(int, threadCount);
+    QFETCH(qreal, devicePixelRatio);
+
+    // Read when the renderer is created
+    qputenv("QSG_SOFTWARE_RENDER_THREADS", QByteArray::number(threadCount));
+
+    QQuickRenderControl rc;
+    QQuickWindow window(&rc);
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick\n"
+                      "Grid {\n"
+                      "    columns: 20\n"
+                      "    Repeater {\n"
+                      "        model: 300\n"
+                      "        Rectangle {\n"
+                      "            width: 64; height: 48\n"
+                      "            radius: index % 3 * 8\n"
+                      "            rotation: index % 7 == 0 ? 15 : 0\n"
+                      "            color: Qt.hsla(index / 300, 0.6, 0.5, 0.8)\n"
+                      "            border.width: index % 2\n"
+                      "            Text { anchors.centerIn: parent; text: index }\n"
+                      "        }\n"
+                      "    }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QQuickItem> item(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(item, qPrintable(component.errorString()));
+    item->setParentItem(window.contentItem());
+    window.resize(1280, 720);
+
+    QImage renderTarget((QSizeF(window.size()) * devicePixelRatio).toSize(),
+                        QImage::Format_ARGB32_Premultiplied);
+    renderTarget.setDevicePixelRatio(devicePixelRatio);
+    auto rt = QQuickRenderTarget::fromPaintDevice(&renderTarget);
+    rt.setDevicePixelRatio(devicePixelRatio);
+    window.setRenderTarget(rt);
+
+    bool flip = false;
+    QBENCHMARK {
+        // A new clear color repaints the whole window
+        window.setColor(flip ? Qt::white : Qt::black);
+        flip = !flip;
+        rc.polishItems();
+        rc.sync();
+        rc.render();
+    }
+
+    qunsetenv("QSG_SOFTWARE_RENDER_THREADS");
+}
+
+QTEST_MAIN(tst_SoftwareRenderer)
+
+#include "tst_bench_softwarerenderer.moc"
@@ -0,0 +1,174 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquicktableview_p.h>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuickTest/quicktest.h>
+
+// A table with ten million rows and a thousand columns, where
+// nothing but the cells in the viewport ever exists.
+static const int kRowCount = 10'000'000;
+static const int kColumnCount = 1'000;
+
+class VirtualTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    using QAbstractTableModel::QAbstractTableModel;
+
+    int rowCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : kRowCount;
+    }
+
+    int columnCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : kColumnCount;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role != Qt::DisplayRole)
+            return {};
+        return QStringLiteral("%1,%2").arg(index.row()).arg(index.column());
+    }
+};
+
+class SizeProvider : public QObject, public QQuickTableViewSizeProvider
+{
+    Q_OBJECT
+    Q_INTERFACES(QQuickTableViewSizeProvider)
+
+public:
+    SizeProvider(qreal baseSize, QObject *parent)
+        : QObject(parent), m_baseSize(baseSize)
+    {}
+
+    qreal sizeAt(int index) const override { return m_baseSize + index % 7; }
+
+private:
+    qreal m_baseSize;
+};
+
+class tst_bench_tableview : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void positionViewAtCell_data();
+    void positionViewAtCell();
+    void forceLayout_data();
+    void forceLayout();
+
+private:
+    void createTableView(bool nativeProviders);
+
+    QQuickView *m_view = nullptr;
+    QQuickTableView *m_tableView = nullptr;
+    VirtualTableModel m_model;
+};
+
+void tst_bench_tableview::init()
+{
+    m_view = new QQuickView;
+    m_view->resize(800, 600);
+}
+
+void tst_bench_tableview::cleanup()
+{
+    delete m_view;
+    m_view = nullptr;
+    m_tableView = nullptr;
+}
+
+void tst_bench_tableview::createTableView(bool nativeProviders)
+{
+    QQmlEngine *engine = m_view->engine();
+    QQmlComponent component(engine);
+    component.setData(R"(
+        import QtQuick
+        TableView {
+            width: 800
+            height: 600
+            animate: false
+            delegate: Rectangle {
+                required property string display
+                implicitWidth: 80
+                implicitHeight: 20
+                Text { text: parent.display }
+            }
+        }
+    )", QUrl());
+    m_tableView = qobject_cast<QQuickTableView *>(component.create());
+    QVERIFY2(m_tableView, qPrintable(component.errorString()));
+    m_tableView->setParent(m_view->contentItem());
+    m_tableView->setParentItem(m_view->contentItem());
+
+    if (nativeProviders) {
+        m_tableView->setRowHeightProvider(engine->newQObject(new SizeProvider(20, m_tableView)));
+        m_tableView->setColumnWidthProvider(engine->newQObject(new SizeProvider(80, m_tableView)));
+    } else {
+        m_tableView->setRowHeightProvider(engine->evaluate(QStringLiteral("(function(row) { return 20 + row % 7 })")));
+        m_tableView->setColumnWidthProvider(engine->evaluate(QStringLiteral("(function(column) { return 80 + column % 7 })")));
+    }
+    m_tableView->setModel(QVariant::fromValue(&m_model));
+
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    if (QQuickTest::qIsPolishScheduled(m_tableView))
+        QVERIFY(QQuickTest::qWaitForPolish(m_tableView));
+}
+
+void tst_bench_tableview::positionViewAtCell_data()
+{
+    QTest::addColumn<bool>("nativeProviders");
+    QTest::newRow("javascript providers") << false;
+    QTest::newRow("native providers") << true;
+}
+
+void tst_bench_tableview::positionViewAtCell()
+{
+    // Jump back and forth between cells that are far apart, which
+    // rebuilds the table around a new top-left cell every time.
+    QFETCH(bool, nativeProviders);
+    createTableView(nativeProviders);
+
+    int jump = 0;
+    QBENCHMARK {
+        const int row = (jump * 7'919'993) % kRowCount;
+        const int column = (jump * 613) % kColumnCount;
+        m_tableView->positionViewAtCell(QPoint(column, row), QQuickTableView::AlignCenter);
+        QQuickWindowPrivate::get(m_view)->polishItems();
+        ++jump;
+    }
+}
+
+void tst_bench_tableview::forceLayout_data()
+{
+    positionViewAtCell_data();
+}
+
+void tst_bench_tableview::forceLayout()
+{
+    // forceLayout() drops the size index, so with native providers,
+    // this measures rebuilding it for all the rows and columns.
+    QFETCH(bool, nativeProviders);
+    createTableView(nativeProviders);
+    m_tableView->positionViewAtCell(QPoint(kColumnCount / 2, kRowCount / 2), QQuickTableView::AlignCenter);
+
+    QBENCHMARK {
+        m_tableView->forceLayout();
+    }
+}
+
+QTEST_MAIN(tst_bench_tableview)
+
+#include "tst_bench_tableview.moc"
@@ -0,0 +1,136 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquickwindow_p.h>
+
+// Thousands of wrapped labels, whose text alternates between a short
+// and a long one, so that every change alters the line count.
+static const int kDelegateCount = 2'000;
+
+class tst_bench_text : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void polish_data();
+    void polish();
+    void layout_data();
+    void layout();
+
+private:
+    void createView(bool asynchronous);
+    void changeText();
+
+    QQuickView *m_view = nullptr;
+    QObject *m_root = nullptr;
+    int m_generation = 0;
+};
+
+void tst_bench_text::init()
+{
+    m_view = new QQuickView;
+    m_view->resize(800, 600);
+    m_generation = 0;
+}
+
+void tst_bench_text::cleanup()
+{
+    delete m_view;
+    m_view = nullptr;
+    m_root = nullptr;
+}
+
+void tst_bench_text::createView(bool asynchronous)
+{
+    QQmlComponent component(m_view->engine());
+    component.setData(R"(
+        import QtQuick
+        Flow {
+            id: root
+            width: 800
+            property bool asynchronous
+            property int generation
+            property int laidOut
+            Repeater {
+                model: 2000 // kDelegateCount
+                Text {
+                    required property int index
+                    width: 120
+                    wrapMode: Text.Wrap
+                    asynchronous: root.asynchronous
+                    text: root.generation % 2
+                          ? "Label " + index + " with a text that is long enough to wrap over several lines"
+                          : "Label " + index
+                    onLineCountChanged: ++root.laidOut
+                }
+            }
+        }
+    )", QUrl());
+    auto *root = qobject_cast<QQuickItem *>(component.createWithInitialProperties(
+            { { QStringLiteral("asynchronous"), asynchronous } }));
+    QVERIFY2(root, qPrintable(component.errorString()));
+    root->setParent(m_view->contentItem());
+    root->setParentItem(m_view->contentItem());
+    m_root = root;
+
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    changeText();
+}
+
+void tst_bench_text::changeText()
+{
+    const int laidOut = m_root->property("laidOut").toInt();
+    m_root->setProperty("generation", ++m_generation);
+    QQuickWindowPrivate::get(m_view)->polishItems();
+    QVERIFY(QTest::qWaitFor([&] {
+        return m_root->property("laidOut").toInt() >= laidOut + kDelegateCount;
+    }));
+}
+
+void tst_bench_text::polish_data()
+{
+    QTest::addColumn<bool>("asynchronous");
+    QTest::newRow("synchronous") << false;
+    QTest::newRow("asynchronous") << true;
+}
+
+void tst_bench_text::polish()
+{
+    // The time the GUI thread spends laying out the text, which is all of
+    // it when synchronous, and only the time to start the jobs otherwise.
+    QFETCH(bool, asynchronous);
+    createView(asynchronous);
+
+    QBENCHMARK {
+        m_root->setProperty("generation", ++m_generation);
+        QQuickWindowPrivate::get(m_view)->polishItems();
+    }
+}
+
+void tst_bench_text::layout_data()
+{
+    polish_data();
+}
+
+void tst_bench_text::layout()
+{
+    // The time until all the labels show their new text.
+    QFETCH(bool, asynchronous);
+    createView(asynchronous);
+
+    QBENCHMARK {
+        changeText();
+    }
+}
+
+QTEST_MAIN(tst_bench_text)
+
+#include "tst_bench_text.moc"
@@ -7,6 +7,7 @@
 #include <QFile>
 #include <QQuickWindow>
 #include <QQuickItem>
+#include <QtQuickVectorImageGenerator/private/qquickbinarygenerator_p.h>
 #include <QtQuickVectorImageGenerator/private/qquickitemgenerator_p.h>
 #include <QtQuickVectorImageGenerator/private/qquickqmlgenerator_p.h>
 #include <QtQuickVectorImageGenerator/private/qquickvectorimageglobal_p.h>
@@ -25,7 +26,9 @@ int main(int argc, char *argv[])
     parser.setApplicationDescription("SVG to QML converter");
     parser.addHelpOption();
     parser.addPositionalArgument("input", QCoreApplication::translate("main", "SVG file to read."));
-    parser.addPositionalArgument("output", QCoreApplication::translate("main", "QML file to write."), "[output]");
+    parser.addPositionalArgument("output", QCoreApplication::translate("main", "QML file to write. If the file name ends with "
+                                                                        "\".qvi\", a precompiled image for VectorImage is "
+                                                                        "written instead."), "[output]");
 
     QCommandLineOption curveRendererOption({ "c", "curve-renderer" },
                                            QCoreApplication::translate("main", "Use the curve renderer in generated QML."));
@@ -109,13 +112,19 @@ int main(int argc, char *argv[])
         flags |= (QQuickVectorImageGenerator::GeneratorFlag::OutlineStrokeMode
                   | QQuickVectorImageGenerator::GeneratorFlag::OptimizePaths);
 
-    QQuickQmlGenerator generator(inFileName, flags, outFileName);
-    generator.setShapeTypeName(typeName);
-    generator.setCommentString(commentString);
-    generator.setAssetFileDirectory(assetOutputDirectory);
-    generator.setAssetFilePrefix(assetOutputPrefix);
-    generator.setRetainFilePaths(keepPaths);
-    bool ok = generator.generate() && generator.save();
+    bool ok;
+    if (outFileName.endsWith(QLatin1String(".qvi"))) {
+        QQuickBinaryGenerator generator(inFileName, flags, outFileName);
+        ok = generator.generate() && generator.save();
+    } else {
+        QQuickQmlGenerator generator(inFileName, flags, outFileName);
+        generator.setShapeTypeName(typeName);
+        generator.setCommentString(commentString);
+        generator.setAssetFileDirectory(assetOutputDirectory);
+        generator.setAssetFilePrefix(assetOutputPrefix);
+        generator.setRetainFilePaths(keepPaths);
+        ok = generator.generate() && generator.save();
+    }
 
 #ifdef ENABLE_GUI
     if (ok && (parser.isSet(guiOption) || outFileName.isEmpty())) {